@@ -64,13 +64,37 @@ CREATE TABLE group_teams (
 CREATE TABLE matches (
     id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
     document JSONB NOT NULL,
+    -- Control de concurrencia optimista: cada escritura lo incrementa (ETag / If-Match)
+    version INTEGER NOT NULL DEFAULT 0,
     last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 
+-- Búsquedas por torneo (listado y el NOT EXISTS de la generación de fixture)
+CREATE INDEX idx_matches_tournament_id ON matches ((document->>'tournamentId'));
+
+-- Outbox: eventos escritos en la misma transacción que el cambio de dominio;
+-- OutboxRelay los publica en orden de id y borra lo enviado.
+CREATE TABLE outbox (
+    id BIGSERIAL PRIMARY KEY,
+    topic TEXT NOT NULL,
+    payload JSONB NOT NULL,
+    created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+);
+
+-- Eventos ya aplicados por tournament_consumer (misma transacción que sus
+-- efectos): una reentrega del broker no repite el avance de ronda ni la llave.
+-- Basta conservar las filas más allá del tiempo máximo de reentrega.
+CREATE TABLE processed_events (
+    consumer TEXT NOT NULL,
+    event_id TEXT NOT NULL,
+    processed_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+    PRIMARY KEY (consumer, event_id)
+);
+
 -- Permisos para tournament_svc (deben estar AL FINAL después de crear todas las tablas)
 GRANT SELECT, INSERT, UPDATE, DELETE ON ALL TABLES IN SCHEMA public TO tournament_svc;
 GRANT USAGE, SELECT ON ALL SEQUENCES IN SCHEMA public TO tournament_svc;
 
 -- Asegurar permisos específicos en tablas críticas
-GRANT SELECT, INSERT, UPDATE, DELETE ON teams, tournaments, groups, group_teams, matches TO tournament_svc;
+GRANT SELECT, INSERT, UPDATE, DELETE ON teams, tournaments, groups, group_teams, matches, outbox, processed_events TO tournament_svc;
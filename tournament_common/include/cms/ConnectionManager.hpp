@@ -5,29 +5,103 @@
 #ifndef SERVICES_CONNECTION_MANAGER_HPP
 #define SERVICES_CONNECTION_MANAGER_HPP
 
+#include <cms/CMSException.h>
 #include <cms/Connection.h>
+#include <cms/ConnectionFactory.h>
+#include <cms/ExceptionListener.h>
 #include <cms/Session.h>
 #include <activemq/core/ActiveMQConnectionFactory.h>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <utility>
 
+// Conecta al primer uso, no al resolverse: sin broker el proceso arranca
+// igual y cada operación que lo necesita falla con CMSException (y vuelve a
+// intentar conectar) hasta que aparezca.
 class ConnectionManager {
 public:
     void initialize(const std::string_view& brokerURI) {
-        factory = std::make_unique<activemq::core::ActiveMQConnectionFactory>(brokerURI.data());
-        connection = std::shared_ptr<cms::Connection>(factory->createConnection());
+        initialize(std::make_unique<activemq::core::ActiveMQConnectionFactory>(brokerURI.data()));
+    }
+
+    // Cualquier fábrica CMS (en los tests, una falsa)
+    void initialize(std::unique_ptr<cms::ConnectionFactory> connectionFactory) {
+        std::lock_guard lock(mutex);
+        factory = std::move(connectionFactory);
+    }
+
+    [[nodiscard]] std::shared_ptr<cms::Connection> Connection() {
+        return CurrentConnection().first;
+    }
+
+    // Conexión vigente y su generación (cambia en cada Reconnect), leídas juntas
+    [[nodiscard]] std::pair<std::shared_ptr<cms::Connection>, std::uint64_t> CurrentConnection() {
+        std::lock_guard lock(mutex);
+        if (!connection) Connect();
+        return {connection, generation};
+    }
 
-        connection->start();
+    [[nodiscard]] std::shared_ptr<cms::Session>
+    CreateSession(cms::Session::AcknowledgeMode mode = cms::Session::AUTO_ACKNOWLEDGE) {
+        return std::shared_ptr<cms::Session>(Connection()->createSession(mode));
     }
 
-    [[nodiscard]] std::shared_ptr<cms::Connection> Connection() const { return connection; }
+    // Reabre la conexión si la de `failedGeneration` se cayó. Varios hilos pueden
+    // notar la misma caída: sólo el primero reconecta. true => vale la pena
+    // reintentar (hay una conexión más nueva que la que falló).
+    bool ReconnectIfFailed(std::uint64_t failedGeneration) {
+        std::lock_guard lock(mutex);
+        if (failedGeneration != generation) return true;
+        if (!connection) return TryConnect(); // el último intento de conectar falló
+        if (!failure->failed) return false;   // la conexión está sana: el error fue de otra cosa
 
-    [[nodiscard]] std::shared_ptr<cms::Session> CreateSession() const {
-        return std::shared_ptr<cms::Session>(connection->createSession(cms::Session::AUTO_ACKNOWLEDGE));
+        try {
+            connection->close();
+        } catch (const cms::CMSException&) {
+            // ya estaba cerrada o sin transporte
+        }
+        connection.reset();
+        return TryConnect();
     }
 
 private:
-    std::unique_ptr<activemq::core::ActiveMQConnectionFactory> factory;
+    // El cliente avisa por aquí cuando pierde el transporte. Lo comparte la
+    // conexión (en su deleter): puede avisar hasta que se destruya, aunque
+    // ya no sea la vigente.
+    struct FailureListener : cms::ExceptionListener {
+        std::atomic<bool> failed{false};
+        void onException(const cms::CMSException&) override { failed = true; }
+    };
+
+    // Sólo deja `connection` asignada si quedó iniciada
+    void Connect() {
+        auto listener = std::make_shared<FailureListener>();
+        std::shared_ptr<cms::Connection> fresh(factory->createConnection(),
+                                               [listener](cms::Connection* c) { delete c; });
+        fresh->setExceptionListener(listener.get());
+        fresh->start();
+        connection = std::move(fresh);
+        failure = std::move(listener);
+        ++generation;
+    }
+
+    // false => el broker sigue sin responder; el próximo uso vuelve a intentar
+    bool TryConnect() {
+        try {
+            Connect();
+            return true;
+        } catch (const cms::CMSException&) {
+            return false;
+        }
+    }
+
+    mutable std::mutex mutex;
+    std::unique_ptr<cms::ConnectionFactory> factory;
     std::shared_ptr<cms::Connection> connection;
+    std::shared_ptr<FailureListener> failure; // de `connection`
+    std::uint64_t generation = 0;
 };
 
-#endif //SERVICES_CONNECTION_MANAGER_HPP
\ No newline at end of file
+#endif //SERVICES_CONNECTION_MANAGER_HPP
@@ -0,0 +1,105 @@
+#ifndef COMMON_DEAD_LETTER_SENDER_HPP
+#define COMMON_DEAD_LETTER_SENDER_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <cms/BytesMessage.h>
+#include <cms/CMSException.h>
+#include <cms/Message.h>
+#include <cms/MessageProducer.h>
+#include <cms/Queue.h>
+#include <cms/Session.h>
+#include <cms/TextMessage.h>
+
+#include "ConnectionManager.hpp"
+
+// Mensajes que el consumer no pudo procesar (agotó reintentos, error
+// permanente o cuerpo ilegible) van a "<prefijo><cola original>" en vez de
+// perderse. Se copian tal cual, cuerpo y propiedades (contentType, eventId...),
+// para poder reinyectarlos en la cola original; el motivo viaja en las
+// propiedades dlq*.
+class DeadLetterSender {
+    std::shared_ptr<ConnectionManager> connectionManager;
+    std::string prefix;
+    std::mutex mutex;  // cms::Session no es thread-safe
+    std::shared_ptr<cms::Session> session;
+    std::unique_ptr<cms::MessageProducer> producer; // sin destino fijo
+    std::unordered_map<std::string, std::unique_ptr<cms::Queue>> queues;
+
+public:
+    static constexpr const char* OriginalQueueProperty = "dlqOriginalQueue";
+    static constexpr const char* ReasonProperty = "dlqReason";
+    static constexpr const char* AttemptsProperty = "dlqAttempts";
+    static constexpr const char* FailedAtProperty = "dlqFailedAt"; // epoch ms
+
+    struct Failure {
+        std::string reason;
+        int attempts = 1;
+    };
+
+    DeadLetterSender(std::shared_ptr<ConnectionManager> connectionManager, std::string prefix)
+        : connectionManager(std::move(connectionManager)), prefix(std::move(prefix)) {}
+
+    [[nodiscard]] std::string QueueFor(const std::string& originalQueue) const { return prefix + originalQueue; }
+
+    // Lanza cms::CMSException si no se pudo enviar: el original no debe
+    // confirmarse en ese caso
+    void Send(const std::string& originalQueue, const cms::Message& original, const Failure& failure) {
+        std::lock_guard lock(mutex);
+        try {
+            if (!producer) {
+                session = connectionManager->CreateSession();
+                producer.reset(session->createProducer(nullptr));
+                producer->setDeliveryMode(cms::DeliveryMode::PERSISTENT);
+                queues.clear();
+            }
+            auto& queue = queues[originalQueue];
+            if (!queue) queue.reset(session->createQueue(QueueFor(originalQueue)));
+
+            const auto copy = Copy(original);
+            copy->setStringProperty(OriginalQueueProperty, originalQueue);
+            copy->setStringProperty(ReasonProperty, failure.reason);
+            copy->setIntProperty(AttemptsProperty, failure.attempts);
+            copy->setLongProperty(FailedAtProperty, std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+            producer->send(queue.get(), copy.get());
+        } catch (const cms::CMSException&) {
+            // La sesión puede haber quedado inservible (reconexión): se rearma en el próximo envío
+            queues.clear();
+            producer.reset();
+            session.reset();
+            throw;
+        }
+    }
+
+private:
+    std::unique_ptr<cms::Message> Copy(const cms::Message& original) const {
+        std::unique_ptr<cms::Message> copy;
+        if (const auto* text = dynamic_cast<const cms::TextMessage*>(&original)) {
+            copy.reset(session->createTextMessage(text->getText()));
+        } else if (const auto* bytes = dynamic_cast<const cms::BytesMessage*>(&original)) {
+            const int length = bytes->getBodyLength();
+            const std::unique_ptr<unsigned char[]> body(length > 0 ? bytes->getBodyBytes() : nullptr);
+            copy.reset(session->createBytesMessage(body.get(), length));
+        } else {
+            copy.reset(session->createMessage());
+        }
+
+        for (const auto& name : original.getPropertyNames()) {
+            if (name.starts_with("JMS")) continue; // las pone el broker
+            switch (original.getPropertyValueType(name)) {
+                case cms::Message::STRING_TYPE:  copy->setStringProperty(name, original.getStringProperty(name)); break;
+                case cms::Message::INTEGER_TYPE: copy->setIntProperty(name, original.getIntProperty(name)); break;
+                case cms::Message::LONG_TYPE:    copy->setLongProperty(name, original.getLongProperty(name)); break;
+                case cms::Message::BOOLEAN_TYPE: copy->setBooleanProperty(name, original.getBooleanProperty(name)); break;
+                default: break; // los eventos sólo usan los de arriba
+            }
+        }
+        return copy;
+    }
+};
+
+#endif // COMMON_DEAD_LETTER_SENDER_HPP
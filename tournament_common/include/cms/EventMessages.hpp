@@ -0,0 +1,119 @@
+#ifndef COMMON_CMS_EVENT_MESSAGES_HPP
+#define COMMON_CMS_EVENT_MESSAGES_HPP
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <cms/BytesMessage.h>
+#include <cms/CMSException.h>
+#include <cms/Message.h>
+#include <cms/Session.h>
+#include <cms/TextMessage.h>
+#include <nlohmann/json.hpp>
+
+#include "messaging/EventCodec.hpp"
+
+// Envoltura de un evento de dominio en un mensaje del broker (ver
+// messaging/EventCodec.hpp): JSON => TextMessage, MessagePack => BytesMessage,
+// y en ambos casos contentType + schemaVersion como propiedades.
+namespace messaging {
+
+    // Id del evento para deduplicar en el consumer (ver EventIdOf)
+    inline constexpr const char* EventIdProperty = "eventId";
+
+    // `body` ya codificado con `encoding`
+    inline std::unique_ptr<cms::Message> CreateEventMessage(cms::Session& session,
+                                                            const std::string& body,
+                                                            EventEncoding encoding,
+                                                            const std::string& eventId = {}) {
+        std::unique_ptr<cms::Message> message;
+        if (encoding == EventEncoding::Json) {
+            message.reset(session.createTextMessage(body));
+        } else {
+            message.reset(session.createBytesMessage(reinterpret_cast<const unsigned char*>(body.data()),
+                                                     static_cast<int>(body.size())));
+        }
+        message->setStringProperty(ContentTypeProperty, std::string(ContentType(encoding)));
+        message->setIntProperty(SchemaVersionProperty, EventSchemaVersion);
+        if (!eventId.empty()) {
+            message->setStringProperty(EventIdProperty, eventId);
+        }
+        return message;
+    }
+
+    // El eventId del productor si lo puso (sobrevive a reenvíos del outbox);
+    // si no, el JMSMessageID, que el broker mantiene en sus reentregas
+    inline std::string EventIdOf(const cms::Message& message) {
+        if (message.propertyExists(EventIdProperty)) {
+            return message.getStringProperty(EventIdProperty);
+        }
+        return message.getCMSMessageID();
+    }
+
+    enum class DecodeFailure {
+        UnsupportedContentType,
+        UnsupportedSchemaVersion,
+        Malformed
+    };
+
+    inline std::string_view ToString(DecodeFailure failure) {
+        switch (failure) {
+            case DecodeFailure::UnsupportedContentType:  return "unsupported content type";
+            case DecodeFailure::UnsupportedSchemaVersion: return "unsupported schema version";
+            case DecodeFailure::Malformed:                return "malformed body";
+        }
+        return "unknown";
+    }
+
+    namespace detail {
+        inline std::expected<nlohmann::json, DecodeFailure> DecodeBody(const cms::Message& message) {
+            if (const auto* text = dynamic_cast<const cms::TextMessage*>(&message)) {
+                return nlohmann::json::parse(text->getText());
+            }
+
+            const auto* bytes = dynamic_cast<const cms::BytesMessage*>(&message);
+            if (bytes == nullptr || !message.propertyExists(ContentTypeProperty) ||
+                message.getPropertyValueType(ContentTypeProperty) != cms::Message::STRING_TYPE) {
+                return std::unexpected(DecodeFailure::UnsupportedContentType);
+            }
+            const auto encoding = EncodingForContentType(message.getStringProperty(ContentTypeProperty));
+            if (!encoding) {
+                return std::unexpected(DecodeFailure::UnsupportedContentType);
+            }
+
+            const int length = bytes->getBodyLength();
+            const std::unique_ptr<unsigned char[]> body(length > 0 ? bytes->getBodyBytes() : nullptr);
+            return DecodeEvent(
+                std::string_view(reinterpret_cast<const char*>(body.get()), static_cast<std::size_t>(length)),
+                *encoding);
+        }
+    }
+
+    // Acepta también los TextMessage sin propiedades de productores anteriores.
+    // Todo evento es un objeto json; cualquier otra cosa cuenta como Malformed.
+    inline std::expected<nlohmann::json, DecodeFailure> DecodeEventMessage(const cms::Message& message) {
+        // Un schemaVersion que no es entero (otro productor, texto "2") no es
+        // una falla del broker: lanzar CMSException haría reconectar al
+        // receptor en bucle con el mismo mensaje
+        try {
+            if (message.propertyExists(SchemaVersionProperty) &&
+                message.getIntProperty(SchemaVersionProperty) > EventSchemaVersion) {
+                return std::unexpected(DecodeFailure::UnsupportedSchemaVersion);
+            }
+        } catch (const cms::CMSException&) {
+            return std::unexpected(DecodeFailure::UnsupportedSchemaVersion);
+        }
+        try {
+            auto event = detail::DecodeBody(message);
+            if (event && !event->is_object()) {
+                return std::unexpected(DecodeFailure::Malformed);
+            }
+            return event;
+        } catch (const nlohmann::json::exception&) {
+            return std::unexpected(DecodeFailure::Malformed);
+        }
+    }
+}
+
+#endif // COMMON_CMS_EVENT_MESSAGES_HPP
@@ -0,0 +1,14 @@
+#ifndef COMMON_ILIVE_EVENT_PUBLISHER_HPP
+#define COMMON_ILIVE_EVENT_PUBLISHER_HPP
+
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+// Eventos para los clientes conectados a GET /tournaments/<id>/events
+class ILiveEventPublisher {
+public:
+    virtual ~ILiveEventPublisher() = default;
+    virtual void Publish(std::string_view tournamentId, std::string_view type, const nlohmann::json& data) = 0;
+};
+
+#endif // COMMON_ILIVE_EVENT_PUBLISHER_HPP
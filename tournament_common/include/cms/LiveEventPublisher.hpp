@@ -0,0 +1,193 @@
+#ifndef COMMON_LIVE_EVENT_PUBLISHER_HPP
+#define COMMON_LIVE_EVENT_PUBLISHER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <cms/CMSException.h>
+#include <cms/MessageProducer.h>
+#include <cms/Session.h>
+#include <cms/TextMessage.h>
+#include <cms/Topic.h>
+
+#include "ConnectionManager.hpp"
+#include "ILiveEventPublisher.hpp"
+#include "messaging/BoundedRing.hpp"
+
+// Publica en un topic (no una cola): cada nodo de tournament_services tiene
+// su propio suscriptor y reenvía a los websockets que tenga abiertos. El
+// cuerpo ya es el frame final {"type","data"}, así que cada nodo lo envía sin
+// volver a serializar; tournamentId viaja como propiedad para no parsearlo.
+//
+// Publish no espera al broker: arma el frame, lo deja en un anillo acotado y
+// vuelve. Un hilo propio lo envía. Con el broker caído o lento el anillo se
+// llena y se descarta el más viejo; un evento en vivo perdido lo corrige el
+// siguiente GET. Un error del broker cierra sesión y productor, pide
+// reconexión y espera un poco antes de seguir con el próximo frame.
+class LiveEventPublisher : public ILiveEventPublisher {
+    struct Frame {
+        std::string tournamentId;
+        std::string body;
+    };
+
+    static constexpr std::size_t kCapacity = 1024;
+    static constexpr std::chrono::milliseconds kRetryDelay{1000};
+
+    std::shared_ptr<ConnectionManager> connectionManager;
+    messaging::BoundedRing<Frame> ring{kCapacity};
+
+    // Sólo los usa el hilo de envío: sin candado
+    std::shared_ptr<cms::Connection> connection; // la sesión no debe sobrevivir a su conexión
+    std::uint64_t generation = 0;
+    std::unique_ptr<cms::Session> session;
+    std::unique_ptr<cms::Topic> topic;
+    std::unique_ptr<cms::MessageProducer> producer;
+
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> idle{false};
+    std::atomic<std::uint32_t> wakeups{0};
+    std::atomic<std::uint64_t> published{0};
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<std::uint64_t> failed{0};
+    std::thread sender;
+
+public:
+    static constexpr const char* Topic = "tournament.live";
+    static constexpr const char* TournamentIdProperty = "tournamentId";
+
+    struct Stats {
+        std::uint64_t published = 0;
+        std::uint64_t dropped = 0; // anillo lleno
+        std::uint64_t failed = 0;  // el broker rechazó el envío
+        std::size_t queued = 0;
+    };
+
+    explicit LiveEventPublisher(const std::shared_ptr<ConnectionManager>& connectionManager)
+        : connectionManager(connectionManager) {
+        sender = std::thread([this] { SendLoop(); });
+    }
+
+    // Lo que siga en el anillo se descarta
+    ~LiveEventPublisher() override {
+        stopping.store(true);
+        wakeups.fetch_add(1);
+        wakeups.notify_one();
+        if (sender.joinable()) sender.join();
+        Reset();
+    }
+
+    LiveEventPublisher(const LiveEventPublisher&) = delete;
+    LiveEventPublisher& operator=(const LiveEventPublisher&) = delete;
+
+    void Publish(std::string_view tournamentId, std::string_view type, const nlohmann::json& data) override {
+        Frame frame{std::string(tournamentId), nlohmann::json{{"type", type}, {"data", data}}.dump()};
+        while (!ring.TryPush(frame)) {
+            if (ring.TryPop()) dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        // Pareja del fence en SendLoop (ver AsyncEventBus::Enqueue)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (idle.load(std::memory_order_relaxed)) {
+            wakeups.fetch_add(1, std::memory_order_relaxed);
+            wakeups.notify_one();
+        }
+    }
+
+    [[nodiscard]] Stats GetStats() const {
+        return {published.load(std::memory_order_relaxed), dropped.load(std::memory_order_relaxed),
+                failed.load(std::memory_order_relaxed), ring.Size()};
+    }
+
+    // Formato de texto de Prometheus, para anexar a GET /metrics
+    void RenderMetrics(std::string& out) const {
+        const auto current = GetStats();
+        out += "# HELP tournament_live_events_published_total Live frames sent to the tournament.live topic.\n"
+               "# TYPE tournament_live_events_published_total counter\n"
+               "tournament_live_events_published_total ";
+        out += std::to_string(current.published);
+        out += "\n# HELP tournament_live_events_lost_total Live frames never sent, by reason.\n"
+               "# TYPE tournament_live_events_lost_total counter\n"
+               "tournament_live_events_lost_total{reason=\"dropped\"} ";
+        out += std::to_string(current.dropped);
+        out += "\ntournament_live_events_lost_total{reason=\"send_failed\"} ";
+        out += std::to_string(current.failed);
+        out += "\n# HELP tournament_live_events_queued Live frames waiting to be sent.\n"
+               "# TYPE tournament_live_events_queued gauge\n"
+               "tournament_live_events_queued ";
+        out += std::to_string(current.queued);
+        out += '\n';
+    }
+
+private:
+    void SendLoop() {
+        while (!stopping.load()) {
+            if (auto frame = ring.TryPop()) {
+                if (!Send(*frame)) Pause();
+                continue;
+            }
+
+            const auto seen = wakeups.load();
+            idle.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (ring.Empty() && !stopping.load()) {
+                wakeups.wait(seen);
+            }
+            idle.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // false => el broker falló; el frame se pierde
+    bool Send(const Frame& frame) {
+        try {
+            if (!producer) Open();
+            const auto message = std::unique_ptr<cms::TextMessage>(session->createTextMessage(frame.body));
+            message->setStringProperty(TournamentIdProperty, frame.tournamentId);
+            producer->send(message.get());
+            published.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        } catch (const cms::CMSException& e) {
+            failed.fetch_add(1, std::memory_order_relaxed);
+            std::cerr << "LiveEventPublisher: live event not published: " << e.what() << std::endl;
+            Reset();
+            connectionManager->ReconnectIfFailed(generation);
+            return false;
+        }
+    }
+
+    void Open() {
+        auto [current, currentGeneration] = connectionManager->CurrentConnection();
+        connection = std::move(current);
+        generation = currentGeneration;
+        session.reset(connection->createSession(cms::Session::AUTO_ACKNOWLEDGE));
+        topic.reset(session->createTopic(Topic));
+        producer.reset(session->createProducer(topic.get()));
+        producer->setDeliveryMode(cms::DeliveryMode::NON_PERSISTENT);
+    }
+
+    void Reset() {
+        try {
+            if (producer) producer->close();
+            if (session) session->close();
+        } catch (const cms::CMSException&) {
+            // conexión caída: no hay nada que cerrar del lado del broker
+        }
+        producer.reset();
+        topic.reset();
+        session.reset();
+        connection.reset();
+    }
+
+    // Tras un fallo no se martilla al broker; el destructor no espera la pausa entera
+    void Pause() {
+        const auto until = std::chrono::steady_clock::now() + kRetryDelay;
+        while (!stopping.load() && std::chrono::steady_clock::now() < until) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    }
+};
+
+#endif // COMMON_LIVE_EVENT_PUBLISHER_HPP
@@ -0,0 +1,539 @@
+#ifndef COMMON_CMS_TESTING_FAKE_BROKER_HPP
+#define COMMON_CMS_TESTING_FAKE_BROKER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <cms/CMSException.h>
+#include <cms/Connection.h>
+#include <cms/ConnectionFactory.h>
+#include <cms/ExceptionListener.h>
+#include <cms/MessageConsumer.h>
+#include <cms/MessageProducer.h>
+#include <cms/Queue.h>
+#include <cms/Session.h>
+#include <cms/TextMessage.h>
+
+// Sólo para tests: un broker CMS en memoria detrás de cms::ConnectionFactory
+// (ConnectionManager::initialize). Sólo mensajes de texto y colas; lo demás
+// lanza CMSException. Lo entregado y sin confirmar vuelve a la cola al
+// cerrar la sesión. Las fallas se provocan desde el test: DropConnections
+// hace lo que una caída del transporte (avisa al ExceptionListener y todo lo
+// que use esas conexiones lanza), FailNextSends hace fallar envíos sueltos.
+namespace fakecms {
+
+    using Property = std::variant<std::string, int, long long, bool>;
+
+    struct SentMessage {
+        std::string queue;
+        std::string text;
+        std::map<std::string, Property> properties;
+    };
+
+    class Broker;
+
+    // Lo que comparten una conexión y todo lo que se creó a partir de ella
+    struct ConnectionState {
+        std::shared_ptr<Broker> broker;
+        cms::ExceptionListener* listener = nullptr;
+        bool failed = false;
+        bool closed = false;
+    };
+
+    struct SessionState {
+        std::shared_ptr<ConnectionState> connection;
+        bool closed = false;
+        // Entregados y sin ack (cola, copia): vuelven a su cola al cerrar la sesión
+        std::vector<std::pair<std::string, std::unique_ptr<cms::Message>>> unacked;
+    };
+
+    class Broker : public std::enable_shared_from_this<Broker> {
+    public:
+        // Guarda recursiva: los objetos falsos la toman y a veces se llaman entre sí
+        mutable std::recursive_mutex mutex;
+
+        // Deja un mensaje en la cola para el próximo receive
+        void Push(const std::string& queue, const std::string& messageId, const std::string& text,
+                  std::map<std::string, Property> properties = {});
+
+        // Caída del transporte en todas las conexiones vivas
+        void DropConnections();
+
+        void FailNextSends(int count) {
+            std::lock_guard lock(mutex);
+            failSends = count;
+        }
+        void RefuseConnections(bool refuse) {
+            std::lock_guard lock(mutex);
+            refuseConnections = refuse;
+        }
+
+        [[nodiscard]] std::vector<SentMessage> Sent() const {
+            std::lock_guard lock(mutex);
+            return sent;
+        }
+        [[nodiscard]] std::vector<std::string> Acked() const {
+            std::lock_guard lock(mutex);
+            return acked;
+        }
+        [[nodiscard]] std::size_t Waiting(const std::string& queue) const {
+            std::lock_guard lock(mutex);
+            const auto it = queues.find(queue);
+            return it == queues.end() ? 0 : it->second.size();
+        }
+        [[nodiscard]] int ConnectionsCreated() const {
+            std::lock_guard lock(mutex);
+            return connectionsCreated;
+        }
+        [[nodiscard]] int SessionsCreated() const {
+            std::lock_guard lock(mutex);
+            return sessionsCreated;
+        }
+        [[nodiscard]] int SessionsClosed() const {
+            std::lock_guard lock(mutex);
+            return sessionsClosed;
+        }
+        // Devueltos a la cola al cerrarse, sin ack, la sesión que los entregó
+        [[nodiscard]] int Redelivered() const {
+            std::lock_guard lock(mutex);
+            return redelivered;
+        }
+        // acknowledge() sobre una sesión ya cerrada: el cliente real lo haría
+        // contra un consumidor liberado
+        [[nodiscard]] int AcksAfterClose() const {
+            std::lock_guard lock(mutex);
+            return acksAfterClose;
+        }
+
+    private:
+        friend class FakeConnectionFactory;
+        friend class FakeConnection;
+        friend class FakeSession;
+        friend class FakeProducer;
+        friend class FakeConsumer;
+        friend class FakeTextMessage;
+
+        std::map<std::string, std::deque<std::unique_ptr<cms::Message>>> queues;
+        std::vector<std::weak_ptr<ConnectionState>> connections;
+        std::vector<SentMessage> sent;
+        std::vector<std::string> acked;
+        int failSends = 0;
+        bool refuseConnections = false;
+        int connectionsCreated = 0;
+        int sessionsCreated = 0;
+        int sessionsClosed = 0;
+        int acksAfterClose = 0;
+        int redelivered = 0;
+    };
+
+    inline cms::CMSException Failure(const std::string& what) {
+        return cms::CMSException("fake broker: " + what);
+    }
+
+    class FakeQueue : public cms::Queue {
+        std::string name;
+
+    public:
+        explicit FakeQueue(std::string name) : name(std::move(name)) {}
+
+        std::string getQueueName() const override { return name; }
+        DestinationType getDestinationType() const override { return QUEUE; }
+        cms::Destination* clone() const override { return new FakeQueue(name); }
+        void copy(const cms::Destination& source) override {
+            name = dynamic_cast<const cms::Queue&>(source).getQueueName();
+        }
+        bool equals(const cms::Destination& other) const override {
+            const auto* queue = dynamic_cast<const cms::Queue*>(&other);
+            return queue != nullptr && queue->getQueueName() == name;
+        }
+        const cms::CMSProperties& getCMSProperties() const override { throw Failure("no destination options"); }
+    };
+
+    class FakeTextMessage : public cms::TextMessage {
+        std::string text;
+        std::map<std::string, Property> properties;
+        std::string messageId;
+        long long timestamp = 0;
+        // De la sesión que lo entregó; vacío si lo creó el test o un productor
+        std::shared_ptr<SessionState> deliveredBy;
+
+        template<typename T>
+        T Get(const std::string& name) const {
+            const auto it = properties.find(name);
+            if (it == properties.end()) throw Failure("property " + name + " not set");
+            if (const auto* value = std::get_if<T>(&it->second)) return *value;
+            throw Failure("property " + name + " has another type");
+        }
+
+    public:
+        explicit FakeTextMessage(std::string text = {}, std::map<std::string, Property> properties = {},
+                                 std::string messageId = {})
+            : text(std::move(text)), properties(std::move(properties)), messageId(std::move(messageId)) {}
+
+        void DeliveredBy(std::shared_ptr<SessionState> session) { deliveredBy = std::move(session); }
+        [[nodiscard]] const std::map<std::string, Property>& Properties() const { return properties; }
+
+        cms::Message* clone() const override { return new FakeTextMessage(*this); }
+
+        void acknowledge() const override {
+            if (!deliveredBy) return;
+            auto& broker = *deliveredBy->connection->broker;
+            std::lock_guard lock(broker.mutex);
+            if (deliveredBy->closed) {
+                ++broker.acksAfterClose;
+                throw Failure("session closed");
+            }
+            if (deliveredBy->connection->failed) throw Failure("transport failed");
+            broker.acked.push_back(messageId);
+            std::erase_if(deliveredBy->unacked, [this](const auto& entry) {
+                return entry.second->getCMSMessageID() == messageId;
+            });
+        }
+
+        void clearBody() override { text.clear(); }
+        void clearProperties() override { properties.clear(); }
+
+        std::vector<std::string> getPropertyNames() const override {
+            std::vector<std::string> names;
+            for (const auto& [name, value] : properties) names.push_back(name);
+            return names;
+        }
+        bool propertyExists(const std::string& name) const override { return properties.contains(name); }
+        ValueType getPropertyValueType(const std::string& name) const override {
+            const auto it = properties.find(name);
+            if (it == properties.end()) return NULL_TYPE;
+            switch (it->second.index()) {
+                case 0: return STRING_TYPE;
+                case 1: return INTEGER_TYPE;
+                case 2: return LONG_TYPE;
+                default: return BOOLEAN_TYPE;
+            }
+        }
+
+        bool getBooleanProperty(const std::string& name) const override { return Get<bool>(name); }
+        unsigned char getByteProperty(const std::string& name) const override { throw Failure("byte property " + name); }
+        double getDoubleProperty(const std::string& name) const override { throw Failure("double property " + name); }
+        float getFloatProperty(const std::string& name) const override { throw Failure("float property " + name); }
+        int getIntProperty(const std::string& name) const override { return Get<int>(name); }
+        long long getLongProperty(const std::string& name) const override { return Get<long long>(name); }
+        short getShortProperty(const std::string& name) const override { throw Failure("short property " + name); }
+        std::string getStringProperty(const std::string& name) const override { return Get<std::string>(name); }
+
+        void setBooleanProperty(const std::string& name, bool value) override { properties[name] = value; }
+        void setByteProperty(const std::string&, unsigned char) override { throw Failure("byte property"); }
+        void setDoubleProperty(const std::string&, double) override { throw Failure("double property"); }
+        void setFloatProperty(const std::string&, float) override { throw Failure("float property"); }
+        void setIntProperty(const std::string& name, int value) override { properties[name] = value; }
+        void setLongProperty(const std::string& name, long long value) override { properties[name] = value; }
+        void setShortProperty(const std::string&, short) override { throw Failure("short property"); }
+        void setStringProperty(const std::string& name, const std::string& value) override { properties[name] = value; }
+
+        std::string getCMSCorrelationID() const override { return {}; }
+        void setCMSCorrelationID(const std::string&) override {}
+        int getCMSDeliveryMode() const override { return cms::DeliveryMode::PERSISTENT; }
+        void setCMSDeliveryMode(int) override {}
+        const cms::Destination* getCMSDestination() const override { return nullptr; }
+        void setCMSDestination(const cms::Destination*) override {}
+        long long getCMSExpiration() const override { return 0; }
+        void setCMSExpiration(long long) override {}
+        std::string getCMSMessageID() const override { return messageId; }
+        void setCMSMessageID(const std::string& id) override { messageId = id; }
+        int getCMSPriority() const override { return 4; }
+        void setCMSPriority(int) override {}
+        bool getCMSRedelivered() const override { return false; }
+        void setCMSRedelivered(bool) override {}
+        const cms::Destination* getCMSReplyTo() const override { return nullptr; }
+        void setCMSReplyTo(const cms::Destination*) override {}
+        long long getCMSTimestamp() const override { return timestamp; }
+        void setCMSTimestamp(long long value) override { timestamp = value; }
+        std::string getCMSType() const override { return {}; }
+        void setCMSType(const std::string&) override {}
+
+        std::string getText() const override { return text; }
+        void setText(const char* value) override { text = value; }
+        void setText(const std::string& value) override { text = value; }
+    };
+
+    // Lanza si la sesión o su conexión ya no sirven (con el candado del broker tomado)
+    inline void CheckUsable(const SessionState& session) {
+        if (session.closed) throw Failure("session closed");
+        if (session.connection->failed) throw Failure("transport failed");
+        if (session.connection->closed) throw Failure("connection closed");
+    }
+
+    class FakeProducer : public cms::MessageProducer {
+        std::shared_ptr<SessionState> session;
+        std::string queue; // vacío => sin destino fijo
+        int deliveryMode = cms::DeliveryMode::PERSISTENT;
+
+    public:
+        FakeProducer(std::shared_ptr<SessionState> session, std::string queue)
+            : session(std::move(session)), queue(std::move(queue)) {}
+
+        void close() override {}
+
+        void send(cms::Message* message) override { Send(queue, message); }
+        void send(cms::Message* message, cms::AsyncCallback*) override { Send(queue, message); }
+        void send(cms::Message* message, int, int, long long) override { Send(queue, message); }
+        void send(cms::Message* message, int, int, long long, cms::AsyncCallback*) override { Send(queue, message); }
+        void send(const cms::Destination* destination, cms::Message* message) override { Send(NameOf(destination), message); }
+        void send(const cms::Destination* destination, cms::Message* message, cms::AsyncCallback*) override {
+            Send(NameOf(destination), message);
+        }
+        void send(const cms::Destination* destination, cms::Message* message, int, int, long long) override {
+            Send(NameOf(destination), message);
+        }
+        void send(const cms::Destination* destination, cms::Message* message, int, int, long long,
+                  cms::AsyncCallback*) override {
+            Send(NameOf(destination), message);
+        }
+
+        void setDeliveryMode(int mode) override { deliveryMode = mode; }
+        int getDeliveryMode() const override { return deliveryMode; }
+        void setDisableMessageID(bool) override {}
+        bool getDisableMessageID() const override { return false; }
+        void setDisableMessageTimeStamp(bool) override {}
+        bool getDisableMessageTimeStamp() const override { return false; }
+        void setPriority(int) override {}
+        int getPriority() const override { return 4; }
+        void setTimeToLive(long long) override {}
+        long long getTimeToLive() const override { return 0; }
+        void setMessageTransformer(cms::MessageTransformer*) override {}
+        cms::MessageTransformer* getMessageTransformer() const override { return nullptr; }
+
+    private:
+        static std::string NameOf(const cms::Destination* destination) {
+            const auto* queue = dynamic_cast<const cms::Queue*>(destination);
+            if (queue == nullptr) throw Failure("only queues are supported");
+            return queue->getQueueName();
+        }
+
+        void Send(const std::string& target, cms::Message* message) {
+            auto& broker = *session->connection->broker;
+            std::lock_guard lock(broker.mutex);
+            CheckUsable(*session);
+            if (broker.failSends > 0) {
+                --broker.failSends;
+                throw Failure("send refused");
+            }
+            const auto* text = dynamic_cast<const FakeTextMessage*>(message);
+            if (text == nullptr) throw Failure("only text messages are supported");
+            broker.sent.push_back({target, text->getText(), text->Properties()});
+        }
+    };
+
+    class FakeConsumer : public cms::MessageConsumer {
+        std::shared_ptr<SessionState> session;
+        std::string queue;
+
+    public:
+        FakeConsumer(std::shared_ptr<SessionState> session, std::string queue)
+            : session(std::move(session)), queue(std::move(queue)) {}
+
+        // Un timeout real sólo alargaría los tests: sin mensajes vuelve enseguida
+        cms::Message* receive() override { return receiveNoWait(); }
+        cms::Message* receive(int) override {
+            auto* message = receiveNoWait();
+            if (message == nullptr) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return message;
+        }
+        cms::Message* receiveNoWait() override {
+            auto& broker = *session->connection->broker;
+            std::lock_guard lock(broker.mutex);
+            CheckUsable(*session);
+            auto& waiting = broker.queues[queue];
+            if (waiting.empty()) return nullptr;
+            auto message = std::move(waiting.front());
+            waiting.pop_front();
+            session->unacked.emplace_back(queue, std::unique_ptr<cms::Message>(message->clone()));
+            if (auto* text = dynamic_cast<FakeTextMessage*>(message.get())) text->DeliveredBy(session);
+            return message.release();
+        }
+
+        void close() override {}
+        void start() override {}
+        void stop() override {}
+        void setMessageListener(cms::MessageListener*) override { throw Failure("no listeners"); }
+        cms::MessageListener* getMessageListener() const override { return nullptr; }
+        std::string getMessageSelector() const override { return {}; }
+        void setMessageTransformer(cms::MessageTransformer*) override {}
+        cms::MessageTransformer* getMessageTransformer() const override { return nullptr; }
+        void setMessageAvailableListener(cms::MessageAvailableListener*) override {}
+        cms::MessageAvailableListener* getMessageAvailableListener() const override { return nullptr; }
+    };
+
+    class FakeSession : public cms::Session {
+        std::shared_ptr<SessionState> state;
+        AcknowledgeMode mode;
+
+        cms::CMSException Unsupported() const { return Failure("unsupported session operation"); }
+
+    public:
+        FakeSession(std::shared_ptr<ConnectionState> connection, AcknowledgeMode mode)
+            : state(std::make_shared<SessionState>()), mode(mode) {
+            state->connection = std::move(connection);
+        }
+
+        void close() override {
+            auto& broker = *state->connection->broker;
+            std::lock_guard lock(broker.mutex);
+            if (state->closed) return;
+            state->closed = true;
+            ++broker.sessionsClosed;
+            // Como el broker real: lo entregado sin ack se reentrega, adelante de lo que esperaba
+            for (auto it = state->unacked.rbegin(); it != state->unacked.rend(); ++it) {
+                broker.queues[it->first].push_front(std::move(it->second));
+                ++broker.redelivered;
+            }
+            state->unacked.clear();
+        }
+        void start() override {}
+        void stop() override {}
+        void commit() override { throw Unsupported(); }
+        void rollback() override { throw Unsupported(); }
+        void recover() override { throw Unsupported(); }
+
+        cms::MessageConsumer* createConsumer(const cms::Destination* destination) override {
+            const auto* queue = dynamic_cast<const cms::Queue*>(destination);
+            if (queue == nullptr) throw Failure("only queues are supported");
+            Check();
+            // Las opciones del cliente ("?consumer.prefetchSize=...") no son parte del nombre
+            auto name = queue->getQueueName();
+            name = name.substr(0, name.find('?'));
+            return new FakeConsumer(state, name);
+        }
+        cms::MessageConsumer* createConsumer(const cms::Destination*, const std::string&) override { throw Unsupported(); }
+        cms::MessageConsumer* createConsumer(const cms::Destination*, const std::string&, bool) override { throw Unsupported(); }
+        cms::MessageConsumer* createDurableConsumer(const cms::Topic*, const std::string&, const std::string&, bool) override {
+            throw Unsupported();
+        }
+        cms::MessageProducer* createProducer(const cms::Destination* destination) override {
+            Check();
+            if (destination == nullptr) return new FakeProducer(state, {});
+            const auto* queue = dynamic_cast<const cms::Queue*>(destination);
+            if (queue == nullptr) throw Failure("only queues are supported");
+            return new FakeProducer(state, queue->getQueueName());
+        }
+        cms::QueueBrowser* createBrowser(const cms::Queue*) override { throw Unsupported(); }
+        cms::QueueBrowser* createBrowser(const cms::Queue*, const std::string&) override { throw Unsupported(); }
+        cms::Queue* createQueue(const std::string& queueName) override {
+            Check();
+            return new FakeQueue(queueName);
+        }
+        cms::Topic* createTopic(const std::string&) override { throw Unsupported(); }
+        cms::TemporaryQueue* createTemporaryQueue() override { throw Unsupported(); }
+        cms::TemporaryTopic* createTemporaryTopic() override { throw Unsupported(); }
+        cms::Message* createMessage() override { return new FakeTextMessage(); }
+        cms::BytesMessage* createBytesMessage() override { throw Unsupported(); }
+        cms::BytesMessage* createBytesMessage(const unsigned char*, int) override { throw Unsupported(); }
+        cms::StreamMessage* createStreamMessage() override { throw Unsupported(); }
+        cms::TextMessage* createTextMessage() override { return new FakeTextMessage(); }
+        cms::TextMessage* createTextMessage(const std::string& text) override { return new FakeTextMessage(text); }
+        cms::MapMessage* createMapMessage() override { throw Unsupported(); }
+        AcknowledgeMode getAcknowledgeMode() const override { return mode; }
+        bool isTransacted() const override { return mode == SESSION_TRANSACTED; }
+        void unsubscribe(const std::string&) override { throw Unsupported(); }
+        void setMessageTransformer(cms::MessageTransformer*) override {}
+        cms::MessageTransformer* getMessageTransformer() const override { return nullptr; }
+
+    private:
+        void Check() const {
+            std::lock_guard lock(state->connection->broker->mutex);
+            CheckUsable(*state);
+        }
+    };
+
+    class FakeConnection : public cms::Connection {
+        std::shared_ptr<ConnectionState> state;
+
+    public:
+        explicit FakeConnection(std::shared_ptr<ConnectionState> state) : state(std::move(state)) {}
+
+        void close() override {
+            std::lock_guard lock(state->broker->mutex);
+            state->closed = true;
+        }
+        void start() override {
+            std::lock_guard lock(state->broker->mutex);
+            if (state->failed) throw Failure("transport failed");
+        }
+        void stop() override {}
+        const cms::ConnectionMetaData* getMetaData() const override { return nullptr; }
+        cms::Session* createSession() override { return createSession(cms::Session::AUTO_ACKNOWLEDGE); }
+        cms::Session* createSession(cms::Session::AcknowledgeMode mode) override {
+            auto& broker = *state->broker;
+            std::lock_guard lock(broker.mutex);
+            if (state->failed) throw Failure("transport failed");
+            if (state->closed) throw Failure("connection closed");
+            ++broker.sessionsCreated;
+            return new FakeSession(state, mode);
+        }
+        std::string getClientID() const override { return {}; }
+        void setClientID(const std::string&) override {}
+        cms::ExceptionListener* getExceptionListener() const override { return state->listener; }
+        void setExceptionListener(cms::ExceptionListener* listener) override {
+            std::lock_guard lock(state->broker->mutex);
+            state->listener = listener;
+        }
+        void setMessageTransformer(cms::MessageTransformer*) override {}
+        cms::MessageTransformer* getMessageTransformer() const override { return nullptr; }
+    };
+
+    class FakeConnectionFactory : public cms::ConnectionFactory {
+        std::shared_ptr<Broker> broker;
+
+    public:
+        explicit FakeConnectionFactory(std::shared_ptr<Broker> broker) : broker(std::move(broker)) {}
+
+        cms::Connection* createConnection() override {
+            std::lock_guard lock(broker->mutex);
+            if (broker->refuseConnections) throw Failure("connection refused");
+            auto state = std::make_shared<ConnectionState>();
+            state->broker = broker;
+            broker->connections.push_back(state);
+            ++broker->connectionsCreated;
+            return new FakeConnection(std::move(state));
+        }
+        cms::Connection* createConnection(const std::string&, const std::string&) override { return createConnection(); }
+        cms::Connection* createConnection(const std::string&, const std::string&, const std::string&) override {
+            return createConnection();
+        }
+        void setExceptionListener(cms::ExceptionListener*) override {}
+        cms::ExceptionListener* getExceptionListener() const override { return nullptr; }
+        void setMessageTransformer(cms::MessageTransformer*) override {}
+        cms::MessageTransformer* getMessageTransformer() const override { return nullptr; }
+    };
+
+    inline void Broker::Push(const std::string& queue, const std::string& messageId, const std::string& text,
+                             std::map<std::string, Property> properties) {
+        std::lock_guard lock(mutex);
+        queues[queue].push_back(std::make_unique<FakeTextMessage>(text, std::move(properties), messageId));
+    }
+
+    inline void Broker::DropConnections() {
+        std::vector<std::pair<cms::ExceptionListener*, std::shared_ptr<ConnectionState>>> dropped;
+        {
+            std::lock_guard lock(mutex);
+            for (const auto& weak : connections) {
+                auto state = weak.lock();
+                if (!state || state->failed || state->closed) continue;
+                state->failed = true;
+                dropped.emplace_back(state->listener, state);
+            }
+        }
+        // Como el cliente real: el aviso llega desde otro hilo que el que usa la conexión
+        for (const auto& [listener, state] : dropped) {
+            if (listener != nullptr) listener->onException(Failure("transport failed"));
+        }
+    }
+}
+
+#endif // COMMON_CMS_TESTING_FAKE_BROKER_HPP
@@ -0,0 +1,191 @@
+#ifndef COMMON_CONCURRENCY_TASK_HPP
+#define COMMON_CONCURRENCY_TASK_HPP
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <expected>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace concurrency {
+
+    template<typename T = void>
+    class Task;
+
+    namespace detail {
+        // Quien llegue segundo al intercambio de `ready` reanuda al que espera:
+        // si la tarea terminó dentro de await_suspend (consulta síncrona o ya
+        // resuelta), el que espera sigue sin suspenderse y la pila no crece,
+        // aun sin las llamadas en cola que GCC omite en -O0 y con sanitizers.
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            void await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                auto& promise = handle.promise();
+                if (promise.ready.exchange(true, std::memory_order_acq_rel)) {
+                    promise.continuation.resume();
+                }
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        struct PromiseBase {
+            std::coroutine_handle<> continuation;
+            std::atomic<bool> ready{false};
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+        };
+
+        template<typename T>
+        struct Promise : PromiseBase {
+            std::variant<std::monostate, T, std::exception_ptr> result;
+
+            Task<T> get_return_object() noexcept;
+
+            template<typename Value>
+                requires std::is_convertible_v<Value, T>
+            void return_value(Value&& value) {
+                result.template emplace<1>(std::forward<Value>(value));
+            }
+
+            void unhandled_exception() noexcept {
+                result.template emplace<2>(std::current_exception());
+            }
+
+            T Take() {
+                if (result.index() == 2) {
+                    std::rethrow_exception(std::get<2>(result));
+                }
+                return std::move(std::get<1>(result));
+            }
+        };
+
+        template<>
+        struct Promise<void> : PromiseBase {
+            std::exception_ptr exception;
+
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {}
+
+            void unhandled_exception() noexcept {
+                exception = std::current_exception();
+            }
+
+            void Take() const {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+    }
+
+    // Corrutina perezosa: no corre hasta que alguien hace co_await sobre ella
+    // (o la arranca Spawn). Dueña única de su frame, como un unique_ptr.
+    template<typename T>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = detail::Promise<T>;
+        using value_type = T;
+
+        Task(Task&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (handle) handle.destroy();
+                handle = std::exchange(other.handle, {});
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() {
+            if (handle) handle.destroy();
+        }
+
+        auto operator co_await() && noexcept {
+            struct Awaiter {
+                std::coroutine_handle<promise_type> handle;
+
+                bool await_ready() const noexcept { return !handle || handle.done(); }
+
+                bool await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                    auto& promise = handle.promise();
+                    promise.continuation = awaiting;
+                    handle.resume();
+                    return !promise.ready.exchange(true, std::memory_order_acq_rel);
+                }
+
+                T await_resume() {
+                    return handle.promise().Take();
+                }
+            };
+            return Awaiter{handle};
+        }
+
+    private:
+        friend promise_type;
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    template<typename T>
+    Task<T> detail::Promise<T>::get_return_object() noexcept {
+        return Task<T>{std::coroutine_handle<Promise>::from_promise(*this)};
+    }
+
+    inline Task<void> detail::Promise<void>::get_return_object() noexcept {
+        return Task<void>{std::coroutine_handle<Promise>::from_promise(*this)};
+    }
+
+    namespace detail {
+        // Corrutina "dispara y olvida": arranca de inmediato y libera su frame
+        // al terminar. Solo la usa Spawn para puentear hacia código con callbacks.
+        struct Detached {
+            struct promise_type {
+                Detached get_return_object() const noexcept { return {}; }
+                std::suspend_never initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+
+        template<typename T>
+        using Outcome = std::expected<std::conditional_t<std::is_void_v<T>, std::monostate, T>, std::exception_ptr>;
+
+        template<typename T, typename Callback>
+        Detached RunDetached(Task<T> task, Callback done) {
+            Outcome<T> outcome;
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    co_await std::move(task);
+                    outcome.emplace();
+                } else {
+                    outcome.emplace(co_await std::move(task));
+                }
+            } catch (...) {
+                outcome = std::unexpected(std::current_exception());
+            }
+            done(std::move(outcome));
+        }
+    }
+
+    // Arranca la tarea en el hilo actual; `done` recibe el valor o la excepción
+    // en el hilo donde la tarea termine (p. ej. el del io_context de la base).
+    // Para T = void el valor es std::monostate.
+    template<typename T, typename Callback>
+    void Spawn(Task<T> task, Callback done) {
+        detail::RunDetached(std::move(task), std::move(done));
+    }
+}
+
+#endif // COMMON_CONCURRENCY_TASK_HPP
@@ -45,6 +45,9 @@ struct Match {
     std::optional<int> HomeScore;
     std::optional<int> AwayScore;
 
+    // Columna version de la tabla: sube en cada escritura (concurrencia optimista)
+    int Version { 0 };
+
     Match() = default;
 
     Match(std::string tournamentId,
@@ -0,0 +1,99 @@
+#ifndef COMMON_MESSAGING_BOUNDED_RING_HPP
+#define COMMON_MESSAGING_BOUNDED_RING_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace messaging {
+
+    // Cola circular acotada sin locks (Vyukov): cada celda lleva un número de
+    // secuencia que dice si está libre para el productor de la vuelta actual o
+    // lista para el consumidor. Varios hilos de request empujan; lo normal es
+    // un solo hilo que saca, pero TryPop también es seguro desde productores
+    // (así descarta el más viejo la política drop-oldest).
+    template<typename T>
+    class BoundedRing {
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            T value;
+        };
+
+        static constexpr std::size_t kLine = 64;
+
+        std::size_t mask;
+        std::unique_ptr<Cell[]> cells;
+        alignas(kLine) std::atomic<std::size_t> head{0}; // siguiente a sacar
+        alignas(kLine) std::atomic<std::size_t> tail{0}; // siguiente a escribir
+
+    public:
+        // La capacidad se redondea a potencia de dos (mínimo 2)
+        explicit BoundedRing(std::size_t capacity)
+            : mask(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity) - 1),
+              cells(std::make_unique<Cell[]>(mask + 1)) {
+            for (std::size_t i = 0; i <= mask; ++i) {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BoundedRing(const BoundedRing&) = delete;
+        BoundedRing& operator=(const BoundedRing&) = delete;
+
+        [[nodiscard]] std::size_t Capacity() const noexcept { return mask + 1; }
+
+        // Aproximado: sólo para métricas y para decidir si dormir
+        [[nodiscard]] std::size_t Size() const noexcept {
+            const auto t = tail.load(std::memory_order_acquire);
+            const auto h = head.load(std::memory_order_acquire);
+            return t > h ? t - h : 0;
+        }
+
+        [[nodiscard]] bool Empty() const noexcept { return Size() == 0; }
+
+        // false => llena; `value` no se mueve
+        bool TryPush(T& value) {
+            auto position = tail.load(std::memory_order_relaxed);
+            while (true) {
+                Cell& cell = cells[position & mask];
+                const auto sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+                if (diff == 0) {
+                    if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        cell.value = std::move(value);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    position = tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::optional<T> TryPop() {
+            auto position = head.load(std::memory_order_relaxed);
+            while (true) {
+                Cell& cell = cells[position & mask];
+                const auto sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+                if (diff == 0) {
+                    if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        std::optional<T> value(std::move(cell.value));
+                        cell.sequence.store(position + mask + 1, std::memory_order_release);
+                        return value;
+                    }
+                } else if (diff < 0) {
+                    return std::nullopt;
+                } else {
+                    position = head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+}
+
+#endif // COMMON_MESSAGING_BOUNDED_RING_HPP
@@ -0,0 +1,61 @@
+#ifndef COMMON_MESSAGING_DOMAIN_EVENTS_HPP
+#define COMMON_MESSAGING_DOMAIN_EVENTS_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+
+// Cuerpos de los eventos de dominio. Los arman tanto los delegates (eventos
+// en vivo) como los repositorios (outbox), así el consumer recibe lo mismo
+// por cualquiera de los dos caminos.
+namespace payloads {
+
+    inline nlohmann::json GroupCreated(std::string_view tournamentId, std::string_view groupId, std::string_view name) {
+        return {
+            {"tournamentId", std::string(tournamentId)},
+            {"groupId", std::string(groupId)},
+            {"name", std::string(name)}
+        };
+    }
+
+    inline nlohmann::json GroupTeamAdded(std::string_view tournamentId, std::string_view groupId, const domain::Team& team) {
+        return {
+            {"tournamentId", std::string(tournamentId)},
+            {"groupId", std::string(groupId)},
+            {"team", {{"id", team.Id}, {"name", team.Name}}}
+        };
+    }
+
+    inline nlohmann::json GroupTeamsAdded(std::string_view tournamentId, std::string_view groupId,
+                                          const std::vector<domain::Team>& teams) {
+        nlohmann::json added = nlohmann::json::array();
+        for (const auto& team : teams) {
+            added.push_back({{"id", team.Id}, {"name", team.Name}});
+        }
+        return {
+            {"tournamentId", std::string(tournamentId)},
+            {"groupId", std::string(groupId)},
+            {"teams", std::move(added)}
+        };
+    }
+
+    inline nlohmann::json MatchScoreUpdated(std::string_view tournamentId, std::string_view matchId,
+                                            const domain::Match& match, int homeScore, int awayScore) {
+        return {
+            {"event", "match_score_updated"},
+            {"tournamentId", std::string(tournamentId)},
+            {"matchId", std::string(matchId)},
+            {"groupId", match.GroupId},
+            {"homeTeamId", match.HomeTeamId},
+            {"awayTeamId", match.AwayTeamId},
+            {"homeScore", homeScore},
+            {"awayScore", awayScore}
+        };
+    }
+}
+
+#endif // COMMON_MESSAGING_DOMAIN_EVENTS_HPP
@@ -0,0 +1,73 @@
+#ifndef COMMON_MESSAGING_EVENT_CODEC_HPP
+#define COMMON_MESSAGING_EVENT_CODEC_HPP
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+// Formato de los eventos en las colas "tournament.*". El cuerpo puede ir como
+// JSON (TextMessage, lo que se mandaba antes) o MessagePack (BytesMessage);
+// cada mensaje lleva en propiedades su content type y la versión del esquema,
+// así productores y consumers se actualizan por separado: primero se
+// despliegan consumers que entienden ambos y luego se cambia el productor.
+namespace messaging {
+
+    enum class EventEncoding {
+        Json,
+        MessagePack
+    };
+
+    // Versión del contenido de los payloads (messaging/DomainEvents.hpp). Se
+    // sube sólo con cambios incompatibles; agregar campos no la cambia.
+    inline constexpr int EventSchemaVersion = 1;
+
+    inline constexpr const char* ContentTypeProperty = "contentType";
+    inline constexpr const char* SchemaVersionProperty = "schemaVersion";
+
+    inline constexpr std::string_view JsonContentType = "application/json";
+    inline constexpr std::string_view MessagePackContentType = "application/msgpack";
+
+    inline std::string_view ContentType(EventEncoding encoding) {
+        return encoding == EventEncoding::MessagePack ? MessagePackContentType : JsonContentType;
+    }
+
+    inline std::optional<EventEncoding> EncodingForContentType(std::string_view contentType) {
+        if (contentType == JsonContentType) return EventEncoding::Json;
+        if (contentType == MessagePackContentType) return EventEncoding::MessagePack;
+        return std::nullopt;
+    }
+
+    // Nombre en configuration.json: "json" (default) o "msgpack"
+    inline EventEncoding ParseEventEncoding(std::string_view name) {
+        return name == "msgpack" ? EventEncoding::MessagePack : EventEncoding::Json;
+    }
+
+    // Bytes del cuerpo; para MessagePack el std::string es sólo el contenedor
+    inline std::string EncodeEvent(const nlohmann::json& payload, EventEncoding encoding) {
+        if (encoding == EventEncoding::Json) {
+            return payload.dump();
+        }
+        std::string body;
+        nlohmann::json::to_msgpack(payload, body);
+        return body;
+    }
+
+    // Lanza nlohmann::json::exception si el cuerpo no es válido
+    inline nlohmann::json DecodeEvent(std::string_view body, EventEncoding encoding) {
+        if (encoding == EventEncoding::Json) {
+            return nlohmann::json::parse(body);
+        }
+        return nlohmann::json::from_msgpack(body.begin(), body.end());
+    }
+
+    // Re-codifica un cuerpo que ya viene en JSON (filas del outbox)
+    inline std::string TranscodeJsonEvent(std::string_view json, EventEncoding encoding) {
+        if (encoding == EventEncoding::Json) {
+            return std::string(json);
+        }
+        return EncodeEvent(nlohmann::json::parse(json), encoding);
+    }
+}
+
+#endif // COMMON_MESSAGING_EVENT_CODEC_HPP
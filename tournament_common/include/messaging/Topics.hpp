@@ -0,0 +1,8 @@
+#pragma once
+namespace topics {
+    inline constexpr const char* GroupCreated   = "group.created";
+    inline constexpr const char* GroupTeamAdded = "group.team_added";
+    // Un evento por lote de UpdateTeams: {"tournamentId","groupId","teams":[{"id","name"}...]}
+    inline constexpr const char* GroupTeamsAdded = "group.teams_added";
+    inline constexpr const char* MatchScoreUpdated = "match.score_updated";
+}
@@ -0,0 +1,72 @@
+#ifndef COMMON_METRICS_LATENCY_HISTOGRAM_HPP
+#define COMMON_METRICS_LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace metrics {
+
+    // Histograma log-lineal al estilo HDR, en microsegundos: 8 sub-buckets por
+    // cada potencia de dos (error relativo ≤ 12.5%) hasta 2^28 µs (~4.5 min).
+    // Lo que pase de ahí cae en el último bucket.
+    inline constexpr int kSubBucketBits = 3;
+    inline constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    inline constexpr int kMaxExponent = 27;
+    inline constexpr std::size_t kBucketCount = kSubBuckets * (kMaxExponent - kSubBucketBits + 2);
+
+    constexpr std::size_t BucketIndex(std::uint64_t micros) {
+        if (micros < kSubBuckets) {
+            return static_cast<std::size_t>(micros);
+        }
+        const int exponent = std::bit_width(micros) - 1;
+        if (exponent > kMaxExponent) {
+            return kBucketCount - 1;
+        }
+        const int shift = exponent - kSubBucketBits;
+        const auto sub = static_cast<std::size_t>((micros >> shift) & (kSubBuckets - 1));
+        return kSubBuckets + static_cast<std::size_t>(shift) * kSubBuckets + sub;
+    }
+
+    // Límite superior (exclusivo) del bucket, en microsegundos
+    constexpr std::uint64_t BucketUpperBound(std::size_t index) {
+        if (index < kSubBuckets) {
+            return index + 1;
+        }
+        const auto shift = (index - kSubBuckets) / kSubBuckets;
+        const auto sub = (index - kSubBuckets) % kSubBuckets;
+        return (kSubBuckets + sub + 1) << shift;
+    }
+
+    // Suma de los histogramas de todos los hilos para una ruta
+    struct HistogramSnapshot {
+        std::array<std::uint64_t, kBucketCount> counts{};
+        std::uint64_t total = 0;
+        std::uint64_t sumMicros = 0;
+
+        // Cota superior del bucket donde cae el cuantil q (0..1)
+        [[nodiscard]] std::uint64_t QuantileMicros(double q) const {
+            if (total == 0) return 0;
+            const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(total - 1)) + 1;
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < kBucketCount; ++i) {
+                seen += counts[i];
+                if (seen >= rank) return BucketUpperBound(i);
+            }
+            return BucketUpperBound(kBucketCount - 1);
+        }
+
+        // Observaciones con cota superior ≤ micros (los "le" de Prometheus).
+        // Un bucket que cruza el límite no se cuenta: subestima, nunca infla.
+        [[nodiscard]] std::uint64_t CountAtOrBelow(std::uint64_t micros) const {
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < kBucketCount && BucketUpperBound(i) <= micros; ++i) {
+                seen += counts[i];
+            }
+            return seen;
+        }
+    };
+}
+
+#endif // COMMON_METRICS_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,67 @@
+#ifndef COMMON_METRICS_PROMETHEUS_TEXT_HPP
+#define COMMON_METRICS_PROMETHEUS_TEXT_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "metrics/LatencyHistogram.hpp"
+
+// Piezas del formato de texto de Prometheus (text/plain; version=0.0.4) que
+// comparten GET /metrics de tournament_services y el de tournament_consumer.
+namespace metrics {
+
+    // Límites "le" en segundos, como los de client_golang
+    inline constexpr std::array<std::pair<const char*, std::uint64_t>, 11> kLatencyBuckets{{
+        {"0.001", 1'000}, {"0.0025", 2'500}, {"0.005", 5'000}, {"0.01", 10'000},
+        {"0.025", 25'000}, {"0.05", 50'000}, {"0.1", 100'000}, {"0.25", 250'000},
+        {"0.5", 500'000}, {"1", 1'000'000}, {"2.5", 2'500'000},
+    }};
+
+    inline std::string Seconds(std::uint64_t micros) {
+        char buffer[32];
+        const int n = std::snprintf(buffer, sizeof(buffer), "%.6f", static_cast<double>(micros) / 1e6);
+        return {buffer, static_cast<std::size_t>(n)};
+    }
+
+    // Histograma con los límites de kLatencyBuckets. `labels` va sin llaves
+    // (`queue="x"`) o vacío.
+    inline void AppendHistogram(std::string& out, std::string_view name, std::string_view labels,
+                                const HistogramSnapshot& histogram) {
+        const auto open = [&](std::string_view suffix) {
+            out += name;
+            out += suffix;
+            out += '{';
+            out += labels;
+        };
+        const std::string_view separator = labels.empty() ? "" : ",";
+
+        for (const auto& [le, micros] : kLatencyBuckets) {
+            open("_bucket");
+            out += separator;
+            out += "le=\"";
+            out += le;
+            out += "\"} ";
+            out += std::to_string(histogram.CountAtOrBelow(micros));
+            out += '\n';
+        }
+        open("_bucket");
+        out += separator;
+        out += "le=\"+Inf\"} ";
+        out += std::to_string(histogram.total);
+        out += '\n';
+        open("_sum");
+        out += "} ";
+        out += Seconds(histogram.sumMicros);
+        out += '\n';
+        open("_count");
+        out += "} ";
+        out += std::to_string(histogram.total);
+        out += '\n';
+    }
+}
+
+#endif // COMMON_METRICS_PROMETHEUS_TEXT_HPP
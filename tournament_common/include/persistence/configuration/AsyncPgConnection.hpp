@@ -0,0 +1,156 @@
+#ifndef TOURNAMENTS_ASYNC_PG_CONNECTION_HPP
+#define TOURNAMENTS_ASYNC_PG_CONNECTION_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <asio/io_context.hpp>
+#include <asio/posix/stream_descriptor.hpp>
+#include <libpq-fe.h>
+
+#include "concurrency/Task.hpp"
+
+// Parámetros de texto para libpq; std::nullopt => NULL de SQL
+using PgParams = std::vector<std::optional<std::string>>;
+
+inline std::optional<std::string> ToPgParam(std::string_view value) { return std::string(value); }
+inline std::optional<std::string> ToPgParam(std::string value) { return value; }
+inline std::optional<std::string> ToPgParam(const char* value) { return std::string(value); }
+inline std::optional<std::string> ToPgParam(std::nullopt_t) { return std::nullopt; }
+
+template<typename Number>
+    requires std::is_arithmetic_v<Number>
+std::optional<std::string> ToPgParam(Number value) { return std::to_string(value); }
+
+template<typename T>
+std::optional<std::string> ToPgParam(const std::optional<T>& value) {
+    return value ? ToPgParam(*value) : std::nullopt;
+}
+
+struct PgError : std::runtime_error {
+    std::string sqlState; // p. ej. "23505" (unique_violation), "22P02" (uuid inválido)
+
+    PgError(const std::string& message, std::string sqlState)
+        : std::runtime_error(message), sqlState(std::move(sqlState)) {}
+};
+
+// Dueño de un PGresult*. Los valores se leen en formato texto.
+class PgResult {
+    std::unique_ptr<PGresult, decltype(&PQclear)> result;
+
+public:
+    explicit PgResult(PGresult* result) : result(result, &PQclear) {}
+
+    [[nodiscard]] int Rows() const { return PQntuples(result.get()); }
+    [[nodiscard]] bool Empty() const { return Rows() == 0; }
+    [[nodiscard]] int Column(const char* name) const { return PQfnumber(result.get(), name); }
+    [[nodiscard]] bool IsNull(int row, int column) const { return PQgetisnull(result.get(), row, column) != 0; }
+
+    [[nodiscard]] std::string_view Value(int row, int column) const {
+        return {PQgetvalue(result.get(), row, column),
+                static_cast<std::size_t>(PQgetlength(result.get(), row, column))};
+    }
+
+    [[nodiscard]] std::string_view Value(int row, const char* name) const {
+        return Value(row, Column(name));
+    }
+
+    // Filas afectadas por INSERT/UPDATE/DELETE
+    [[nodiscard]] int AffectedRows() const;
+};
+
+// Conexión libpq en modo no bloqueante registrada en un io_context: mientras
+// una consulta espera al servidor el hilo atiende las demás corrutinas.
+// Una conexión lleva una sola consulta a la vez; el pool reparte conexiones.
+class AsyncPgConnection {
+    PGconn* connection;
+    asio::posix::stream_descriptor socket;
+
+public:
+    // Conecta y prepara las PreparedStatements de forma bloqueante (arranque)
+    AsyncPgConnection(asio::io_context& context, const std::string& connectionString);
+    ~AsyncPgConnection();
+
+    AsyncPgConnection(const AsyncPgConnection&) = delete;
+    AsyncPgConnection& operator=(const AsyncPgConnection&) = delete;
+
+    // SQL libre con parámetros $1..$n: co_await connection->Query("... $1", id)
+    template<typename... Params>
+    concurrency::Task<PgResult> Query(std::string sql, const Params&... params) {
+        return QueryParams(std::move(sql), PgParams{ToPgParam(params)...});
+    }
+
+    // Sentencia preparada por nombre (ver PreparedStatements.hpp)
+    template<typename... Params>
+    concurrency::Task<PgResult> Execute(std::string statement, const Params&... params) {
+        return ExecuteParams(std::move(statement), PgParams{ToPgParam(params)...});
+    }
+
+    // Con la lista ya armada (p. ej. inserts de varias filas). Se arma fuera
+    // del co_await: GCC 12 no acepta listas {...} dentro de una corrutina.
+    concurrency::Task<PgResult> QueryParams(std::string sql, PgParams params);
+    concurrency::Task<PgResult> ExecuteParams(std::string statement, PgParams params);
+
+    // false => no puede prestarse así: el servidor cortó (CONNECTION_BAD) o
+    // quedó una respuesta a medio leer o una transacción abierta
+    [[nodiscard]] bool Healthy() const;
+
+    // Reconecta y vuelve a preparar las sentencias, bloqueante como el
+    // constructor. Lanza PgError si el servidor sigue sin responder.
+    void Reset();
+
+private:
+    enum class Wait { Read, Write, ReadOrWrite };
+
+    void Prepare();
+    // Lo que quedó listo: Read o Write (con ReadOrWrite, lo primero que pase)
+    concurrency::Task<Wait> Ready(Wait wait);
+    concurrency::Task<PgResult> Collect();
+};
+
+class AsyncPgConnectionPool {
+    asio::io_context& context;
+    std::vector<std::unique_ptr<AsyncPgConnection>> connections;
+
+    std::mutex mutex;
+    std::vector<AsyncPgConnection*> idle;
+    std::deque<std::pair<std::coroutine_handle<>, AsyncPgConnection**>> waiters;
+
+public:
+    // Préstamo RAII: al destruirse devuelve la conexión (o la pasa al siguiente en espera)
+    class Lease {
+        AsyncPgConnectionPool* pool = nullptr;
+        AsyncPgConnection* connection = nullptr;
+
+    public:
+        Lease() = default;
+        Lease(AsyncPgConnectionPool* pool, AsyncPgConnection* connection) : pool(pool), connection(connection) {}
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease();
+
+        AsyncPgConnection* operator->() const { return connection; }
+        AsyncPgConnection& operator*() const { return *connection; }
+    };
+
+    AsyncPgConnectionPool(asio::io_context& context, const std::string& connectionString, std::size_t size);
+
+    [[nodiscard]] asio::io_context& Context() const { return context; }
+
+    // Se suspende sin bloquear el hilo si todas las conexiones están ocupadas
+    concurrency::Task<Lease> Acquire();
+
+private:
+    void Release(AsyncPgConnection* connection);
+};
+
+#endif //TOURNAMENTS_ASYNC_PG_CONNECTION_HPP
@@ -0,0 +1,65 @@
+#ifndef TOURNAMENTS_POOL_TELEMETRY_HPP
+#define TOURNAMENTS_POOL_TELEMETRY_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Contadores acumulados del pool de conexiones. Quien los lea toma dos
+// Snapshot y trabaja con la diferencia (ver concurrency::PoolSizeTuner).
+class PoolTelemetry {
+    std::atomic<std::uint64_t> acquisitions{0};
+    std::atomic<std::uint64_t> waitNanos{0};
+    std::atomic<std::uint64_t> holdNanos{0};
+    std::atomic<std::uint64_t> inUse{0};
+    std::atomic<std::uint64_t> peakInUse{0};
+
+public:
+    struct Snapshot {
+        std::uint64_t acquisitions = 0;
+        std::uint64_t waitNanos = 0;
+        std::uint64_t holdNanos = 0;
+        std::uint64_t inUse = 0;
+        std::uint64_t peakInUse = 0;
+
+        Snapshot operator-(const Snapshot& earlier) const {
+            return {acquisitions - earlier.acquisitions,
+                    waitNanos - earlier.waitNanos,
+                    holdNanos - earlier.holdNanos,
+                    inUse,
+                    peakInUse};
+        }
+    };
+
+    void Acquired(std::chrono::nanoseconds waited) {
+        acquisitions.fetch_add(1, std::memory_order_relaxed);
+        waitNanos.fetch_add(static_cast<std::uint64_t>(waited.count()), std::memory_order_relaxed);
+        const auto current = inUse.fetch_add(1, std::memory_order_relaxed) + 1;
+        auto peak = peakInUse.load(std::memory_order_relaxed);
+        while (current > peak && !peakInUse.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {}
+    }
+
+    void Released(std::chrono::nanoseconds held) {
+        holdNanos.fetch_add(static_cast<std::uint64_t>(held.count()), std::memory_order_relaxed);
+        inUse.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] Snapshot Read() const {
+        return {acquisitions.load(std::memory_order_relaxed),
+                waitNanos.load(std::memory_order_relaxed),
+                holdNanos.load(std::memory_order_relaxed),
+                inUse.load(std::memory_order_relaxed),
+                peakInUse.load(std::memory_order_relaxed)};
+    }
+
+    // Como Read, pero peakInUse es el pico desde la llamada anterior y el
+    // pico vuelve a contar desde lo que está en uso ahora: un pico viejo no
+    // pesa en los intervalos siguientes. Pensado para un solo lector por pool.
+    [[nodiscard]] Snapshot ReadInterval() {
+        auto snapshot = Read();
+        snapshot.peakInUse = peakInUse.exchange(inUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return snapshot;
+    }
+};
+
+#endif //TOURNAMENTS_POOL_TELEMETRY_HPP
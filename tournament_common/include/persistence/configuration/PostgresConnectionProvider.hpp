@@ -4,113 +4,120 @@
 
 #ifndef TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
+#include <chrono>
 #include <condition_variable>
 #include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include <pqxx/pqxx>
 
 #include "IDbConnectionProvider.hpp"
 #include "PostgresConnection.hpp"
+#include "PoolTelemetry.hpp"
+#include "PreparedStatements.hpp"
+
+// Connection() no consiguió conexión dentro de acquireTimeout: el pool está
+// saturado, pero es pasajero (quien la pidió puede reintentar más tarde)
+struct ConnectionPoolTimeout : std::runtime_error {
+    ConnectionPoolTimeout() : std::runtime_error("timed out waiting for a database connection") {}
+};
 
 class PostgresConnectionProvider : public IDbConnectionProvider{
-    std::string_view connectionString;
+    std::string connectionString; // Open() la vuelve a usar al crecer o reconectar
     size_t poolSize = 1;
+    std::chrono::milliseconds acquireTimeout{0}; // 0 => esperar sin límite
     std::queue<std::unique_ptr<pqxx::connection>> connectionPool;
     std::mutex connectionPoolMutex;
     std::condition_variable connectionPoolCondition;
+    PoolTelemetry telemetry;
+
+    std::unique_ptr<pqxx::connection> Open() const {
+        auto connection = std::make_unique<pqxx::connection>(connectionString);
+        for (const auto& [name, sql] : PreparedStatements) {
+            connection->prepare(name, sql);
+        }
+        return connection;
+    }
 
 public:
-    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize) : connectionString(connectionString), poolSize(poolSize) {
+    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize,
+                               std::chrono::milliseconds acquireTimeout = std::chrono::milliseconds(0))
+        : connectionString(connectionString), poolSize(poolSize), acquireTimeout(acquireTimeout) {
         for (size_t i = 0; i < poolSize; i++) {
-            connectionPool.push(std::make_unique<pqxx::connection>(connectionString.data()));
-            connectionPool.back()->prepare("insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1::uuid");
-            connectionPool.back()->prepare("update_tournament", "update TOURNAMENTS set document = $2 where id = $1::uuid");
-
-            connectionPool.back()->prepare("insert_team", "insert into TEAMS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_team_by_id", "select * from TEAMS where id = $1");
-            connectionPool.back()->prepare("update_team", "update TEAMS set document = $1 where id = $2::uuid RETURNING id");
-
-            connectionPool.back()->prepare("insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id");
-            connectionPool.back()->prepare("select_groups_by_tournament", "select * from GROUPS where tournament_id = $1");
-            connectionPool.back()->prepare("select_group_in_tournament", R"(
-                select * from groups
-                where  tournament_id = $1
-                and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
-            )");
-
-            connectionPool.back()->prepare("select_group_by_tournamentid_groupid", "select * from GROUPS where tournament_id = $1 and id = $2");
-            // connectionPool.back()->prepare("update_group", "update GROUPS set name = $2, last_update_date = CURRENT_TIMESTAMP where id = $1  RETURNING id");
-            connectionPool.back()->prepare("update_group_add_team", R"(
-                update groups
-                    set document = jsonb_insert(
-                            document, '{teams,-1}', $2
-                                   )
-                where id = $1
-            )");
-
-            // Match prepared statements
-            connectionPool.back()->prepare("insert_match", "insert into MATCHES (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("update_match", "update MATCHES set document = $2, last_update_date = CURRENT_TIMESTAMP where id = $1::uuid");
-            connectionPool.back()->prepare("select_matches_by_tournament", R"(
-                select * from MATCHES 
-                where document->>'tournamentId' = $1
-                order by (document->>'round')::int, created_at
-            )");
-            connectionPool.back()->prepare("select_matches_by_tournament_played", R"(
-                select * from MATCHES 
-                where document->>'tournamentId' = $1
-                and document ? 'homeScore'
-                and document ? 'awayScore'
-                order by (document->>'round')::int, created_at
-            )");
-            connectionPool.back()->prepare("select_matches_by_tournament_pending", R"(
-                select * from MATCHES 
-                where document->>'tournamentId' = $1
-                and (not document ? 'homeScore' or not document ? 'awayScore')
-                order by (document->>'round')::int, created_at
-            )");
-            connectionPool.back()->prepare("select_match_by_tournament_and_id", R"(
-                select * from MATCHES 
-                where document->>'tournamentId' = $1
-                and id = $2::uuid
-            )");
-            connectionPool.back()->prepare("update_match_score", R"(
-                update MATCHES 
-                set document = jsonb_set(
-                    jsonb_set(document, '{homeScore}', $2::text::jsonb),
-                    '{awayScore}', $3::text::jsonb
-                ),
-                last_update_date = CURRENT_TIMESTAMP
-                where id = $1::uuid
-            )");
-            connectionPool.back()->prepare("count_completed_matches_by_tournament", R"(
-                select count(*) from MATCHES 
-                where document->>'tournamentId' = $1
-                and document ? 'homeScore'
-                and document ? 'awayScore'
-            )");
-            connectionPool.back()->prepare("count_total_matches_by_tournament", R"(
-                select count(*) from MATCHES 
-                where document->>'tournamentId' = $1
-            )");
-            connectionPool.back()->prepare("select_matches_by_group", R"(
-                select * from MATCHES 
-                where document->>'groupId' = $1
-                order by (document->>'round')::int, created_at
-            )");
+            connectionPool.push(Open());
+        }
+    }
+
+    [[nodiscard]] size_t Size() {
+        std::lock_guard lock(connectionPoolMutex);
+        return poolSize;
+    }
 
+    [[nodiscard]] PoolTelemetry::Snapshot Telemetry() const {
+        return telemetry.Read();
+    }
+
+    // Con el pico de conexiones en uso desde la llamada anterior (PoolSizeTuner)
+    [[nodiscard]] PoolTelemetry::Snapshot TelemetryInterval() {
+        return telemetry.ReadInterval();
+    }
+
+    // Solo crece: las conexiones nuevas se abren fuera del lock para no
+    // frenar a quien está pidiendo una.
+    void Grow(size_t target) {
+        const size_t current = Size();
+        if (target <= current) return;
+
+        std::vector<std::unique_ptr<pqxx::connection>> opened;
+        for (size_t i = current; i < target; i++) {
+            opened.push_back(Open());
+        }
+        {
+            std::lock_guard lock(connectionPoolMutex);
+            for (auto& connection : opened) {
+                connectionPool.push(std::move(connection));
+            }
+            poolSize += opened.size();
         }
+        connectionPoolCondition.notify_all();
     }
 
     PooledConnection Connection() override {
+        const auto requested = std::chrono::steady_clock::now();
         std::unique_lock lock(connectionPoolMutex);
 
         // wait until a connection is available
-        connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
+        const auto available = [this] { return !connectionPool.empty(); };
+        if (acquireTimeout.count() == 0) {
+            connectionPoolCondition.wait(lock, available);
+        } else if (!connectionPoolCondition.wait_for(lock, acquireTimeout, available)) {
+            throw ConnectionPoolTimeout();
+        }
 
         // take one out
         auto conn = std::move(connectionPool.front());
         connectionPool.pop();
+        lock.unlock();
+
+        // Si la base se reinició la conexión quedó rota: se reabre aquí para
+        // que el pool se recupere solo. Si todavía no se puede, la rota vuelve
+        // al pool (no se pierde el lugar) y el error sube a quien la pidió.
+        if (!conn->is_open()) {
+            try {
+                conn = Open();
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> relock(connectionPoolMutex);
+                    connectionPool.push(std::move(conn));
+                }
+                connectionPoolCondition.notify_one();
+                throw;
+            }
+        }
+
+        const auto acquired = std::chrono::steady_clock::now();
+        telemetry.Acquired(acquired - requested);
 
         // build PostgresConnection wrapper (adapts pqxx::connection -> IDbConnection)
         auto dbc = new PostgresConnection(std::move(conn));
@@ -118,7 +125,8 @@ public:
         // return a RAII PooledConnection
         return PooledConnection(
             dbc,
-            [this](IDbConnection* dbc) {
+            [this, acquired](IDbConnection* dbc) {
+                telemetry.Released(std::chrono::steady_clock::now() - acquired);
                 auto pc = dynamic_cast<PostgresConnection*>(dbc);
 
                 {
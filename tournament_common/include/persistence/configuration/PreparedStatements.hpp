@@ -0,0 +1,84 @@
+#ifndef TOURNAMENTS_PREPARED_STATEMENTS_HPP
+#define TOURNAMENTS_PREPARED_STATEMENTS_HPP
+
+// Sentencias preparadas en cada conexión del pool, tanto en el síncrono
+// (PostgresConnectionProvider, pqxx) como en el asíncrono (AsyncPgConnectionPool, libpq).
+struct PreparedStatement {
+    const char* name;
+    const char* sql;
+};
+
+inline constexpr PreparedStatement PreparedStatements[] = {
+    {"insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id"},
+    {"select_tournament_by_id", "select * from TOURNAMENTS where id = $1::uuid"},
+    {"update_tournament", "update TOURNAMENTS set document = $2 where id = $1::uuid"},
+    {"insert_team", "insert into TEAMS (document) values($1) RETURNING id"},
+    {"select_team_by_id", "select * from TEAMS where id = $1"},
+    {"update_team", "update TEAMS set document = $1 where id = $2::uuid RETURNING id"},
+    {"insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id"},
+    {"select_groups_by_tournament", "select * from GROUPS where tournament_id = $1"},
+    {"select_group_in_tournament", R"(
+        select * from groups
+        where  tournament_id = $1
+        and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
+    )"},
+    {"select_group_by_tournamentid_groupid", "select * from GROUPS where tournament_id = $1 and id = $2"},
+    // {"update_group", "update GROUPS set name = $2, last_update_date = CURRENT_TIMESTAMP where id = $1  RETURNING id"},
+    {"update_group_add_team", R"(
+        update groups
+            set document = jsonb_insert(
+                    document, '{teams,-1}', $2
+                           )
+        where id = $1
+    )"},
+    // Match prepared statements
+    {"insert_match", "insert into MATCHES (document) values($1) RETURNING id"},
+    {"update_match", "update MATCHES set document = $2, version = version + 1, last_update_date = CURRENT_TIMESTAMP where id = $1::uuid"},
+    {"select_matches_by_tournament", R"(
+        select * from MATCHES 
+        where document->>'tournamentId' = $1
+        order by (document->>'round')::int, created_at
+    )"},
+    {"select_matches_by_tournament_played", R"(
+        select * from MATCHES 
+        where document->>'tournamentId' = $1
+        and document ? 'homeScore'
+        and document ? 'awayScore'
+        order by (document->>'round')::int, created_at
+    )"},
+    {"select_matches_by_tournament_pending", R"(
+        select * from MATCHES 
+        where document->>'tournamentId' = $1
+        and (not document ? 'homeScore' or not document ? 'awayScore')
+        order by (document->>'round')::int, created_at
+    )"},
+    {"select_match_by_tournament_and_id", R"(
+        select * from MATCHES 
+        where document->>'tournamentId' = $1
+        and id = $2::uuid
+    )"},
+    {"update_match_score", R"(
+        update MATCHES 
+        set document = document || jsonb_build_object('homeScore', $2::int, 'awayScore', $3::int),
+        version = version + 1,
+        last_update_date = CURRENT_TIMESTAMP
+        where id = $1::uuid
+    )"},
+    {"count_completed_matches_by_tournament", R"(
+        select count(*) from MATCHES 
+        where document->>'tournamentId' = $1
+        and document ? 'homeScore'
+        and document ? 'awayScore'
+    )"},
+    {"count_total_matches_by_tournament", R"(
+        select count(*) from MATCHES 
+        where document->>'tournamentId' = $1
+    )"},
+    {"select_matches_by_group", R"(
+        select * from MATCHES 
+        where document->>'groupId' = $1
+        order by (document->>'round')::int, created_at
+    )"},
+};
+
+#endif //TOURNAMENTS_PREPARED_STATEMENTS_HPP
@@ -0,0 +1,49 @@
+#ifndef COMMON_ASYNC_GROUP_REPOSITORY_HPP
+#define COMMON_ASYNC_GROUP_REPOSITORY_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "persistence/repository/IAsyncGroupRepository.hpp"
+#include "persistence/configuration/AsyncPgConnection.hpp"
+#include "domain/Group.hpp"
+#include "domain/Team.hpp"
+
+// Mismas consultas que GroupRepository sobre libpq no bloqueante
+class AsyncGroupRepository : public IAsyncGroupRepository {
+    std::shared_ptr<AsyncPgConnectionPool> pool;
+
+public:
+    explicit AsyncGroupRepository(std::shared_ptr<AsyncPgConnectionPool> pool);
+
+    // IAsyncRepository
+    concurrency::Task<std::shared_ptr<domain::Group>> ReadById(std::string id) override;
+    concurrency::Task<std::string> Create(domain::Group entity) override;
+    concurrency::Task<std::string> Update(domain::Group entity) override;
+    concurrency::Task<void> Delete(std::string id) override;
+    concurrency::Task<std::vector<std::shared_ptr<domain::Group>>> ReadAll() override;
+
+    // IAsyncGroupRepository
+    concurrency::Task<std::vector<std::shared_ptr<domain::Group>>>
+    FindByTournamentId(std::string tournamentId) override;
+
+    concurrency::Task<std::shared_ptr<domain::Group>>
+    FindByTournamentIdAndGroupId(std::string tournamentId, std::string groupId) override;
+
+    concurrency::Task<std::shared_ptr<domain::Group>>
+    FindByTournamentIdAndTeamId(std::string tournamentId, std::string teamId) override;
+
+    concurrency::Task<void>
+    UpdateGroupAddTeam(std::string groupId, std::shared_ptr<domain::Team> team) override;
+
+    concurrency::Task<bool> ExistsGroupForTournament(std::string tournamentId) override;
+
+    concurrency::Task<int> GroupsCountForTournament(std::string tournamentId) override;
+
+    concurrency::Task<int> CountTeamsInGroup(std::string groupId) override;
+
+    concurrency::Task<std::vector<domain::Team>> GetTeamsOfGroup(std::string groupId) override;
+};
+
+#endif // COMMON_ASYNC_GROUP_REPOSITORY_HPP
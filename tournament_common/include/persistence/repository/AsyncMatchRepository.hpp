@@ -0,0 +1,43 @@
+#ifndef COMMON_ASYNC_MATCH_REPOSITORY_HPP
+#define COMMON_ASYNC_MATCH_REPOSITORY_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "persistence/repository/IAsyncMatchRepository.hpp"
+#include "persistence/configuration/AsyncPgConnection.hpp"
+#include "domain/Match.hpp"
+
+// Mismas consultas que MatchRepository sobre libpq no bloqueante
+class AsyncMatchRepository : public IAsyncMatchRepository {
+    std::shared_ptr<AsyncPgConnectionPool> pool;
+
+public:
+    explicit AsyncMatchRepository(std::shared_ptr<AsyncPgConnectionPool> pool);
+
+    // IAsyncRepository
+    concurrency::Task<std::shared_ptr<domain::Match>> ReadById(std::string id) override;
+    concurrency::Task<std::string> Create(domain::Match entity) override;
+    concurrency::Task<std::string> Update(domain::Match entity) override;
+    concurrency::Task<void> Delete(std::string id) override;
+    concurrency::Task<std::vector<std::shared_ptr<domain::Match>>> ReadAll() override;
+
+    // IAsyncMatchRepository
+    concurrency::Task<std::vector<std::shared_ptr<domain::Match>>>
+    FindByTournamentId(std::string tournamentId, MatchFilter filter = MatchFilter::All) override;
+
+    concurrency::Task<std::shared_ptr<domain::Match>>
+    FindByTournamentIdAndMatchId(std::string tournamentId, std::string matchId) override;
+
+    concurrency::Task<bool> UpdateScore(std::string matchId, int homeScore, int awayScore) override;
+
+    concurrency::Task<int> CountCompletedMatchesByTournament(std::string tournamentId) override;
+
+    concurrency::Task<int> CountTotalMatchesByTournament(std::string tournamentId) override;
+
+    concurrency::Task<std::vector<std::shared_ptr<domain::Match>>>
+    FindByGroupId(std::string groupId) override;
+};
+
+#endif // COMMON_ASYNC_MATCH_REPOSITORY_HPP
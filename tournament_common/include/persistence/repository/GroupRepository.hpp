@@ -15,9 +15,11 @@
 
 class GroupRepository : public IGroupRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    bool writeOutbox; // eventos de grupo a la tabla outbox, en la misma transacción
 
 public:
-    explicit GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+    explicit GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider,
+                             bool writeOutbox = false);
 
     // IRepository
     std::shared_ptr<domain::Group> ReadById(std::string id) override;
@@ -52,6 +54,12 @@ public:
     UpdateGroupAddTeam(std::string_view groupId,
                        const std::shared_ptr<domain::Team>& team) override;
 
+    std::optional<std::string>
+    AddTeams(std::string_view groupId,
+             const std::vector<std::string>& teamIds,
+             int maxTeams,
+             std::vector<domain::Team>& outAdded) override;
+
     bool
     ExistsGroupForTournament(std::string_view tournamentId) override;
 
@@ -0,0 +1,39 @@
+#ifndef COMMON_IASYNC_GROUP_REPOSITORY_HPP
+#define COMMON_IASYNC_GROUP_REPOSITORY_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "persistence/repository/IAsyncRepository.hpp"
+#include "domain/Group.hpp"
+#include "domain/Team.hpp"
+
+// Misma superficie que IGroupRepository, con corrutinas. GetGroups/GetGroup
+// (parámetros de salida) no tienen equivalente: FindBy* ya devuelve el valor.
+class IAsyncGroupRepository : public IAsyncRepository<domain::Group, std::string> {
+public:
+    ~IAsyncGroupRepository() override = default;
+
+    virtual concurrency::Task<std::vector<std::shared_ptr<domain::Group>>>
+    FindByTournamentId(std::string tournamentId) = 0;
+
+    virtual concurrency::Task<std::shared_ptr<domain::Group>>
+    FindByTournamentIdAndGroupId(std::string tournamentId, std::string groupId) = 0;
+
+    virtual concurrency::Task<std::shared_ptr<domain::Group>>
+    FindByTournamentIdAndTeamId(std::string tournamentId, std::string teamId) = 0;
+
+    virtual concurrency::Task<void>
+    UpdateGroupAddTeam(std::string groupId, std::shared_ptr<domain::Team> team) = 0;
+
+    virtual concurrency::Task<bool> ExistsGroupForTournament(std::string tournamentId) = 0;
+
+    virtual concurrency::Task<int> GroupsCountForTournament(std::string tournamentId) = 0;
+
+    virtual concurrency::Task<int> CountTeamsInGroup(std::string groupId) = 0;
+
+    virtual concurrency::Task<std::vector<domain::Team>> GetTeamsOfGroup(std::string groupId) = 0;
+};
+
+#endif // COMMON_IASYNC_GROUP_REPOSITORY_HPP
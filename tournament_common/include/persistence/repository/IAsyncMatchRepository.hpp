@@ -0,0 +1,33 @@
+#ifndef COMMON_IASYNC_MATCH_REPOSITORY_HPP
+#define COMMON_IASYNC_MATCH_REPOSITORY_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "persistence/repository/IAsyncRepository.hpp"
+#include "persistence/repository/IMatchRepository.hpp"
+#include "domain/Match.hpp"
+
+// Misma superficie que IMatchRepository, con corrutinas
+class IAsyncMatchRepository : public IAsyncRepository<domain::Match, std::string> {
+public:
+    ~IAsyncMatchRepository() override = default;
+
+    virtual concurrency::Task<std::vector<std::shared_ptr<domain::Match>>>
+    FindByTournamentId(std::string tournamentId, MatchFilter filter = MatchFilter::All) = 0;
+
+    virtual concurrency::Task<std::shared_ptr<domain::Match>>
+    FindByTournamentIdAndMatchId(std::string tournamentId, std::string matchId) = 0;
+
+    virtual concurrency::Task<bool> UpdateScore(std::string matchId, int homeScore, int awayScore) = 0;
+
+    virtual concurrency::Task<int> CountCompletedMatchesByTournament(std::string tournamentId) = 0;
+
+    virtual concurrency::Task<int> CountTotalMatchesByTournament(std::string tournamentId) = 0;
+
+    virtual concurrency::Task<std::vector<std::shared_ptr<domain::Match>>>
+    FindByGroupId(std::string groupId) = 0;
+};
+
+#endif // COMMON_IASYNC_MATCH_REPOSITORY_HPP
@@ -0,0 +1,20 @@
+#ifndef COMMON_IASYNC_REPOSITORY_HPP
+#define COMMON_IASYNC_REPOSITORY_HPP
+#include <memory>
+#include <vector>
+
+#include "concurrency/Task.hpp"
+
+// Variante con corrutinas de IRepository. Los parámetros van por valor: la
+// corrutina puede seguir viva después de que el llamador suelte sus referencias.
+template<typename Type, typename Id>
+class IAsyncRepository {
+public:
+    virtual ~IAsyncRepository() = default;
+    virtual concurrency::Task<std::shared_ptr<Type>> ReadById(Id id) = 0;
+    virtual concurrency::Task<Id> Create(Type entity) = 0;
+    virtual concurrency::Task<Id> Update(Type entity) = 0;
+    virtual concurrency::Task<void> Delete(Id id) = 0;
+    virtual concurrency::Task<std::vector<std::shared_ptr<Type>>> ReadAll() = 0;
+};
+#endif //COMMON_IASYNC_REPOSITORY_HPP
@@ -41,6 +41,16 @@ public:
     UpdateGroupAddTeam(std::string_view groupId,
                        const std::shared_ptr<domain::Team>& team) = 0;
 
+    // Alta de varios equipos en una sola sentencia. Sólo inserta si todos los
+    // equipos existen y caben (maxTeams <= 0 => sin límite); los que ya estaban
+    // en el grupo no cuentan. nullopt = OK y outAdded trae los que se agregaron;
+    // "group_full" / "team_not_found" si no se insertó ninguno.
+    virtual std::optional<std::string>
+    AddTeams(std::string_view groupId,
+             const std::vector<std::string>& teamIds,
+             int maxTeams,
+             std::vector<domain::Team>& outAdded) = 0;
+
     virtual bool
     ExistsGroupForTournament(std::string_view tournamentId) = 0;
 
@@ -6,6 +6,7 @@
 #include <string_view>
 #include <vector>
 #include <optional>
+#include <expected>
 
 #include "persistence/repository/IRepository.hpp"
 #include "domain/Match.hpp"
@@ -16,6 +17,34 @@ enum class MatchFilter {
     Pending
 };
 
+struct ScoreUpdate {
+    std::string matchId;
+    int homeScore = 0;
+    int awayScore = 0;
+    // Versión que leyó el cliente (If-Match); nullopt => sin control de concurrencia
+    std::optional<int> expectedVersion;
+};
+
+enum class ScoreUpdateError {
+    NotFound,        // no existe en ese torneo
+    VersionConflict  // otra escritura llegó primero
+};
+
+using ScoreUpdateOutcome = std::expected<std::shared_ptr<domain::Match>, ScoreUpdateError>;
+
+// Lo que escribe tournament_consumer al procesar un match.score_updated
+struct ScoreEffects {
+    std::vector<domain::Match> advanced;  // partidos KO con el ganador ya colocado
+    std::vector<domain::Match> playoffs;  // llave nueva; se omite si el torneo ya tiene KO
+    // En los partidos de `advanced` sólo se reemplaza el lado que sigue
+    // esperando `placeholder` ("W(local-visitante)") por `winnerId`; el resto
+    // del documento no se toca (puede haber cambiado desde la lectura)
+    std::string placeholder;
+    std::string winnerId;
+
+    [[nodiscard]] bool Empty() const { return advanced.empty() && playoffs.empty(); }
+};
+
 class IMatchRepository : public IRepository<domain::Match, std::string> {
 public:
     virtual ~IMatchRepository() = default;
@@ -31,6 +60,28 @@ public:
     // Update score for a match
     virtual bool UpdateScore(std::string_view matchId, int homeScore, int awayScore) = 0;
 
+    // Update the score of a match of the tournament in one statement, checking
+    // update.expectedVersion if set. Returns the updated match (new version).
+    // Throws on database errors.
+    virtual ScoreUpdateOutcome
+    UpdateScoreReturning(std::string_view tournamentId, const ScoreUpdate& update) = 0;
+
+    // Update many scores of one tournament in a single transaction.
+    // Returns the matches actually updated (ids ajenos al torneo se omiten)
+    virtual std::vector<std::shared_ptr<domain::Match>>
+    UpdateScores(std::string_view tournamentId, const std::vector<ScoreUpdate>& updates) = 0;
+
+    // Inserta el fixture completo en una sola transacción, sólo si el torneo
+    // aún no tiene partidos (candado por torneo: dos consumers que ven el grupo
+    // lleno a la vez no lo duplican). false => ya existía, no se insertó nada.
+    virtual bool CreateFixtures(std::string_view tournamentId, const std::vector<domain::Match>& matches) = 0;
+
+    // Aplica los efectos de un evento en una transacción junto con la marca
+    // (consumer, eventId) en processed_events. false => ese evento ya se había
+    // aplicado y no se escribe nada. eventId vacío => sin marca.
+    virtual bool ApplyScoreEffects(std::string_view consumer, std::string_view eventId,
+                                   std::string_view tournamentId, const ScoreEffects& effects) = 0;
+
     // Count completed matches in a tournament
     virtual int CountCompletedMatchesByTournament(std::string_view tournamentId) = 0;
 
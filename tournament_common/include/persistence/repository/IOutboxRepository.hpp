@@ -0,0 +1,60 @@
+#ifndef COMMON_IOUTBOX_REPOSITORY_HPP
+#define COMMON_IOUTBOX_REPOSITORY_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "messaging/EventCodec.hpp"
+
+// Outbox transaccional: los repositorios de grupos y partidos escriben sus
+// eventos en la misma transacción que el cambio; OutboxRelay los lleva al
+// broker. Un broker caído ya no pierde eventos ni hace fallar el request.
+struct OutboxOptions {
+    bool enabled = false;
+    std::size_t batchSize = 256;
+    // Espera cuando la tabla quedó vacía (con lote lleno se sigue de inmediato)
+    std::chrono::milliseconds pollInterval{50};
+    std::chrono::milliseconds retryBackoff{1000};
+    // Formato hacia el broker; la tabla siempre guarda JSON (activemq.encoding)
+    messaging::EventEncoding encoding = messaging::EventEncoding::Json;
+};
+
+inline void from_json(const nlohmann::json& json, OutboxOptions& options) {
+    options.enabled = json.value("enabled", false);
+    options.batchSize = json.value("batchSize", static_cast<std::size_t>(256));
+    options.pollInterval = std::chrono::milliseconds(json.value("pollIntervalMs", 50));
+    options.retryBackoff = std::chrono::milliseconds(json.value("retryBackoffMs", 1000));
+    if (options.batchSize == 0) options.batchSize = 1;
+}
+
+// Evento a escribir en la tabla outbox junto con el cambio de dominio
+struct OutboxEvent {
+    std::string topic;
+    nlohmann::json payload;
+};
+
+// Fila pendiente tal como la lee el relay (payload ya serializado)
+struct OutboxRecord {
+    std::int64_t id = 0;
+    std::string topic;
+    std::string payload;
+};
+
+class IOutboxRepository {
+public:
+    virtual ~IOutboxRepository() = default;
+
+    // Toma hasta `limit` filas en orden de id (las que otro relay tiene
+    // bloqueadas se saltan), se las pasa a `publish` y las borra en la misma
+    // transacción. Si publish lanza, las filas quedan para el siguiente
+    // intento y la excepción se propaga. Devuelve cuántas se publicaron.
+    virtual std::size_t
+    PublishPending(std::size_t limit, const std::function<void(const std::vector<OutboxRecord>&)>& publish) = 0;
+};
+
+#endif // COMMON_IOUTBOX_REPOSITORY_HPP
@@ -1,6 +1,7 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <vector>
 #include "IRepository.hpp"
 #include "domain/Team.hpp"
 
@@ -8,4 +9,8 @@ class ITeamRepository : public IRepository<domain::Team, std::string> {
 public:
     ~ITeamRepository() override = default;
     std::shared_ptr<domain::Team> ReadById(std::string id) override = 0;
+
+    // Alta de varios equipos en una sola sentencia. Devuelve un id por equipo,
+    // en el mismo orden; "" => el nombre ya existía (o se repite en el lote).
+    virtual std::vector<std::string> CreateMany(const std::vector<domain::Team>& entities) = 0;
 };
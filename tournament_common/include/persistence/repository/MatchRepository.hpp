@@ -1,21 +1,66 @@
 #ifndef COMMON_MATCH_REPOSITORY_HPP
 #define COMMON_MATCH_REPOSITORY_HPP
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <vector>
+#include <nlohmann/json.hpp>
 #include <pqxx/pqxx>
 
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 #include "domain/Match.hpp"
 
+// Group commit: los PATCH de marcador concurrentes (feeds en vivo) se juntan
+// en un solo UPDATE ... FROM (VALUES ...) y un solo commit. UpdateScoreReturning()
+// sigue bloqueando hasta que su lote se confirma y devuelve su propio resultado.
+struct ScoreGroupCommitOptions {
+    bool enabled = false;
+    std::size_t maxBatchSize = 256;
+    std::chrono::microseconds flushInterval{1000};
+};
+
+inline void from_json(const nlohmann::json& json, ScoreGroupCommitOptions& options) {
+    options.enabled = json.value("enabled", false);
+    options.maxBatchSize = json.value("maxBatchSize", static_cast<std::size_t>(256));
+    options.flushInterval = std::chrono::microseconds(json.value("flushIntervalUs", 1000));
+    if (options.maxBatchSize == 0) options.maxBatchSize = 1;
+}
+
 class MatchRepository : public IMatchRepository {
+    struct PendingScore {
+        std::string tournamentId;
+        ScoreUpdate update;
+        std::promise<ScoreUpdateOutcome> result;
+    };
+
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    ScoreGroupCommitOptions groupCommit;
+    bool writeOutbox; // match.score_updated a la tabla outbox, en la misma transacción
+
+    std::mutex pendingMutex;
+    std::condition_variable pendingCondition;
+    std::deque<PendingScore> pending;
+    bool stopping = false;
+    std::thread flusher;
 
 public:
-    explicit MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+    explicit MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider,
+                             ScoreGroupCommitOptions groupCommit = {},
+                             bool writeOutbox = false);
+    ~MatchRepository() override;
+
+    MatchRepository(const MatchRepository&) = delete;
+    MatchRepository& operator=(const MatchRepository&) = delete;
 
     // IRepository methods
     std::shared_ptr<domain::Match> ReadById(std::string id) override;
@@ -33,6 +78,17 @@ public:
 
     bool UpdateScore(std::string_view matchId, int homeScore, int awayScore) override;
 
+    ScoreUpdateOutcome
+    UpdateScoreReturning(std::string_view tournamentId, const ScoreUpdate& update) override;
+
+    std::vector<std::shared_ptr<domain::Match>>
+    UpdateScores(std::string_view tournamentId, const std::vector<ScoreUpdate>& updates) override;
+
+    bool CreateFixtures(std::string_view tournamentId, const std::vector<domain::Match>& matches) override;
+
+    bool ApplyScoreEffects(std::string_view consumer, std::string_view eventId,
+                           std::string_view tournamentId, const ScoreEffects& effects) override;
+
     int CountCompletedMatchesByTournament(std::string_view tournamentId) override;
 
     int CountTotalMatchesByTournament(std::string_view tournamentId) override;
@@ -42,6 +98,10 @@ public:
 
 private:
     std::shared_ptr<domain::Match> ParseMatchFromRow(const pqxx::row& row);
+    std::unordered_map<std::string, ScoreUpdateOutcome>
+    RunScoreUpdate(const std::string& query, const pqxx::params& params);
+    void FlushLoop();
+    void FlushBatch(std::vector<PendingScore>& batch);
 };
 
 #endif
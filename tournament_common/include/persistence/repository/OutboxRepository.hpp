@@ -0,0 +1,26 @@
+#ifndef COMMON_OUTBOX_REPOSITORY_HPP
+#define COMMON_OUTBOX_REPOSITORY_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <pqxx/pqxx>
+
+#include "persistence/repository/IOutboxRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+class OutboxRepository : public IOutboxRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+
+public:
+    explicit OutboxRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+
+    std::size_t
+    PublishPending(std::size_t limit, const std::function<void(const std::vector<OutboxRecord>&)>& publish) override;
+
+    // Un solo INSERT para todos los eventos, dentro de la transacción de quien llama
+    static void Append(pqxx::transaction_base& tx, const std::vector<OutboxEvent>& events);
+};
+
+#endif // COMMON_OUTBOX_REPOSITORY_HPP
@@ -0,0 +1,74 @@
+#ifndef COMMON_POSTGRES_TEAM_REPOSITORY_HPP
+#define COMMON_POSTGRES_TEAM_REPOSITORY_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "persistence/repository/ITeamRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "domain/Team.hpp"
+
+// Write-behind: los inserts concurrentes (ráfagas de POST /teams) se agrupan
+// en un solo INSERT multi-fila. Create() sigue bloqueando hasta que su lote
+// se confirma, así que el id devuelto ya es legible y los duplicados se
+// siguen reportando (id vacío) sin perder la semántica 201/409.
+struct TeamWriteBehindOptions {
+    bool enabled = false;
+    std::size_t maxBatchSize = 64;
+    std::chrono::milliseconds flushInterval{2};
+};
+
+inline void from_json(const nlohmann::json& json, TeamWriteBehindOptions& options) {
+    options.enabled = json.value("enabled", false);
+    options.maxBatchSize = json.value("maxBatchSize", static_cast<std::size_t>(64));
+    options.flushInterval = std::chrono::milliseconds(json.value("flushIntervalMs", 2));
+    if (options.maxBatchSize == 0) options.maxBatchSize = 1;
+}
+
+class PostgresTeamRepository : public ITeamRepository {
+    struct PendingInsert {
+        domain::Team team;
+        std::promise<std::string> result;
+    };
+
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    TeamWriteBehindOptions options;
+
+    std::mutex pendingMutex;
+    std::condition_variable pendingCondition;
+    std::deque<PendingInsert> pending;
+    bool stopping = false;
+    std::thread flusher;
+
+public:
+    explicit PostgresTeamRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider,
+                                    TeamWriteBehindOptions options = {});
+    ~PostgresTeamRepository() override;
+
+    PostgresTeamRepository(const PostgresTeamRepository&) = delete;
+    PostgresTeamRepository& operator=(const PostgresTeamRepository&) = delete;
+
+    std::shared_ptr<domain::Team> ReadById(std::string id) override;
+    std::string Create(const domain::Team& entity) override;
+    std::string Update(const domain::Team& entity) override;
+    void Delete(std::string id) override;
+    std::vector<std::shared_ptr<domain::Team>> ReadAll() override;
+    std::vector<std::string> CreateMany(const std::vector<domain::Team>& entities) override;
+
+private:
+    std::string InsertOne(const domain::Team& entity);
+    std::vector<std::string> InsertMany(const std::vector<domain::Team>& entities);
+    void FlushLoop();
+    void FlushBatch(std::vector<PendingInsert>& batch);
+};
+
+#endif // COMMON_POSTGRES_TEAM_REPOSITORY_HPP
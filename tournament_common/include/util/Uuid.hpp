@@ -0,0 +1,99 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace util {
+
+    namespace detail {
+        // Valor de cada dígito hexadecimal; 0xF0 marca "no es hex" para poder
+        // acumular errores con OR en lugar de ramificar por carácter.
+        inline constexpr std::array<std::uint8_t, 256> HexValue = [] {
+            std::array<std::uint8_t, 256> table{};
+            table.fill(0xF0);
+            for (int c = '0'; c <= '9'; ++c) table[c] = static_cast<std::uint8_t>(c - '0');
+            for (int c = 'a'; c <= 'f'; ++c) table[c] = static_cast<std::uint8_t>(c - 'a' + 10);
+            for (int c = 'A'; c <= 'F'; ++c) table[c] = static_cast<std::uint8_t>(c - 'A' + 10);
+            return table;
+        }();
+
+        // 1 para [A-Za-z0-9-], 0 para todo lo demás
+        inline constexpr std::array<std::uint8_t, 256> IdChar = [] {
+            std::array<std::uint8_t, 256> table{};
+            for (int c = '0'; c <= '9'; ++c) table[c] = 1;
+            for (int c = 'a'; c <= 'z'; ++c) table[c] = 1;
+            for (int c = 'A'; c <= 'Z'; ++c) table[c] = 1;
+            table['-'] = 1;
+            return table;
+        }();
+
+        // Posición en el texto 8-4-4-4-12 de cada nibble (32 dígitos hex)
+        inline constexpr std::array<std::uint8_t, 32> NibblePosition = [] {
+            std::array<std::uint8_t, 32> positions{};
+            std::size_t n = 0;
+            for (std::uint8_t i = 0; i < 36; ++i) {
+                if (i == 8 || i == 13 || i == 18 || i == 23) continue;
+                positions[n++] = i;
+            }
+            return positions;
+        }();
+    }
+
+    // Equivalente a ^[A-Za-z0-9-]+$ sin std::regex. Recorre toda la cadena
+    // acumulando con AND, así que el costo solo depende del largo.
+    constexpr bool IsValidId(std::string_view id) noexcept {
+        std::uint8_t ok = 1;
+        for (const unsigned char c : id) {
+            ok &= detail::IdChar[c];
+        }
+        return (ok != 0) & !id.empty();
+    }
+
+    class Uuid {
+        std::array<std::uint8_t, 16> bytes{};
+
+    public:
+        static constexpr std::size_t TextLength = 36;
+
+        constexpr Uuid() = default;
+
+        // Acepta solo la forma canónica xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+        // (mayúsculas o minúsculas). Número fijo de pasos, sin salidas tempranas.
+        static constexpr std::optional<Uuid> Parse(std::string_view text) noexcept {
+            if (text.size() != TextLength) return std::nullopt;
+
+            std::uint8_t bad = static_cast<std::uint8_t>((text[8] ^ '-') | (text[13] ^ '-') |
+                                                         (text[18] ^ '-') | (text[23] ^ '-'));
+            Uuid uuid;
+            for (std::size_t i = 0; i < 16; ++i) {
+                const std::uint8_t hi = detail::HexValue[static_cast<unsigned char>(text[detail::NibblePosition[2 * i]])];
+                const std::uint8_t lo = detail::HexValue[static_cast<unsigned char>(text[detail::NibblePosition[2 * i + 1]])];
+                bad |= static_cast<std::uint8_t>((hi | lo) & 0xF0);
+                uuid.bytes[i] = static_cast<std::uint8_t>((hi << 4) | (lo & 0x0F));
+            }
+
+            if (bad != 0) return std::nullopt;
+            return uuid;
+        }
+
+        [[nodiscard]] constexpr const std::array<std::uint8_t, 16>& Bytes() const noexcept {
+            return bytes;
+        }
+
+        // Forma canónica en minúsculas, la misma que devuelve Postgres para columnas uuid
+        [[nodiscard]] std::string ToString() const {
+            constexpr char digits[] = "0123456789abcdef";
+            std::string text(TextLength, '-');
+            for (std::size_t i = 0; i < 16; ++i) {
+                text[detail::NibblePosition[2 * i]] = digits[bytes[i] >> 4];
+                text[detail::NibblePosition[2 * i + 1]] = digits[bytes[i] & 0x0F];
+            }
+            return text;
+        }
+
+        friend constexpr bool operator==(const Uuid&, const Uuid&) = default;
+    };
+}
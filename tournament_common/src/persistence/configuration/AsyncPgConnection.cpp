@@ -0,0 +1,303 @@
+#include "persistence/configuration/AsyncPgConnection.hpp"
+#include "persistence/configuration/PreparedStatements.hpp"
+
+#include <atomic>
+#include <charconv>
+#include <iostream>
+#include <system_error>
+#include <utility>
+#include <asio/post.hpp>
+
+namespace {
+    std::string ErrorState(const PGresult* result) {
+        const char* state = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+        return state ? state : "";
+    }
+
+    std::vector<const char*> ToValues(const PgParams& params) {
+        std::vector<const char*> values;
+        values.reserve(params.size());
+        for (const auto& param : params) {
+            values.push_back(param ? param->c_str() : nullptr);
+        }
+        return values;
+    }
+
+    // Espera a que el socket esté listo sin ocupar el hilo
+    struct SocketReady {
+        asio::posix::stream_descriptor& socket;
+        asio::posix::stream_descriptor::wait_type type;
+        std::error_code error;
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            socket.async_wait(type, [this, handle](const std::error_code& ec) {
+                error = ec;
+                handle.resume();
+            });
+        }
+
+        void await_resume() const {
+            if (error) throw std::system_error(error);
+        }
+    };
+
+    // Lectura o escritura, lo que llegue primero. La otra espera se cancela;
+    // su handler corre después y no debe volver a reanudar la corrutina.
+    struct SocketEitherReady {
+        using WaitType = asio::posix::stream_descriptor::wait_type;
+
+        struct State {
+            std::coroutine_handle<> handle;
+            std::atomic<bool> done{false};
+            std::error_code error;
+            WaitType ready = asio::posix::stream_descriptor::wait_read;
+        };
+
+        asio::posix::stream_descriptor& socket;
+        std::shared_ptr<State> state = std::make_shared<State>();
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            state->handle = handle;
+            for (const auto type : {asio::posix::stream_descriptor::wait_read,
+                                    asio::posix::stream_descriptor::wait_write}) {
+                socket.async_wait(type, [state = state, type, &socket = socket](const std::error_code& ec) {
+                    if (state->done.exchange(true)) return;
+                    state->error = ec;
+                    state->ready = type;
+                    std::error_code ignored;
+                    socket.cancel(ignored);
+                    state->handle.resume();
+                });
+            }
+        }
+
+        WaitType await_resume() const {
+            if (state->error) throw std::system_error(state->error);
+            return state->ready;
+        }
+    };
+}
+
+int PgResult::AffectedRows() const {
+    const char* text = PQcmdTuples(result.get());
+    const std::string_view digits(text);
+    int rows = 0;
+    std::from_chars(digits.data(), digits.data() + digits.size(), rows);
+    return rows;
+}
+
+AsyncPgConnection::AsyncPgConnection(asio::io_context& context, const std::string& connectionString)
+    : connection(PQconnectdb(connectionString.c_str())), socket(context) {
+    if (PQstatus(connection) != CONNECTION_OK) {
+        const std::string message = PQerrorMessage(connection);
+        PQfinish(connection);
+        throw PgError(message, "");
+    }
+
+    try {
+        Prepare();
+    } catch (const PgError&) {
+        PQfinish(connection);
+        throw;
+    }
+
+    PQsetnonblocking(connection, 1);
+    socket.assign(PQsocket(connection));
+}
+
+AsyncPgConnection::~AsyncPgConnection() {
+    // El descriptor es de libpq: PQfinish lo cierra
+    socket.release();
+    PQfinish(connection);
+}
+
+void AsyncPgConnection::Prepare() {
+    for (const auto& [name, sql] : PreparedStatements) {
+        PGresult* raw = PQprepare(connection, name, sql, 0, nullptr);
+        const PgResult prepared(raw);
+        if (PQresultStatus(raw) != PGRES_COMMAND_OK) {
+            throw PgError(PQerrorMessage(connection), ErrorState(raw));
+        }
+    }
+}
+
+bool AsyncPgConnection::Healthy() const {
+    // UNKNOWN si la conexión está caída, ACTIVE si nadie leyó la respuesta
+    // hasta el final, INTRANS/INERROR si quedó un BEGIN sin cerrar
+    return PQstatus(connection) == CONNECTION_OK && PQtransactionStatus(connection) == PQTRANS_IDLE;
+}
+
+void AsyncPgConnection::Reset() {
+    // PQreset abre otro socket: se suelta el viejo (lo cierra libpq) y se
+    // registra el nuevo
+    socket.release();
+    PQreset(connection);
+    if (PQstatus(connection) != CONNECTION_OK) throw PgError(PQerrorMessage(connection), "");
+
+    Prepare(); // las sentencias preparadas son de la sesión del servidor
+    PQsetnonblocking(connection, 1);
+    socket.assign(PQsocket(connection));
+}
+
+concurrency::Task<PgResult> AsyncPgConnection::QueryParams(std::string sql, PgParams params) {
+    const auto values = ToValues(params);
+    if (!PQsendQueryParams(connection, sql.c_str(), static_cast<int>(values.size()), nullptr,
+                           values.data(), nullptr, nullptr, 0)) {
+        throw PgError(PQerrorMessage(connection), "");
+    }
+    co_return co_await Collect();
+}
+
+concurrency::Task<PgResult> AsyncPgConnection::ExecuteParams(std::string statement, PgParams params) {
+    const auto values = ToValues(params);
+    if (!PQsendQueryPrepared(connection, statement.c_str(), static_cast<int>(values.size()),
+                             values.data(), nullptr, nullptr, 0)) {
+        throw PgError(PQerrorMessage(connection), "");
+    }
+    co_return co_await Collect();
+}
+
+concurrency::Task<AsyncPgConnection::Wait> AsyncPgConnection::Ready(Wait wait) {
+    if (wait == Wait::ReadOrWrite) {
+        const auto ready = co_await SocketEitherReady{socket};
+        co_return ready == asio::posix::stream_descriptor::wait_read ? Wait::Read : Wait::Write;
+    }
+    co_await SocketReady{socket,
+                         wait == Wait::Read ? asio::posix::stream_descriptor::wait_read
+                                            : asio::posix::stream_descriptor::wait_write,
+                         std::error_code{}};
+    co_return wait;
+}
+
+concurrency::Task<PgResult> AsyncPgConnection::Collect() {
+    // 1 => quedan bytes por enviar (parámetros grandes). El servidor puede
+    // responder antes de leerlo todo (p. ej. un error) y dejar de leer hasta
+    // que se le lea a él: esperar sólo escritura no terminaría nunca. Se
+    // espera lo primero que pase y, si hay algo para leer, se consume antes
+    // de volver a PQflush.
+    int pending;
+    while ((pending = PQflush(connection)) == 1) {
+        if (co_await Ready(Wait::ReadOrWrite) == Wait::Read && !PQconsumeInput(connection)) {
+            throw PgError(PQerrorMessage(connection), "");
+        }
+    }
+    if (pending < 0) throw PgError(PQerrorMessage(connection), "");
+
+    // Hay que leer hasta el PGresult nulo aunque haya error, o la conexión
+    // queda ocupada para la siguiente consulta.
+    std::optional<PgResult> last;
+    std::optional<PgError> failure;
+    while (true) {
+        while (PQisBusy(connection)) {
+            co_await Ready(Wait::Read);
+            if (!PQconsumeInput(connection)) throw PgError(PQerrorMessage(connection), "");
+        }
+
+        PGresult* raw = PQgetResult(connection);
+        if (raw == nullptr) break;
+
+        PgResult result(raw);
+        const auto status = PQresultStatus(raw);
+        if (status == PGRES_FATAL_ERROR || status == PGRES_BAD_RESPONSE) {
+            if (!failure) failure.emplace(PQresultErrorMessage(raw), ErrorState(raw));
+            continue;
+        }
+        last.emplace(std::move(result));
+    }
+
+    if (failure) throw *failure;
+    if (!last) throw PgError("query returned no result", "");
+    co_return std::move(*last);
+}
+
+AsyncPgConnectionPool::Lease::Lease(Lease&& other) noexcept
+    : pool(std::exchange(other.pool, nullptr)), connection(std::exchange(other.connection, nullptr)) {}
+
+AsyncPgConnectionPool::Lease& AsyncPgConnectionPool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        if (pool && connection) pool->Release(connection);
+        pool = std::exchange(other.pool, nullptr);
+        connection = std::exchange(other.connection, nullptr);
+    }
+    return *this;
+}
+
+AsyncPgConnectionPool::Lease::~Lease() {
+    if (pool && connection) pool->Release(connection);
+}
+
+AsyncPgConnectionPool::AsyncPgConnectionPool(asio::io_context& context, const std::string& connectionString,
+                                             std::size_t size)
+    : context(context) {
+    connections.reserve(size);
+    idle.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        connections.push_back(std::make_unique<AsyncPgConnection>(context, connectionString));
+        idle.push_back(connections.back().get());
+    }
+}
+
+concurrency::Task<AsyncPgConnectionPool::Lease> AsyncPgConnectionPool::Acquire() {
+    struct Awaiter {
+        AsyncPgConnectionPool& pool;
+        AsyncPgConnection* connection = nullptr;
+
+        bool await_ready() {
+            std::lock_guard lock(pool.mutex);
+            if (pool.idle.empty()) return false;
+            connection = pool.idle.back();
+            pool.idle.pop_back();
+            return true;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::lock_guard lock(pool.mutex);
+            // Se pudo liberar una entre await_ready y ahora
+            if (!pool.idle.empty()) {
+                connection = pool.idle.back();
+                pool.idle.pop_back();
+                return false;
+            }
+            pool.waiters.emplace_back(handle, &connection);
+            return true;
+        }
+
+        AsyncPgConnection* await_resume() const noexcept { return connection; }
+    };
+
+    AsyncPgConnection* connection = co_await Awaiter{*this};
+    co_return Lease{this, connection};
+}
+
+void AsyncPgConnectionPool::Release(AsyncPgConnection* connection) {
+    // Una conexión caída (servidor reiniciado, red) o con una consulta a
+    // medias haría fallar al próximo que la tome: se reabre antes de
+    // devolverla. Si el servidor sigue sin responder vuelve igual (el pool no
+    // se achica); la próxima consulta falla rápido y al devolverla se reintenta.
+    if (!connection->Healthy()) {
+        try {
+            connection->Reset();
+        } catch (const PgError& e) {
+            std::cerr << "[AsyncPgConnectionPool] Reconnect failed: " << e.what() << std::endl;
+        }
+    }
+
+    std::coroutine_handle<> next;
+    {
+        std::lock_guard lock(mutex);
+        if (waiters.empty()) {
+            idle.push_back(connection);
+            return;
+        }
+        auto [handle, slot] = waiters.front();
+        waiters.pop_front();
+        *slot = connection;
+        next = handle;
+    }
+    // Se reanuda desde el io_context y no dentro del destructor del préstamo
+    asio::post(context, [next] { next.resume(); });
+}
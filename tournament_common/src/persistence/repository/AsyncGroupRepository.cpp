@@ -0,0 +1,181 @@
+#include "persistence/repository/AsyncGroupRepository.hpp"
+
+#include <charconv>
+#include <nlohmann/json.hpp>
+
+namespace {
+    std::string GroupDocument(const domain::Group& group) {
+        nlohmann::json j;
+        j["name"] = group.Name();
+        return j.dump();
+    }
+
+    std::shared_ptr<domain::Group> ParseGroup(const PgResult& result, int row) {
+        auto g = std::make_shared<domain::Group>();
+        g->Id()           = result.Value(row, "id");
+        g->Name()         = result.Value(row, "name");
+        g->TournamentId() = result.Value(row, "tournament_id");
+        return g;
+    }
+
+    int ParseCount(const PgResult& result) {
+        if (result.Empty()) return 0;
+        const auto text = result.Value(0, "cnt");
+        int count = 0;
+        std::from_chars(text.data(), text.data() + text.size(), count);
+        return count;
+    }
+}
+
+AsyncGroupRepository::AsyncGroupRepository(std::shared_ptr<AsyncPgConnectionPool> pool)
+    : pool(std::move(pool)) {}
+
+concurrency::Task<std::shared_ptr<domain::Group>> AsyncGroupRepository::ReadById(std::string id) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "SELECT id, document->>'name' AS name, tournament_id "
+        "FROM groups WHERE id = $1 LIMIT 1;",
+        id);
+    co_return rs.Empty() ? nullptr : ParseGroup(rs, 0);
+}
+
+concurrency::Task<std::string> AsyncGroupRepository::Create(domain::Group entity) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = entity.Id().empty()
+        ? co_await connection->Query(
+              "INSERT INTO groups (name, tournament_id, document) "
+              "VALUES ($1, $2, $3::jsonb) "
+              "RETURNING id;",
+              entity.Name(), entity.TournamentId(), GroupDocument(entity))
+        : co_await connection->Query(
+              "INSERT INTO groups (id, name, tournament_id, document) "
+              "VALUES ($1, $2, $3, $4::jsonb) "
+              "RETURNING id;",
+              entity.Id(), entity.Name(), entity.TournamentId(), GroupDocument(entity));
+    co_return rs.Empty() ? std::string{} : std::string(rs.Value(0, "id"));
+}
+
+concurrency::Task<std::string> AsyncGroupRepository::Update(domain::Group entity) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "UPDATE groups "
+        "SET name = $2, tournament_id = $3, document = $4::jsonb "
+        "WHERE id = $1 "
+        "RETURNING id;",
+        entity.Id(), entity.Name(), entity.TournamentId(), GroupDocument(entity));
+    co_return rs.Empty() ? std::string{} : std::string(rs.Value(0, "id"));
+}
+
+concurrency::Task<void> AsyncGroupRepository::Delete(std::string id) {
+    auto connection = co_await pool->Acquire();
+    co_await connection->Query("DELETE FROM groups WHERE id = $1;", id);
+}
+
+concurrency::Task<std::vector<std::shared_ptr<domain::Group>>> AsyncGroupRepository::ReadAll() {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "SELECT id, document->>'name' AS name, tournament_id "
+        "FROM groups ORDER BY id;");
+
+    std::vector<std::shared_ptr<domain::Group>> groups;
+    groups.reserve(rs.Rows());
+    for (int row = 0; row < rs.Rows(); ++row) {
+        groups.emplace_back(ParseGroup(rs, row));
+    }
+    co_return groups;
+}
+
+concurrency::Task<std::vector<std::shared_ptr<domain::Group>>>
+AsyncGroupRepository::FindByTournamentId(std::string tournamentId) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "SELECT id, document->>'name' AS name, tournament_id "
+        "FROM groups "
+        "WHERE tournament_id = $1 "
+        "ORDER BY id;",
+        tournamentId);
+
+    std::vector<std::shared_ptr<domain::Group>> groups;
+    groups.reserve(rs.Rows());
+    for (int row = 0; row < rs.Rows(); ++row) {
+        groups.emplace_back(ParseGroup(rs, row));
+    }
+    co_return groups;
+}
+
+concurrency::Task<std::shared_ptr<domain::Group>>
+AsyncGroupRepository::FindByTournamentIdAndGroupId(std::string tournamentId, std::string groupId) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "SELECT id, document->>'name' AS name, tournament_id "
+        "FROM groups "
+        "WHERE tournament_id = $1 AND id = $2 "
+        "LIMIT 1;",
+        tournamentId, groupId);
+    co_return rs.Empty() ? nullptr : ParseGroup(rs, 0);
+}
+
+concurrency::Task<std::shared_ptr<domain::Group>>
+AsyncGroupRepository::FindByTournamentIdAndTeamId(std::string tournamentId, std::string teamId) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "SELECT g.id, g.document->>'name' AS name, g.tournament_id "
+        "FROM groups g "
+        "JOIN group_teams gt ON gt.group_id = g.id "
+        "WHERE g.tournament_id = $1 AND gt.team_id = $2 "
+        "LIMIT 1;",
+        tournamentId, teamId);
+    co_return rs.Empty() ? nullptr : ParseGroup(rs, 0);
+}
+
+concurrency::Task<void>
+AsyncGroupRepository::UpdateGroupAddTeam(std::string groupId, std::shared_ptr<domain::Team> team) {
+    auto connection = co_await pool->Acquire();
+    co_await connection->Query(
+        "INSERT INTO group_teams (group_id, team_id, team_name) "
+        "VALUES ($1, $2, $3) "
+        "ON CONFLICT DO NOTHING;",
+        groupId, team->Id, team->Name);
+}
+
+concurrency::Task<bool> AsyncGroupRepository::ExistsGroupForTournament(std::string tournamentId) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "SELECT 1 FROM groups WHERE tournament_id=$1 LIMIT 1;",
+        tournamentId);
+    co_return !rs.Empty();
+}
+
+concurrency::Task<int> AsyncGroupRepository::GroupsCountForTournament(std::string tournamentId) {
+    auto connection = co_await pool->Acquire();
+    co_return ParseCount(co_await connection->Query(
+        "SELECT COUNT(*) AS cnt FROM groups WHERE tournament_id=$1;",
+        tournamentId));
+}
+
+concurrency::Task<int> AsyncGroupRepository::CountTeamsInGroup(std::string groupId) {
+    auto connection = co_await pool->Acquire();
+    co_return ParseCount(co_await connection->Query(
+        "SELECT COUNT(*) AS cnt FROM group_teams WHERE group_id = $1;",
+        groupId));
+}
+
+concurrency::Task<std::vector<domain::Team>> AsyncGroupRepository::GetTeamsOfGroup(std::string groupId) {
+    auto connection = co_await pool->Acquire();
+    const auto rs = co_await connection->Query(
+        "SELECT team_id AS id, team_name AS name "
+        "FROM group_teams "
+        "WHERE group_id = $1 "
+        "ORDER BY team_name;",
+        groupId);
+
+    std::vector<domain::Team> out;
+    out.reserve(rs.Rows());
+    for (int row = 0; row < rs.Rows(); ++row) {
+        domain::Team t{};
+        t.Id   = rs.Value(row, "id");
+        t.Name = rs.Value(row, "name");
+        out.emplace_back(std::move(t));
+    }
+    co_return out;
+}
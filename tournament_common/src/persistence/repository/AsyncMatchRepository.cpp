@@ -0,0 +1,185 @@
+#include "persistence/repository/AsyncMatchRepository.hpp"
+
+#include <charconv>
+#include <nlohmann/json.hpp>
+
+namespace {
+    // 22xxx: data_exception (p. ej. uuid mal formado), igual que pqxx::data_exception
+    bool IsDataException(const PgError& e) {
+        return e.sqlState.starts_with("22");
+    }
+
+    std::string MatchDocument(const domain::Match& entity) {
+        nlohmann::json doc;
+        doc["tournamentId"] = entity.TournamentId;
+        doc["groupId"] = entity.GroupId;
+        doc["homeTeamId"] = entity.HomeTeamId;
+        doc["awayTeamId"] = entity.AwayTeamId;
+        doc["phase"] = domain::ToString(entity.Phase);
+        doc["round"] = entity.Round;
+
+        if (entity.HomeScore.has_value()) {
+            doc["homeScore"] = *entity.HomeScore;
+        }
+        if (entity.AwayScore.has_value()) {
+            doc["awayScore"] = *entity.AwayScore;
+        }
+        return doc.dump();
+    }
+
+    std::shared_ptr<domain::Match> ParseMatch(const PgResult& result, int row) {
+        try {
+            const auto doc = nlohmann::json::parse(result.Value(row, "document"));
+            auto match = std::make_shared<domain::Match>();
+
+            match->Id = result.Value(row, "id");
+            match->TournamentId = doc.value("tournamentId", std::string{});
+            match->GroupId = doc.value("groupId", std::string{});
+            match->HomeTeamId = doc.value("homeTeamId", std::string{});
+            match->AwayTeamId = doc.value("awayTeamId", std::string{});
+            match->Phase = domain::PhaseFromString(doc.value("phase", std::string{"RR"}));
+            match->Round = doc.value("round", 0);
+
+            const auto version = result.Value(row, "version");
+            std::from_chars(version.data(), version.data() + version.size(), match->Version);
+
+            if (doc.contains("homeScore") && !doc["homeScore"].is_null()) {
+                match->HomeScore = doc["homeScore"].get<int>();
+            }
+            if (doc.contains("awayScore") && !doc["awayScore"].is_null()) {
+                match->AwayScore = doc["awayScore"].get<int>();
+            }
+            return match;
+        } catch (const std::exception&) {
+            return nullptr;
+        }
+    }
+
+    std::vector<std::shared_ptr<domain::Match>> ParseMatches(const PgResult& result) {
+        std::vector<std::shared_ptr<domain::Match>> matches;
+        matches.reserve(result.Rows());
+        for (int row = 0; row < result.Rows(); ++row) {
+            if (auto match = ParseMatch(result, row)) {
+                matches.push_back(std::move(match));
+            }
+        }
+        return matches;
+    }
+
+    int ParseCount(const PgResult& result) {
+        if (result.Empty()) return 0;
+        const auto text = result.Value(0, 0);
+        int count = 0;
+        std::from_chars(text.data(), text.data() + text.size(), count);
+        return count;
+    }
+}
+
+AsyncMatchRepository::AsyncMatchRepository(std::shared_ptr<AsyncPgConnectionPool> pool)
+    : pool(std::move(pool)) {
+}
+
+concurrency::Task<std::shared_ptr<domain::Match>> AsyncMatchRepository::ReadById(std::string id) {
+    auto connection = co_await pool->Acquire();
+    try {
+        const auto result = co_await connection->Query("SELECT * FROM matches WHERE id = $1::uuid", id);
+        co_return result.Empty() ? nullptr : ParseMatch(result, 0);
+    } catch (const PgError& e) {
+        if (!IsDataException(e)) throw;
+    }
+    co_return nullptr;
+}
+
+concurrency::Task<std::string> AsyncMatchRepository::Create(domain::Match entity) {
+    auto connection = co_await pool->Acquire();
+    const auto result = co_await connection->Execute("insert_match", MatchDocument(entity));
+    co_return std::string(result.Value(0, "id"));
+}
+
+concurrency::Task<std::string> AsyncMatchRepository::Update(domain::Match entity) {
+    auto connection = co_await pool->Acquire();
+    co_await connection->Execute("update_match", entity.Id, MatchDocument(entity));
+    co_return entity.Id;
+}
+
+concurrency::Task<void> AsyncMatchRepository::Delete(std::string id) {
+    auto connection = co_await pool->Acquire();
+    co_await connection->Query("DELETE FROM matches WHERE id = $1::uuid", id);
+}
+
+concurrency::Task<std::vector<std::shared_ptr<domain::Match>>> AsyncMatchRepository::ReadAll() {
+    auto connection = co_await pool->Acquire();
+    const auto result = co_await connection->Query("SELECT * FROM matches");
+    co_return ParseMatches(result);
+}
+
+concurrency::Task<std::vector<std::shared_ptr<domain::Match>>>
+AsyncMatchRepository::FindByTournamentId(std::string tournamentId, MatchFilter filter) {
+    const char* statement = "select_matches_by_tournament";
+    switch (filter) {
+        case MatchFilter::Played:
+            statement = "select_matches_by_tournament_played";
+            break;
+        case MatchFilter::Pending:
+            statement = "select_matches_by_tournament_pending";
+            break;
+        default:
+            break;
+    }
+
+    auto connection = co_await pool->Acquire();
+    const auto result = co_await connection->Execute(statement, tournamentId);
+    co_return ParseMatches(result);
+}
+
+concurrency::Task<std::shared_ptr<domain::Match>>
+AsyncMatchRepository::FindByTournamentIdAndMatchId(std::string tournamentId, std::string matchId) {
+    auto connection = co_await pool->Acquire();
+    try {
+        const auto result = co_await connection->Execute("select_match_by_tournament_and_id",
+                                                         tournamentId, matchId);
+        co_return result.Empty() ? nullptr : ParseMatch(result, 0);
+    } catch (const PgError&) {
+        // Igual que MatchRepository: cualquier error => no encontrado
+    }
+    co_return nullptr;
+}
+
+concurrency::Task<bool> AsyncMatchRepository::UpdateScore(std::string matchId, int homeScore, int awayScore) {
+    auto connection = co_await pool->Acquire();
+    try {
+        const auto result = co_await connection->Execute("update_match_score", matchId, homeScore, awayScore);
+        co_return result.AffectedRows() > 0;
+    } catch (const PgError&) {
+    }
+    co_return false;
+}
+
+concurrency::Task<int> AsyncMatchRepository::CountCompletedMatchesByTournament(std::string tournamentId) {
+    auto connection = co_await pool->Acquire();
+    try {
+        co_return ParseCount(co_await connection->Execute("count_completed_matches_by_tournament", tournamentId));
+    } catch (const PgError&) {
+    }
+    co_return 0;
+}
+
+concurrency::Task<int> AsyncMatchRepository::CountTotalMatchesByTournament(std::string tournamentId) {
+    auto connection = co_await pool->Acquire();
+    try {
+        co_return ParseCount(co_await connection->Execute("count_total_matches_by_tournament", tournamentId));
+    } catch (const PgError&) {
+    }
+    co_return 0;
+}
+
+concurrency::Task<std::vector<std::shared_ptr<domain::Match>>>
+AsyncMatchRepository::FindByGroupId(std::string groupId) {
+    auto connection = co_await pool->Acquire();
+    try {
+        co_return ParseMatches(co_await connection->Execute("select_matches_by_group", groupId));
+    } catch (const PgError&) {
+        // Vector vacío ante error, como MatchRepository
+    }
+    co_return std::vector<std::shared_ptr<domain::Match>>{};
+}
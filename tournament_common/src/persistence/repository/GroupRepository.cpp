@@ -7,6 +7,10 @@
 #include <pqxx/pqxx>
 #include <nlohmann/json.hpp>
 
+#include "messaging/DomainEvents.hpp"
+#include "messaging/Topics.hpp"
+#include "persistence/repository/OutboxRepository.hpp"
+
 using std::string;
 using std::string_view;
 using std::shared_ptr;
@@ -19,8 +23,8 @@ static nlohmann::json make_group_document(const domain::Group& g) {
     return j;
 }
 
-GroupRepository::GroupRepository(const std::shared_ptr<IDbConnectionProvider>& cp)
-    : connectionProvider(cp) {}
+GroupRepository::GroupRepository(const std::shared_ptr<IDbConnectionProvider>& cp, bool writeOutbox)
+    : connectionProvider(cp), writeOutbox(writeOutbox) {}
 
 std::shared_ptr<domain::Group> GroupRepository::ReadById(std::string id) {
     auto pooled = connectionProvider->Connection();
@@ -82,6 +86,11 @@ std::string GroupRepository::Create(const domain::Group& entity) {
         );
     }
 
+    if (writeOutbox && !rs.empty()) {
+        OutboxRepository::Append(tx, {{topics::GroupCreated,
+            payloads::GroupCreated(entity.TournamentId(), rs[0]["id"].c_str(), entity.Name())}});
+    }
+
     tx.commit();
     return rs.empty() ? std::string{} : std::string(rs[0]["id"].c_str());
 }
@@ -256,17 +265,108 @@ void GroupRepository::UpdateGroupAddTeam(std::string_view groupId,
     auto* pg = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*pg->connection);
-    tx.exec(
+    auto rs = tx.exec(
         pqxx::zview{
             "INSERT INTO group_teams (group_id, team_id, team_name) "
             "VALUES ($1, $2, $3) "
-            "ON CONFLICT DO NOTHING;"
+            "ON CONFLICT DO NOTHING "
+            "RETURNING (SELECT tournament_id FROM groups WHERE id = $1) AS tournament_id;"
         },
         pqxx::params{groupId.data(), team->Id.c_str(), team->Name.c_str()}
     );
+    // Sin fila devuelta el equipo ya estaba: no hay evento que escribir
+    if (writeOutbox && !rs.empty()) {
+        OutboxRepository::Append(tx, {{topics::GroupTeamAdded,
+            payloads::GroupTeamAdded(rs[0]["tournament_id"].c_str(), groupId, *team)}});
+    }
     tx.commit();
 }
 
+std::optional<std::string>
+GroupRepository::AddTeams(std::string_view groupId,
+                          const std::vector<std::string>& teamIds,
+                          int maxTeams,
+                          std::vector<domain::Team>& outAdded) {
+    outAdded.clear();
+    if (teamIds.empty()) return std::nullopt;
+
+    auto pooled = connectionProvider->Connection();
+    auto* pg = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    try {
+        pqxx::work tx(*pg->connection);
+
+        // Serializa altas concurrentes al mismo grupo: el conteo de la
+        // sentencia siguiente ya ve lo que confirmó quien tenía el candado.
+        const auto group = tx.exec(pqxx::zview{"SELECT tournament_id FROM groups WHERE id = $1 FOR UPDATE;"},
+                                   pqxx::params{std::string(groupId)});
+
+        // Existencia (join con teams) y cupo se evalúan en la misma sentencia
+        // que inserta: o entran todos o ninguno.
+        auto rs = tx.exec(
+            pqxx::zview{
+                "WITH req AS ("
+                "  SELECT DISTINCT unnest($2::uuid[]) AS team_id), "
+                "found AS ("
+                "  SELECT t.id, t.document->>'name' AS name "
+                "  FROM req r JOIN teams t ON t.id = r.team_id), "
+                "members AS ("
+                "  SELECT COUNT(*) AS cnt FROM group_teams WHERE group_id = $1::uuid), "
+                "pending AS ("
+                "  SELECT COUNT(*) AS cnt FROM req r "
+                "  WHERE NOT EXISTS (SELECT 1 FROM group_teams gt "
+                "                    WHERE gt.group_id = $1::uuid AND gt.team_id = r.team_id)), "
+                "ins AS ("
+                "  INSERT INTO group_teams (group_id, team_id, team_name) "
+                "  SELECT $1::uuid, f.id, f.name FROM found f "
+                "  WHERE (SELECT COUNT(*) FROM found) = (SELECT COUNT(*) FROM req) "
+                "    AND ($3::int <= 0 OR (SELECT cnt FROM members) + (SELECT cnt FROM pending) <= $3::int) "
+                "  ON CONFLICT DO NOTHING "
+                "  RETURNING team_id, team_name) "
+                "SELECT (SELECT COUNT(*) FROM req) AS requested, "
+                "       (SELECT COUNT(*) FROM found) AS found, "
+                "       (SELECT cnt FROM members) AS members, "
+                "       (SELECT cnt FROM pending) AS pending, "
+                "       i.team_id, i.team_name "
+                "FROM (SELECT 1) AS one LEFT JOIN ins i ON TRUE;"
+            },
+            pqxx::params{std::string(groupId), teamIds, maxTeams}
+        );
+
+        if (rs.empty()) {
+            tx.commit();
+            return std::make_optional<std::string>("team_not_found");
+        }
+
+        // Mismo orden de validación que antes: primero cupo, luego existencia
+        const auto& summary = rs[0];
+        if (maxTeams > 0 &&
+            summary["members"].as<int>(0) + summary["pending"].as<int>(0) > maxTeams) {
+            tx.commit();
+            return std::make_optional<std::string>("group_full");
+        }
+        if (summary["found"].as<int>(0) != summary["requested"].as<int>(0)) {
+            tx.commit();
+            return std::make_optional<std::string>("team_not_found");
+        }
+
+        outAdded.reserve(rs.size());
+        for (const auto& row : rs) {
+            if (row["team_id"].is_null()) continue;
+            outAdded.push_back(domain::Team{row["team_id"].c_str(), row["team_name"].c_str()});
+        }
+        if (writeOutbox && !outAdded.empty() && !group.empty()) {
+            OutboxRepository::Append(tx, {{topics::GroupTeamsAdded,
+                payloads::GroupTeamsAdded(group[0]["tournament_id"].c_str(), groupId, outAdded)}});
+        }
+        tx.commit();
+        return std::nullopt;
+    } catch (const pqxx::data_exception&) {
+        // uuid mal formado en la lista => ese equipo no existe
+        return std::make_optional<std::string>("team_not_found");
+    }
+}
+
 bool GroupRepository::ExistsGroupForTournament(std::string_view tid) {
     auto pooled = connectionProvider->Connection();
     auto* pg = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -315,11 +415,10 @@ GroupRepository::GetTeamsOfGroup(std::string_view groupId) {
     pqxx::work tx(*pg->connection);
     auto rs = tx.exec(
         pqxx::zview{
-            "SELECT t.id, t.name "
-            "FROM group_teams gt "
-            "JOIN teams t ON t.id = gt.team_id "
-            "WHERE gt.group_id = $1 "
-            "ORDER BY t.name;"
+            "SELECT team_id AS id, team_name AS name "
+            "FROM group_teams "
+            "WHERE group_id = $1 "
+            "ORDER BY team_name;"
         },
         pqxx::params{groupId.data()}
     );
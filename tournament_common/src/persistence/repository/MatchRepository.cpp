@@ -1,10 +1,132 @@
 #include "persistence/repository/MatchRepository.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/repository/OutboxRepository.hpp"
+#include "messaging/DomainEvents.hpp"
+#include "messaging/Topics.hpp"
+#include "util/Uuid.hpp"
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+#include <unordered_set>
 #include <nlohmann/json.hpp>
 #include <pqxx/pqxx>
 
-MatchRepository::MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider)
-    : connectionProvider(connectionProvider) {
+namespace {
+    nlohmann::json MatchDocument(const domain::Match& entity) {
+        nlohmann::json doc;
+        doc["tournamentId"] = entity.TournamentId;
+        doc["groupId"] = entity.GroupId;
+        doc["homeTeamId"] = entity.HomeTeamId;
+        doc["awayTeamId"] = entity.AwayTeamId;
+        doc["phase"] = domain::ToString(entity.Phase);
+        doc["round"] = entity.Round;
+
+        if (entity.HomeScore.has_value()) {
+            doc["homeScore"] = *entity.HomeScore;
+        }
+        if (entity.AwayScore.has_value()) {
+            doc["awayScore"] = *entity.AwayScore;
+        }
+        return doc;
+    }
+
+    // Postgres devuelve el uuid en minúsculas; el id pedido puede venir en mayúsculas
+    std::string CanonicalId(std::string_view id) {
+        std::string canonical(id);
+        std::ranges::transform(canonical, canonical.begin(),
+                               [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return canonical;
+    }
+
+    struct ScoreRow {
+        std::string_view tournamentId;
+        const ScoreUpdate* update;
+        std::string id; // canónico
+    };
+
+    // Deja solo la última actualización de cada partido (como si se aplicaran
+    // en orden) y descarta ids que no son uuid: un solo cast fallido
+    // abortaría el UPDATE de todo el lote. Ordenadas por id: dos lotes que
+    // se solapan (group commit, batchScore concurrentes) toman los candados
+    // en el mismo orden y no se bloquean mutuamente.
+    std::vector<ScoreRow> LastUpdatePerMatch(std::string_view tournamentId, const std::vector<ScoreUpdate>& updates) {
+        std::unordered_map<std::string, std::size_t> position;
+        std::vector<ScoreRow> unique;
+        unique.reserve(updates.size());
+        for (const auto& update : updates) {
+            if (!util::Uuid::Parse(update.matchId)) continue;
+            auto id = CanonicalId(update.matchId);
+            auto [it, inserted] = position.try_emplace(id, unique.size());
+            if (inserted) unique.push_back({tournamentId, &update, std::move(id)});
+            else unique[it->second].update = &update;
+        }
+        std::ranges::sort(unique, {}, &ScoreRow::id);
+        return unique;
+    }
+
+    // Un solo enunciado para 1..N partidos, sin lecturas previas:
+    //   target:  los que existen en su torneo, bloqueados en orden de id (el
+    //            UPDATE ... FROM solo los tomaría en el orden del plan)
+    //   updated: los que además tienen la versión esperada (re-chequeada por
+    //            Postgres sobre la fila vigente si otra transacción la tocó)
+    // target sin updated => conflicto de versión; ausente => no encontrado.
+    std::string ScoreUpdateQuery(const std::vector<ScoreRow>& rows, pqxx::params& params) {
+        std::string query = "with v(id, tournament_id, home, away, expected) as (values ";
+        std::size_t index = 0;
+        for (const auto& row : rows) {
+            if (index > 0) query += ',';
+            query += "($" + std::to_string(index + 1) + "::uuid,$" + std::to_string(index + 2) +
+                     "::text,$" + std::to_string(index + 3) + "::int,$" + std::to_string(index + 4) +
+                     "::int,$" + std::to_string(index + 5) + "::int)";
+            params.append(row.update->matchId);
+            params.append(std::string(row.tournamentId));
+            params.append(row.update->homeScore);
+            params.append(row.update->awayScore);
+            params.append(row.update->expectedVersion);
+            index += 5;
+        }
+        query += R"()),
+        target as (
+            select m.id from MATCHES m
+            join v on m.id = v.id and m.document->>'tournamentId' = v.tournament_id
+            order by m.id
+            for update of m
+        ),
+        updated as (
+            update MATCHES m
+            set document = m.document || jsonb_build_object('homeScore', v.home, 'awayScore', v.away),
+                version = m.version + 1,
+                last_update_date = CURRENT_TIMESTAMP
+            from v join target t on t.id = v.id
+            where m.id = v.id
+            and m.document->>'tournamentId' = v.tournament_id
+            and (v.expected is null or m.version = v.expected)
+            returning m.id, m.version, m.document
+        )
+        select t.id as target_id, u.id, u.version, u.document
+        from target t left join updated u on u.id = t.id)";
+        return query;
+    }
+}
+
+MatchRepository::MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider,
+                                 ScoreGroupCommitOptions groupCommit,
+                                 bool writeOutbox)
+    : connectionProvider(connectionProvider), groupCommit(groupCommit), writeOutbox(writeOutbox) {
+    if (this->groupCommit.enabled) {
+        flusher = std::thread([this] { FlushLoop(); });
+    }
+}
+
+MatchRepository::~MatchRepository() {
+    {
+        std::lock_guard lock(pendingMutex);
+        stopping = true;
+    }
+    pendingCondition.notify_all();
+    if (flusher.joinable()) {
+        flusher.join();
+    }
 }
 
 std::shared_ptr<domain::Match> MatchRepository::ParseMatchFromRow(const pqxx::row& row) {
@@ -19,6 +141,7 @@ std::shared_ptr<domain::Match> MatchRepository::ParseMatchFromRow(const pqxx::ro
         match->AwayTeamId = doc.value("awayTeamId", std::string{});
         match->Phase = domain::PhaseFromString(doc.value("phase", std::string{"RR"}));
         match->Round = doc.value("round", 0);
+        match->Version = row["version"].as<int>(0);
         
         if (doc.contains("homeScore") && !doc["homeScore"].is_null()) {
             match->HomeScore = doc["homeScore"].get<int>();
@@ -56,20 +179,7 @@ std::shared_ptr<domain::Match> MatchRepository::ReadById(std::string id) {
 }
 
 std::string MatchRepository::Create(const domain::Match& entity) {
-    nlohmann::json doc;
-    doc["tournamentId"] = entity.TournamentId;
-    doc["groupId"] = entity.GroupId;
-    doc["homeTeamId"] = entity.HomeTeamId;
-    doc["awayTeamId"] = entity.AwayTeamId;
-    doc["phase"] = domain::ToString(entity.Phase);
-    doc["round"] = entity.Round;
-    
-    if (entity.HomeScore.has_value()) {
-        doc["homeScore"] = *entity.HomeScore;
-    }
-    if (entity.AwayScore.has_value()) {
-        doc["awayScore"] = *entity.AwayScore;
-    }
+    const nlohmann::json doc = MatchDocument(entity);
     
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -81,20 +191,7 @@ std::string MatchRepository::Create(const domain::Match& entity) {
 }
 
 std::string MatchRepository::Update(const domain::Match& entity) {
-    nlohmann::json doc;
-    doc["tournamentId"] = entity.TournamentId;
-    doc["groupId"] = entity.GroupId;
-    doc["homeTeamId"] = entity.HomeTeamId;
-    doc["awayTeamId"] = entity.AwayTeamId;
-    doc["phase"] = domain::ToString(entity.Phase);
-    doc["round"] = entity.Round;
-    
-    if (entity.HomeScore.has_value()) {
-        doc["homeScore"] = *entity.HomeScore;
-    }
-    if (entity.AwayScore.has_value()) {
-        doc["awayScore"] = *entity.AwayScore;
-    }
+    const nlohmann::json doc = MatchDocument(entity);
     
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -105,6 +202,88 @@ std::string MatchRepository::Update(const domain::Match& entity) {
     return entity.Id;
 }
 
+bool MatchRepository::CreateFixtures(std::string_view tournamentId, const std::vector<domain::Match>& matches) {
+    if (matches.empty()) return false;
+
+    std::vector<std::string> documents;
+    documents.reserve(matches.size());
+    for (const auto& match : matches) {
+        documents.push_back(MatchDocument(match).dump());
+    }
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    pqxx::work tx(*(connection->connection));
+    // El candado (por torneo, se libera en el commit) serializa a quienes
+    // generan a la vez; el NOT EXISTS deja al segundo sin insertar nada.
+    tx.exec("SELECT pg_advisory_xact_lock(hashtext($1))", pqxx::params{std::string(tournamentId)});
+    const pqxx::result result = tx.exec(R"(
+        INSERT INTO matches (document)
+        SELECT d::jsonb FROM unnest($2::text[]) AS d
+        WHERE NOT EXISTS (SELECT 1 FROM matches WHERE document->>'tournamentId' = $1)
+        RETURNING id)",
+        pqxx::params{std::string(tournamentId), documents});
+    tx.commit();
+
+    return !result.empty();
+}
+
+bool MatchRepository::ApplyScoreEffects(std::string_view consumer, std::string_view eventId,
+                                        std::string_view tournamentId, const ScoreEffects& effects) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    pqxx::work tx(*(connection->connection));
+
+    // La marca primero: una reentrega choca aquí antes de escribir nada
+    if (!eventId.empty()) {
+        const pqxx::result marked = tx.exec(
+            "INSERT INTO processed_events (consumer, event_id) VALUES ($1, $2) "
+            "ON CONFLICT DO NOTHING RETURNING event_id",
+            pqxx::params{std::string(consumer), std::string(eventId)});
+        if (marked.empty()) {
+            tx.abort();
+            return false;
+        }
+    }
+
+    // Sólo el campo que todavía tiene el placeholder: el resto del documento
+    // puede haber cambiado desde que el consumer lo leyó (marcador, otra
+    // llave) y reescribirlo entero lo pisaría. Si ya no está, no hace nada.
+    for (const auto& match : effects.advanced) {
+        tx.exec(R"(
+            UPDATE matches
+            SET document = document
+                    || CASE WHEN document->>'homeTeamId' = $2 THEN jsonb_build_object('homeTeamId', $3::text) ELSE '{}'::jsonb END
+                    || CASE WHEN document->>'awayTeamId' = $2 THEN jsonb_build_object('awayTeamId', $3::text) ELSE '{}'::jsonb END,
+                version = version + 1,
+                last_update_date = CURRENT_TIMESTAMP
+            WHERE id = $1::uuid AND $2 IN (document->>'homeTeamId', document->>'awayTeamId'))",
+            pqxx::params{match.Id, effects.placeholder, effects.winnerId});
+    }
+
+    if (!effects.playoffs.empty()) {
+        std::vector<std::string> documents;
+        documents.reserve(effects.playoffs.size());
+        for (const auto& match : effects.playoffs) {
+            documents.push_back(MatchDocument(match).dump());
+        }
+        // Mismo candado que CreateFixtures; dos eventos distintos que cierran
+        // el round robin a la vez dejan una sola llave
+        tx.exec("SELECT pg_advisory_xact_lock(hashtext($1))", pqxx::params{std::string(tournamentId)});
+        tx.exec(R"(
+            INSERT INTO matches (document)
+            SELECT d::jsonb FROM unnest($2::text[]) AS d
+            WHERE NOT EXISTS (
+                SELECT 1 FROM matches
+                WHERE document->>'tournamentId' = $1 AND document->>'phase' = 'KO'
+            ))",
+            pqxx::params{std::string(tournamentId), documents});
+    }
+
+    tx.commit();
+    return true;
+}
+
 void MatchRepository::Delete(std::string id) {
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -191,6 +370,89 @@ MatchRepository::FindByTournamentIdAndMatchId(std::string_view tournamentId, std
     }
 }
 
+ScoreUpdateOutcome
+MatchRepository::UpdateScoreReturning(std::string_view tournamentId, const ScoreUpdate& update) {
+    if (!util::Uuid::Parse(update.matchId)) {
+        return std::unexpected(ScoreUpdateError::NotFound);
+    }
+
+    if (groupCommit.enabled) {
+        std::future<ScoreUpdateOutcome> outcome;
+        {
+            std::lock_guard lock(pendingMutex);
+            if (!stopping) {
+                pending.push_back(PendingScore{std::string(tournamentId), update, {}});
+                outcome = pending.back().result.get_future();
+            }
+        }
+        if (outcome.valid()) {
+            pendingCondition.notify_one();
+            return outcome.get();
+        }
+    }
+
+    pqxx::params params;
+    const std::string query = ScoreUpdateQuery({{tournamentId, &update, CanonicalId(update.matchId)}}, params);
+    auto outcomes = RunScoreUpdate(query, params);
+    if (outcomes.empty()) {
+        return std::unexpected(ScoreUpdateError::NotFound);
+    }
+    return std::move(outcomes.begin()->second);
+}
+
+std::vector<std::shared_ptr<domain::Match>>
+MatchRepository::UpdateScores(std::string_view tournamentId, const std::vector<ScoreUpdate>& updates) {
+    const auto rows = LastUpdatePerMatch(tournamentId, updates);
+
+    std::vector<std::shared_ptr<domain::Match>> matches;
+    if (rows.empty()) {
+        return matches;
+    }
+
+    pqxx::params params;
+    const std::string query = ScoreUpdateQuery(rows, params);
+    auto outcomes = RunScoreUpdate(query, params);
+
+    matches.reserve(outcomes.size());
+    for (auto& [id, outcome] : outcomes) {
+        if (outcome && *outcome) {
+            matches.push_back(std::move(*outcome));
+        }
+    }
+    return matches;
+}
+
+std::unordered_map<std::string, ScoreUpdateOutcome>
+MatchRepository::RunScoreUpdate(const std::string& query, const pqxx::params& params) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(query, params);
+
+    std::unordered_map<std::string, ScoreUpdateOutcome> outcomes;
+    outcomes.reserve(result.size());
+    std::vector<OutboxEvent> events;
+    for (const auto& row : result) {
+        if (row["id"].is_null()) {
+            outcomes.emplace(row["target_id"].c_str(), std::unexpected(ScoreUpdateError::VersionConflict));
+            continue;
+        }
+        auto match = ParseMatchFromRow(row);
+        if (writeOutbox && match) {
+            events.push_back({topics::MatchScoreUpdated,
+                payloads::MatchScoreUpdated(match->TournamentId, match->Id, *match,
+                                            match->HomeScore.value_or(0), match->AwayScore.value_or(0))});
+        }
+        outcomes.emplace(row["target_id"].c_str(), std::move(match));
+    }
+
+    // Todo el lote (incluido el group commit) lleva sus eventos en el mismo commit
+    OutboxRepository::Append(tx, events);
+    tx.commit();
+    return outcomes;
+}
+
 bool MatchRepository::UpdateScore(std::string_view matchId, int homeScore, int awayScore) {
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
@@ -278,4 +540,69 @@ MatchRepository::FindByGroupId(std::string_view groupId) {
     return matches;
 }
 
+void MatchRepository::FlushLoop() {
+    std::vector<PendingScore> batch;
+    batch.reserve(groupCommit.maxBatchSize);
+    std::unordered_set<std::string> batchIds;
+
+    while (true) {
+        {
+            std::unique_lock lock(pendingMutex);
+            pendingCondition.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty()) {
+                return; // stopping y sin trabajo pendiente
+            }
+
+            // Ventana corta para juntar los PATCH que llegan casi a la vez
+            if (!stopping && pending.size() < groupCommit.maxBatchSize) {
+                pendingCondition.wait_for(lock, groupCommit.flushInterval, [this] {
+                    return stopping || pending.size() >= groupCommit.maxBatchSize;
+                });
+            }
+
+            // Un partido repetido espera al siguiente lote: así cada PATCH ve la
+            // versión que dejó el anterior, igual que si fueran uno tras otro.
+            for (auto it = pending.begin(); it != pending.end() && batch.size() < groupCommit.maxBatchSize;) {
+                if (batchIds.insert(CanonicalId(it->update.matchId)).second) {
+                    batch.push_back(std::move(*it));
+                    it = pending.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        FlushBatch(batch);
+        batch.clear();
+        batchIds.clear();
+    }
+}
+
+void MatchRepository::FlushBatch(std::vector<PendingScore>& batch) {
+    std::vector<ScoreRow> rows;
+    rows.reserve(batch.size());
+    for (const auto& item : batch) {
+        rows.push_back({item.tournamentId, &item.update, CanonicalId(item.update.matchId)});
+    }
+    // Mismo orden de candados que UpdateScores (ver LastUpdatePerMatch)
+    std::ranges::sort(rows, {}, &ScoreRow::id);
 
+    try {
+        pqxx::params params;
+        const std::string query = ScoreUpdateQuery(rows, params);
+        auto outcomes = RunScoreUpdate(query, params);
+
+        for (auto& item : batch) {
+            auto it = outcomes.find(CanonicalId(item.update.matchId));
+            if (it == outcomes.end()) {
+                item.result.set_value(std::unexpected(ScoreUpdateError::NotFound));
+            } else {
+                item.result.set_value(std::move(it->second));
+            }
+        }
+    } catch (...) {
+        for (auto& item : batch) {
+            item.result.set_exception(std::current_exception());
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "persistence/repository/OutboxRepository.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+
+OutboxRepository::OutboxRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider)
+    : connectionProvider(connectionProvider) {}
+
+void OutboxRepository::Append(pqxx::transaction_base& tx, const std::vector<OutboxEvent>& events) {
+    if (events.empty()) return;
+
+    std::vector<std::string> topics;
+    std::vector<std::string> payloads;
+    topics.reserve(events.size());
+    payloads.reserve(events.size());
+    for (const auto& event : events) {
+        topics.push_back(event.topic);
+        payloads.push_back(event.payload.dump());
+    }
+
+    // WITH ORDINALITY: los ids salen en el orden en que se generaron los eventos
+    tx.exec(
+        pqxx::zview{
+            "INSERT INTO outbox (topic, payload) "
+            "SELECT e.topic, e.payload::jsonb "
+            "FROM unnest($1::text[], $2::text[]) WITH ORDINALITY AS e(topic, payload, n) "
+            "ORDER BY e.n;"
+        },
+        pqxx::params{topics, payloads}
+    );
+}
+
+std::size_t
+OutboxRepository::PublishPending(std::size_t limit,
+                                 const std::function<void(const std::vector<OutboxRecord>&)>& publish) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    // Las filas quedan bloqueadas mientras se publican: otro relay salta a las
+    // siguientes en vez de esperar o publicarlas dos veces.
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result rs = tx.exec(
+        pqxx::zview{
+            "SELECT id, topic, payload::text AS payload "
+            "FROM outbox "
+            "ORDER BY id "
+            "LIMIT $1 "
+            "FOR UPDATE SKIP LOCKED;"
+        },
+        pqxx::params{static_cast<std::int64_t>(limit)}
+    );
+    if (rs.empty()) {
+        tx.commit();
+        return 0;
+    }
+
+    std::vector<OutboxRecord> records;
+    std::vector<std::int64_t> ids;
+    records.reserve(rs.size());
+    ids.reserve(rs.size());
+    for (const auto& row : rs) {
+        records.push_back(OutboxRecord{row["id"].as<std::int64_t>(), row["topic"].c_str(), row["payload"].c_str()});
+        ids.push_back(records.back().id);
+    }
+
+    publish(records); // si lanza, el rollback de tx devuelve las filas
+
+    tx.exec(pqxx::zview{"DELETE FROM outbox WHERE id = ANY($1::bigint[]);"}, pqxx::params{ids});
+    tx.commit();
+    return records.size();
+}
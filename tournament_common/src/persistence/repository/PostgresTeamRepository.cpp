@@ -0,0 +1,222 @@
+#include "persistence/repository/PostgresTeamRepository.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+
+#include <unordered_map>
+#include <pqxx/pqxx>
+
+static std::string make_team_document(const domain::Team& team) {
+    return nlohmann::json{{"name", team.Name}}.dump();
+}
+
+PostgresTeamRepository::PostgresTeamRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider,
+                                               TeamWriteBehindOptions options)
+    : connectionProvider(std::move(connectionProvider)), options(options) {
+    if (this->options.enabled) {
+        flusher = std::thread([this] { FlushLoop(); });
+    }
+}
+
+PostgresTeamRepository::~PostgresTeamRepository() {
+    {
+        std::lock_guard lock(pendingMutex);
+        stopping = true;
+    }
+    pendingCondition.notify_all();
+    if (flusher.joinable()) {
+        flusher.join();
+    }
+}
+
+std::shared_ptr<domain::Team> PostgresTeamRepository::ReadById(std::string id) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = tx.exec(pqxx::prepped{"select_team_by_id"}, pqxx::params{id});
+        tx.commit();
+
+        if (result.empty()) {
+            return nullptr;
+        }
+
+        const auto document = nlohmann::json::parse(result[0]["document"].c_str());
+        auto team = std::make_shared<domain::Team>();
+        team->Id = result[0]["id"].c_str();
+        team->Name = document.value("name", std::string{});
+        return team;
+    } catch (const pqxx::data_exception& e) {
+        // Invalid UUID format
+        return nullptr;
+    }
+}
+
+std::string PostgresTeamRepository::Create(const domain::Team& entity) {
+    if (!options.enabled) {
+        return InsertOne(entity);
+    }
+
+    std::future<std::string> created;
+    {
+        std::lock_guard lock(pendingMutex);
+        if (stopping) {
+            return InsertOne(entity);
+        }
+        pending.push_back(PendingInsert{entity, {}});
+        created = pending.back().result.get_future();
+    }
+    pendingCondition.notify_one();
+
+    return created.get();
+}
+
+std::string PostgresTeamRepository::InsertOne(const domain::Team& entity) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{"insert_team"}, pqxx::params{make_team_document(entity)});
+    tx.commit();
+
+    return result[0]["id"].c_str();
+}
+
+std::string PostgresTeamRepository::Update(const domain::Team& entity) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    try {
+        pqxx::work tx(*(connection->connection));
+        const pqxx::result result = tx.exec(pqxx::prepped{"update_team"},
+                                            pqxx::params{make_team_document(entity), entity.Id});
+        tx.commit();
+
+        return result.empty() ? std::string{} : std::string(result[0]["id"].c_str());
+    } catch (const pqxx::data_exception& e) {
+        return {};
+    }
+}
+
+void PostgresTeamRepository::Delete(std::string id) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    tx.exec("DELETE FROM teams WHERE id = $1::uuid", pqxx::params{id});
+    tx.commit();
+}
+
+std::vector<std::shared_ptr<domain::Team>> PostgresTeamRepository::ReadAll() {
+    std::vector<std::shared_ptr<domain::Team>> teams;
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result{tx.exec("select id, document->>'name' as name from teams")};
+    tx.commit();
+
+    teams.reserve(result.size());
+    for (const auto& row : result) {
+        teams.push_back(std::make_shared<domain::Team>(domain::Team{row["id"].c_str(), row["name"].c_str()}));
+    }
+
+    return teams;
+}
+
+void PostgresTeamRepository::FlushLoop() {
+    std::vector<PendingInsert> batch;
+    batch.reserve(options.maxBatchSize);
+
+    while (true) {
+        {
+            std::unique_lock lock(pendingMutex);
+            pendingCondition.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty()) {
+                return; // stopping y sin trabajo pendiente
+            }
+
+            // Ventana corta para que la ráfaga termine de llegar antes de cortar el lote
+            if (!stopping && pending.size() < options.maxBatchSize) {
+                pendingCondition.wait_for(lock, options.flushInterval, [this] {
+                    return stopping || pending.size() >= options.maxBatchSize;
+                });
+            }
+
+            while (!pending.empty() && batch.size() < options.maxBatchSize) {
+                batch.push_back(std::move(pending.front()));
+                pending.pop_front();
+            }
+        }
+
+        FlushBatch(batch);
+        batch.clear();
+    }
+}
+
+void PostgresTeamRepository::FlushBatch(std::vector<PendingInsert>& batch) {
+    std::vector<domain::Team> teams;
+    teams.reserve(batch.size());
+    for (auto& item : batch) {
+        teams.push_back(std::move(item.team));
+    }
+
+    try {
+        auto ids = InsertMany(teams);
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            batch[i].result.set_value(std::move(ids[i]));
+        }
+    } catch (...) {
+        for (auto& item : batch) {
+            item.result.set_exception(std::current_exception());
+        }
+    }
+}
+
+std::vector<std::string> PostgresTeamRepository::CreateMany(const std::vector<domain::Team>& entities) {
+    // Ya es una sola sentencia: no pasa por la cola del write-behind
+    if (entities.empty()) {
+        return {};
+    }
+    return InsertMany(entities);
+}
+
+std::vector<std::string> PostgresTeamRepository::InsertMany(const std::vector<domain::Team>& entities) {
+    // insert into teams (document) values ($1),($2),... on conflict do nothing returning id, name
+    std::string query = "insert into TEAMS (document) values ";
+    pqxx::params params;
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        if (i > 0) query += ',';
+        query += "($" + std::to_string(i + 1) + "::jsonb)";
+        params.append(make_team_document(entities[i]));
+    }
+    query += " on conflict do nothing returning id, document->>'name' as name";
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(query, params);
+    tx.commit();
+
+    std::unordered_map<std::string, std::string> createdByName;
+    createdByName.reserve(result.size());
+    for (const auto& row : result) {
+        createdByName.emplace(row["name"].c_str(), row["id"].c_str());
+    }
+
+    // Los nombres que no regresaron chocaron con el índice único (o con otro
+    // elemento del mismo lote): id vacío => duplicado para la capa superior.
+    std::vector<std::string> ids;
+    ids.reserve(entities.size());
+    for (const auto& entity : entities) {
+        auto it = createdByName.find(entity.Name);
+        if (it == createdByName.end()) {
+            ids.emplace_back();
+            continue;
+        }
+        ids.push_back(std::move(it->second));
+        createdByName.erase(it);
+    }
+    return ids;
+}
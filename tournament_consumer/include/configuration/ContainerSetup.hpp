@@ -9,25 +9,40 @@
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <memory>
-#include <print>
 
 #include "configuration/DatabaseConfiguration.hpp"
 #include "cms/ConnectionManager.hpp"
+#include "cms/DeadLetterSender.hpp"
 #include "persistence/repository/IRepository.hpp"
-#include "persistence/repository/TeamRepository.hpp"
+#include "persistence/repository/PostgresTeamRepository.hpp"
 #include "persistence/repository/MatchRepository.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
 #include "persistence/repository/IGroupRepository.hpp"
 #include "persistence/configuration/PostgresConnectionProvider.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
-#include "cms/QueueMessageConsumer.hpp"
+#include "cms/LiveEventPublisher.hpp"
 #include "consumer/MatchGenerationConsumer.hpp"
 #include "consumer/ScoreProcessingConsumer.hpp"
+#include "consumer/PartitionedDispatcher.hpp"
+#include "consumer/GroupDebouncer.hpp"
+#include "consumer/ProcessedEventCache.hpp"
+#include "consumer/RetryScheduler.hpp"
+#include "consumer/ConsumerMetrics.hpp"
+#include "consumer/MetricsEndpoint.hpp"
+#include "consumer/QueueSubscription.hpp"
 #include "domain/Team.hpp"
 #include "domain/Tournament.hpp"
 
 namespace config {
+    // El colector no mantiene vivo al componente
+    template<typename Component>
+    void AddCollector(ConsumerMetrics& metrics, const std::shared_ptr<Component>& component) {
+        metrics.AddCollector([weak = std::weak_ptr<Component>(component)](std::string& out) {
+            if (auto live = weak.lock()) live->RenderMetrics(out);
+        });
+    }
+
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
         Hypodermic::ContainerBuilder builder;
 
@@ -35,26 +50,96 @@ namespace config {
         nlohmann::json configuration;
         file >> configuration;
 
-        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(configuration["databaseConfig"]["connectionString"].get<std::string>(), configuration["databaseConfig"]["poolSize"].get<size_t>());
+        // Con acquireTimeoutMs un pool saturado falla (y el mensaje se reintenta) en vez de esperar sin límite
+        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
+            configuration["databaseConfig"]["connectionString"].get<std::string>(),
+            configuration["databaseConfig"]["poolSize"].get<size_t>(),
+            std::chrono::milliseconds(configuration["databaseConfig"].value("acquireTimeoutMs", 0)));
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
+        // GET /metrics local; cada componente agrega lo suyo como colector
+        auto consumerMetrics = std::make_shared<ConsumerMetrics>();
+        builder.registerInstance(consumerMetrics);
+        const auto metricsOptions = configuration.value("metrics", nlohmann::json::object()).get<MetricsOptions>();
+        builder.registerInstance(std::make_shared<MetricsEndpoint>(consumerMetrics, metricsOptions));
+        consumerMetrics->AddCollector([weak = std::weak_ptr<PostgresConnectionProvider>(postgressConnection)](std::string& out) {
+            if (auto live = weak.lock()) ConsumerMetrics::RenderPool(out, live->Telemetry());
+        });
+
         builder.registerType<ConnectionManager>()
             .onActivated([configuration](Hypodermic::ComponentContext& context, const std::shared_ptr<ConnectionManager>& instance) {
                 instance->initialize(configuration["activemq"]["broker-url"].get<std::string>());
             })
             .singleInstance();
 
-        builder.registerType<QueueMessageConsumer>();
-
         // Repositories
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string_view>>().singleInstance();
+        builder.registerType<PostgresTeamRepository>().as<ITeamRepository>().singleInstance();
         builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string>>().singleInstance();
         builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
         builder.registerType<GroupRepository>().as<IGroupRepository>().singleInstance();
 
         // Consumers
         builder.registerType<MatchGenerationConsumer>().singleInstance();
-        builder.registerType<ScoreProcessingConsumer>().singleInstance();
+        builder.registerInstanceFactory([consumerMetrics](Hypodermic::ComponentContext& context) {
+                auto publisher = std::make_shared<LiveEventPublisher>(context.resolve<ConnectionManager>());
+                AddCollector(*consumerMetrics, publisher);
+                return publisher;
+            })
+            .as<ILiveEventPublisher>()
+            .singleInstance();
+        builder.registerType<ScoreProcessingConsumer>()
+            .onActivated([](Hypodermic::ComponentContext& context, const std::shared_ptr<ScoreProcessingConsumer>& instance) {
+                instance->UseLiveEvents(context.resolve<ILiveEventPublisher>());
+            })
+            .singleInstance();
+
+        // Hilos de proceso: conviene databaseConfig.poolSize >= workers
+        auto dispatcher = std::make_shared<PartitionedDispatcher>(
+            configuration.value("dispatcher", nlohmann::json::object()).get<DispatcherOptions>());
+        builder.registerInstance(dispatcher);
+        AddCollector(*consumerMetrics, dispatcher);
+
+        auto processed = std::make_shared<ProcessedEventCache>(
+            configuration.value("dedup", nlohmann::json::object()).get<DedupOptions>());
+        builder.registerInstance(processed);
+        AddCollector(*consumerMetrics, processed);
+
+        // Reintentos y DLQ de los mensajes que fallan
+        const auto retryOptions = configuration.value("retry", nlohmann::json::object()).get<RetryOptions>();
+        auto retries = std::make_shared<RetryScheduler>(retryOptions);
+        builder.registerInstance(retries);
+        AddCollector(*consumerMetrics, retries);
+        builder.registerInstanceFactory([retryOptions](Hypodermic::ComponentContext& context) {
+            return std::make_shared<DeadLetterSender>(context.resolve<ConnectionManager>(), retryOptions.deadLetterPrefix);
+        }).singleInstance();
+
+        // Ráfagas de team_added del mismo grupo => una evaluación
+        const auto debounceOptions = configuration.value("matchGeneration", nlohmann::json::object()).get<DebounceOptions>();
+        builder.registerInstanceFactory([debounceOptions, consumerMetrics](Hypodermic::ComponentContext& context) {
+            auto consumer = context.resolve<MatchGenerationConsumer>();
+            auto& timings = consumerMetrics->Handler("MatchGenerationConsumer::EvaluateGroup");
+            auto debouncer = std::make_shared<GroupDebouncer>(
+                context.resolve<PartitionedDispatcher>(),
+                debounceOptions,
+                [consumer, consumerMetrics, &timings](const std::string& tournamentId, const std::string& groupId) {
+                    consumerMetrics->Time(timings, [&] { consumer->EvaluateGroup(tournamentId, groupId); });
+                });
+            AddCollector(*consumerMetrics, debouncer);
+            return debouncer;
+        }).singleInstance();
+
+        // Lo que comparten las suscripciones de main.cpp (una por cola)
+        const auto subscriptionOptions = configuration.value("subscription", nlohmann::json::object()).get<SubscriptionOptions>();
+        builder.registerInstanceFactory([subscriptionOptions](Hypodermic::ComponentContext& context) {
+            return std::make_shared<SubscriptionRuntime>(SubscriptionRuntime{
+                context.resolve<ConnectionManager>(),
+                context.resolve<PartitionedDispatcher>(),
+                context.resolve<ProcessedEventCache>(),
+                context.resolve<RetryScheduler>(),
+                context.resolve<DeadLetterSender>(),
+                context.resolve<ConsumerMetrics>(),
+                subscriptionOptions});
+        }).singleInstance();
 
         return builder.build();
     }
@@ -0,0 +1,119 @@
+#ifndef CONSUMER_CONSUMER_METRICS_HPP
+#define CONSUMER_CONSUMER_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "metrics/LatencyHistogram.hpp"
+#include "persistence/configuration/PoolTelemetry.hpp"
+
+struct MetricsOptions {
+    // GET /metrics sólo en la máquina; 0 => sin endpoint. Dentro de un
+    // contenedor 127.0.0.1 no se alcanza desde fuera: ahí va 0.0.0.0
+    std::string bindAddress = "127.0.0.1";
+    std::uint16_t port = 9464;
+};
+
+inline void from_json(const nlohmann::json& json, MetricsOptions& options) {
+    options.bindAddress = json.value("bindAddress", std::string("127.0.0.1"));
+    options.port = json.value("port", static_cast<std::uint16_t>(9464));
+}
+
+// Histograma que escriben varios workers a la vez: fetch_add relajado. Son
+// pocos hilos y un mensaje cuesta milisegundos, así que no hace falta un
+// shard por hilo como en MetricsRegistry de tournament_services.
+class SharedHistogram {
+    std::array<std::atomic<std::uint64_t>, metrics::kBucketCount> buckets{};
+    std::atomic<std::uint64_t> sumMicros{0};
+
+public:
+    void Record(std::chrono::microseconds elapsed);
+    [[nodiscard]] metrics::HistogramSnapshot Read() const;
+};
+
+// Métricas de tournament_consumer para GET /metrics (formato Prometheus):
+// contadores y lag por cola (los alimenta QueueSubscription), duración por
+// handler (Time) y lo que agreguen los colectores (dispatcher, reintentos...).
+class ConsumerMetrics {
+public:
+    struct QueueCounters {
+        explicit QueueCounters(std::string queue) : queue(std::move(queue)) {}
+
+        const std::string queue;
+        std::atomic<std::uint64_t> received{0};
+        std::atomic<std::uint64_t> processed{0};
+        std::atomic<std::uint64_t> failed{0};      // intentos fallidos
+        std::atomic<std::uint64_t> retried{0};
+        std::atomic<std::uint64_t> deadLettered{0};
+        std::atomic<std::uint64_t> duplicates{0};
+        // Recibidos y todavía sin confirmar (en el dispatcher, en el
+        // debouncer o esperando reintento)
+        std::atomic<std::int64_t> inFlight{0};
+        // Desde que el productor envió (JMSTimestamp) hasta que un worker lo toma
+        SharedHistogram lag;
+        std::atomic<std::int64_t> lastLagMillis{0};
+    };
+
+    struct HandlerTimings {
+        explicit HandlerTimings(std::string handler) : handler(std::move(handler)) {}
+
+        const std::string handler;
+        SharedHistogram duration;
+        std::atomic<std::uint64_t> errors{0};
+    };
+
+    ConsumerMetrics() = default;
+    ConsumerMetrics(const ConsumerMetrics&) = delete;
+    ConsumerMetrics& operator=(const ConsumerMetrics&) = delete;
+
+    // Una entrada por nombre; la referencia vale mientras viva el registro
+    QueueCounters& Queue(std::string_view queue);
+    HandlerTimings& Handler(std::string_view handler);
+
+    // Corre `work` midiendo su duración en el histograma de `handler`; si
+    // lanza, cuenta el error y la excepción sigue su camino
+    template<typename Work>
+    void Time(HandlerTimings& handler, Work&& work) {
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            std::forward<Work>(work)();
+        } catch (...) {
+            handler.errors.fetch_add(1, std::memory_order_relaxed);
+            handler.duration.Record(Since(start));
+            throw;
+        }
+        handler.duration.Record(Since(start));
+    }
+
+    void AddCollector(std::function<void(std::string&)> collector);
+
+    [[nodiscard]] std::string Render() const;
+
+    // Una línea para el log periódico de main.cpp
+    [[nodiscard]] std::string Summary() const;
+
+    static void RenderPool(std::string& out, const PoolTelemetry::Snapshot& pool);
+
+private:
+    static std::chrono::microseconds Since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    mutable std::mutex mutex;
+    std::deque<QueueCounters> queues;     // deque: no mueve lo ya creado
+    std::deque<HandlerTimings> handlers;
+    std::vector<std::function<void(std::string&)>> collectors;
+};
+
+#endif // CONSUMER_CONSUMER_METRICS_HPP
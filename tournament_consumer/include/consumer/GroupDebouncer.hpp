@@ -0,0 +1,83 @@
+#ifndef CONSUMER_GROUP_DEBOUNCER_HPP
+#define CONSUMER_GROUP_DEBOUNCER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "consumer/PartitionedDispatcher.hpp"
+
+struct DebounceOptions {
+    // Ventana desde el primer evento del grupo; 0 => evaluar cada evento
+    std::chrono::milliseconds window{200};
+};
+
+inline void from_json(const nlohmann::json& json, DebounceOptions& options) {
+    options.window = std::chrono::milliseconds(json.value("debounceMs", 200));
+    if (options.window.count() < 0) options.window = std::chrono::milliseconds(0);
+}
+
+// Junta las altas de un mismo grupo que llegan dentro de la ventana y corre
+// una sola evaluación por ráfaga (un lote de 32 equipos => 1 evaluación, no
+// 32). La ventana cuenta desde el primer evento: un flujo constante no puede
+// posponer la evaluación para siempre. La evaluación va al worker del torneo
+// y los acks de todos los mensajes agrupados se mandan después de ella, con
+// el error de la evaluación si falló (cada mensaje se reintenta por su lado).
+class GroupDebouncer {
+public:
+    using Ack = std::function<void(std::exception_ptr error)>;
+    using Evaluate = std::function<void(const std::string& tournamentId, const std::string& groupId)>;
+
+    struct Stats {
+        std::uint64_t received = 0;
+        std::uint64_t evaluations = 0;
+    };
+
+    GroupDebouncer(std::shared_ptr<PartitionedDispatcher> dispatcher, DebounceOptions options, Evaluate evaluate);
+    ~GroupDebouncer(); // evalúa lo pendiente antes de salir
+
+    GroupDebouncer(const GroupDebouncer&) = delete;
+    GroupDebouncer& operator=(const GroupDebouncer&) = delete;
+
+    void Submit(const std::string& tournamentId, const std::string& groupId, Ack ack);
+
+    // Evalúa ya todos los grupos pendientes (apagado)
+    void Flush();
+
+    [[nodiscard]] Stats GetStats() const;
+
+    // Formato de texto de Prometheus, para anexar a GET /metrics
+    void RenderMetrics(std::string& out) const;
+
+private:
+    struct Pending {
+        std::string tournamentId;
+        std::chrono::steady_clock::time_point deadline;
+        std::vector<Ack> acks;
+    };
+
+    void TimerLoop();
+    void Fire(const std::string& groupId, Pending pending);
+
+    std::shared_ptr<PartitionedDispatcher> dispatcher;
+    DebounceOptions options;
+    Evaluate evaluate;
+
+    mutable std::mutex mutex;
+    std::condition_variable changed;
+    std::unordered_map<std::string, Pending> pending;
+    bool stopping = false;
+    Stats stats;
+    std::thread timer;
+};
+
+#endif // CONSUMER_GROUP_DEBOUNCER_HPP
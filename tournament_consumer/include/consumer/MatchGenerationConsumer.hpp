@@ -22,14 +22,14 @@ public:
         std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepo
     );
 
-    // Handle team_added event
+    // Handle team_added / teams_added event (sólo usa tournamentId y groupId)
     void Handle(const nlohmann::json& eventJson);
 
-private:
-    void GenerateMatchesForGroup(const std::string& tournamentId, const std::string& groupId);
-    bool ShouldGenerateMatches(const std::string& groupId, int maxTeamsPerGroup);
+    // Una evaluación por grupo (main.cpp agrupa la ráfaga con GroupDebouncer):
+    // si el grupo está lleno genera el fixture; CreateFixtures garantiza que
+    // sólo la primera evaluación que lo ve lleno lo inserta.
+    // Los errores se propagan para que el mensaje se reintente.
+    void EvaluateGroup(const std::string& tournamentId, const std::string& groupId);
 };
 
 #endif // CONSUMER_MATCH_GENERATION_CONSUMER_HPP
-
-
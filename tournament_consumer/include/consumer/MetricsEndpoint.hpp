@@ -0,0 +1,34 @@
+#ifndef CONSUMER_METRICS_ENDPOINT_HPP
+#define CONSUMER_METRICS_ENDPOINT_HPP
+
+#include <future>
+#include <memory>
+#include <string>
+#include <crow.h>
+
+#include "consumer/ConsumerMetrics.hpp"
+
+// GET /metrics del consumer (formato Prometheus) en un puerto local, con un
+// solo hilo de Crow: no comparte nada con el procesamiento de mensajes.
+class MetricsEndpoint {
+public:
+    MetricsEndpoint(std::shared_ptr<ConsumerMetrics> metrics, MetricsOptions options);
+    ~MetricsEndpoint(); // Stop
+
+    MetricsEndpoint(const MetricsEndpoint&) = delete;
+    MetricsEndpoint& operator=(const MetricsEndpoint&) = delete;
+
+    // false => deshabilitado (port 0) o no arrancó a tiempo (se registra)
+    bool Start();
+    void Stop();
+
+    [[nodiscard]] std::string Address() const { return options.bindAddress + ":" + std::to_string(options.port); }
+
+private:
+    std::shared_ptr<ConsumerMetrics> metrics;
+    MetricsOptions options;
+    crow::SimpleApp app;
+    std::future<void> server;
+};
+
+#endif // CONSUMER_METRICS_ENDPOINT_HPP
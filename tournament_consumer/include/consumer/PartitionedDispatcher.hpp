@@ -0,0 +1,77 @@
+#ifndef CONSUMER_PARTITIONED_DISPATCHER_HPP
+#define CONSUMER_PARTITIONED_DISPATCHER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+struct DispatcherOptions {
+    std::size_t workers = 4;
+    // Mensajes en espera por worker; lleno => el receptor deja de leer del broker
+    std::size_t queueCapacity = 256;
+};
+
+inline void from_json(const nlohmann::json& json, DispatcherOptions& options) {
+    options.workers = json.value("workers", static_cast<std::size_t>(4));
+    options.queueCapacity = json.value("queueCapacity", static_cast<std::size_t>(256));
+    if (options.workers == 0) options.workers = 1;
+    if (options.queueCapacity == 0) options.queueCapacity = 1;
+}
+
+// Reparte el trabajo en N hilos según un hash de la clave (tournamentId): los
+// eventos de un mismo torneo se procesan en orden y en un solo hilo; torneos
+// distintos avanzan en paralelo y uno lento ya no frena a los demás.
+class PartitionedDispatcher {
+public:
+    using Work = std::move_only_function<void()>;
+
+    explicit PartitionedDispatcher(DispatcherOptions options);
+    ~PartitionedDispatcher(); // termina lo encolado antes de salir
+
+    PartitionedDispatcher(const PartitionedDispatcher&) = delete;
+    PartitionedDispatcher& operator=(const PartitionedDispatcher&) = delete;
+
+    // Bloquea mientras la cola del worker de esa clave esté llena.
+    // false => el dispatcher ya se detuvo y el trabajo no se aceptó.
+    bool Dispatch(std::string_view partitionKey, Work work);
+
+    enum class TryResult { Accepted, Full, Stopped };
+
+    // Como Dispatch pero sin esperar: con la cola llena devuelve Full y
+    // `work` queda intacto para volver a intentarlo. Sólo se mueve si Accepted.
+    TryResult TryDispatch(std::string_view partitionKey, Work& work);
+
+    [[nodiscard]] std::size_t WorkerFor(std::string_view partitionKey) const;
+    [[nodiscard]] std::size_t Workers() const { return partitions.size(); }
+    [[nodiscard]] std::size_t Pending(std::size_t worker);
+
+    // Formato de texto de Prometheus, para anexar a GET /metrics
+    void RenderMetrics(std::string& out) const;
+
+    void Stop();
+
+private:
+    struct Partition {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque<Work> queue;
+        bool stopping = false;
+        std::thread thread;
+    };
+
+    void Run(Partition& partition);
+
+    std::size_t queueCapacity;
+    std::vector<std::unique_ptr<Partition>> partitions;
+};
+
+#endif // CONSUMER_PARTITIONED_DISPATCHER_HPP
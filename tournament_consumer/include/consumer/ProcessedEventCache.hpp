@@ -0,0 +1,56 @@
+#ifndef CONSUMER_PROCESSED_EVENT_CACHE_HPP
+#define CONSUMER_PROCESSED_EVENT_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+struct DedupOptions {
+    // Eventos recordados en memoria; 0 => sin caché (sólo processed_events)
+    std::size_t cacheSize = 10000;
+};
+
+inline void from_json(const nlohmann::json& json, DedupOptions& options) {
+    options.cacheSize = json.value("cacheSize", static_cast<std::size_t>(10000));
+}
+
+// Ids de eventos ya confirmados, LRU acotado. Corta las reentregas del broker
+// (prefetch alto, reconexiones) antes de leer nada de la base; si el proceso
+// reinicia se pierde y entonces ataja processed_events en Postgres.
+class ProcessedEventCache {
+public:
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t evictions = 0;
+        std::size_t size = 0;
+    };
+
+    explicit ProcessedEventCache(DedupOptions options);
+
+    ProcessedEventCache(const ProcessedEventCache&) = delete;
+    ProcessedEventCache& operator=(const ProcessedEventCache&) = delete;
+
+    // true => ya se procesó (lo marca como usado recientemente)
+    bool Seen(std::string_view eventId);
+
+    void Remember(std::string_view eventId);
+
+    [[nodiscard]] Stats GetStats() const;
+
+    // Formato de texto de Prometheus, para anexar a GET /metrics
+    void RenderMetrics(std::string& out) const;
+
+private:
+    std::size_t capacity;
+    mutable std::mutex mutex;
+    std::list<std::string> order; // frente = más reciente
+    std::unordered_map<std::string_view, std::list<std::string>::iterator> index;
+    Stats stats;
+};
+
+#endif // CONSUMER_PROCESSED_EVENT_CACHE_HPP
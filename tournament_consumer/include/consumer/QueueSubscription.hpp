@@ -0,0 +1,532 @@
+#ifndef CONSUMER_QUEUE_SUBSCRIPTION_HPP
+#define CONSUMER_QUEUE_SUBSCRIPTION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <cms/CMSException.h>
+#include <cms/Connection.h>
+#include <cms/Message.h>
+#include <cms/MessageConsumer.h>
+#include <cms/Queue.h>
+#include <cms/Session.h>
+#include <nlohmann/json.hpp>
+#include <pqxx/except>
+
+#include "cms/ConnectionManager.hpp"
+#include "cms/DeadLetterSender.hpp"
+#include "cms/EventMessages.hpp"
+#include "consumer/ConsumerMetrics.hpp"
+#include "consumer/PartitionedDispatcher.hpp"
+#include "consumer/ProcessedEventCache.hpp"
+#include "consumer/RetryScheduler.hpp"
+
+struct SubscriptionOptions {
+    // Mensajes que el broker adelanta a cada consumidor (consumer.prefetchSize
+    // en el destino); 0 => el valor por defecto del cliente
+    int prefetch = 100;
+    // Recibidos y sin resolver por cola: al llegar al tope el receptor deja
+    // de pedir mensajes hasta que se confirme alguno
+    std::int64_t maxInFlight = 500;
+    // Al detener, cuánto se espera a que lo que está en curso se confirme
+    // antes de cerrar la sesión; lo que quede lo reentrega el broker
+    std::chrono::milliseconds drainTimeout{10'000};
+};
+
+inline void from_json(const nlohmann::json& json, SubscriptionOptions& options) {
+    options.prefetch = json.value("prefetch", 100);
+    options.maxInFlight = json.value("maxInFlight", static_cast<std::int64_t>(500));
+    options.drainTimeout = std::chrono::milliseconds(json.value("drainTimeoutMs", 10'000));
+    if (options.prefetch < 0) options.prefetch = 0;
+    if (options.maxInFlight < 1) options.maxInFlight = 1;
+    if (options.drainTimeout.count() < 0) options.drainTimeout = std::chrono::milliseconds(0);
+}
+
+// Lo que comparten todas las suscripciones del proceso (ContainerSetup).
+// Salvo connectionManager y dispatcher, todo puede ser nullptr.
+struct SubscriptionRuntime {
+    std::shared_ptr<ConnectionManager> connectionManager;
+    std::shared_ptr<PartitionedDispatcher> dispatcher;
+    std::shared_ptr<ProcessedEventCache> processed;
+    std::shared_ptr<RetryScheduler> retries;        // nullptr => sin reintentos
+    std::shared_ptr<DeadLetterSender> deadLetters;  // nullptr => se descarta
+    std::shared_ptr<ConsumerMetrics> metrics;
+    SubscriptionOptions options;
+};
+
+// Lee una cola en su propio hilo y pasa cada mensaje al worker de su torneo.
+// INDIVIDUAL_ACKNOWLEDGE: el mensaje se confirma cuando el handler llama a
+// `ack` (puede guardarlo y llamarlo después, p. ej. GroupDebouncer), no al
+// recibirlo; si el proceso cae antes, el broker lo reentrega. Con caché de
+// procesados, una reentrega de un evento ya confirmado se descarta sin llegar
+// al handler.
+//
+// Si el handler falla, el mensaje sigue sin confirmar y se vuelve a entregar
+// al handler más tarde (RetryScheduler, espera exponencial). Un error
+// permanente o agotar los intentos lo manda a la DLQ (DeadLetterSender) y
+// recién entonces se confirma. Si el envío a la DLQ falla se reintenta con la
+// misma espera; agotado eso, se recicla la sesión para que el broker lo
+// vuelva a entregar en vez de dejarlo ocupando el prefetch.
+//
+// Orden: los reintentos no esperan a los eventos siguientes del torneo. Un
+// reintento entra al final de la cola de su worker, así que un evento
+// posterior del mismo torneo puede aplicarse antes; los handlers leen el
+// estado actual y no dependen de ese orden. El hilo de la rueda nunca se
+// bloquea en el dispatcher: con la cola del worker llena el reintento se
+// vuelve a agendar un tick después.
+//
+// Control de flujo: el broker adelanta hasta `prefetch` mensajes y el
+// receptor no toma más mientras haya `maxInFlight` sin resolver (además del
+// dispatcher lleno, que lo bloquea). Al detener deja de recibir, espera lo
+// que está en curso (sus acks van por esta sesión) y recién después cierra.
+// Lo que se resuelva con la sesión ya cerrada (drainTimeout vencido, broker
+// caído) no se confirma: el broker lo reentrega.
+// Si el broker falla, pide reconexión (ConnectionManager::ReconnectIfFailed)
+// y vuelve a suscribirse. Una suscripción por cola.
+class QueueSubscription {
+public:
+    // error == nullptr => procesado. Si no, el error del procesamiento: se
+    // reintenta o va a la DLQ según el error y los intentos que lleva.
+    using Ack = std::function<void(std::exception_ptr error)>;
+
+    struct Delivery {
+        std::string eventId; // ver messaging::EventIdOf
+        nlohmann::json event;
+        int attempt = 1;
+    };
+    using Handler = std::function<void(const Delivery&, Ack)>;
+
+private:
+    // Lo que usan el worker, el ack y los reintentos. Compartido y no `this`:
+    // un ack tardío (debouncer, rueda de reintentos) puede llegar después de
+    // destruir la suscripción.
+    struct Pipeline {
+        Pipeline(const SubscriptionRuntime& runtime, std::string queueName, std::string logTag, Handler handler)
+            : dispatcher(runtime.dispatcher), queueName(std::move(queueName)), logTag(std::move(logTag)),
+              handler(std::move(handler)), processed(runtime.processed), retries(runtime.retries),
+              deadLetters(runtime.deadLetters),
+              // Sin registro compartido los contadores igual existen, sólo nadie los lee
+              metrics(runtime.metrics ? runtime.metrics : std::make_shared<ConsumerMetrics>()),
+              counters(&metrics->Queue(this->queueName)) {}
+
+        const std::shared_ptr<PartitionedDispatcher> dispatcher;
+        const std::string queueName;
+        const std::string logTag;
+        const Handler handler;
+        const std::shared_ptr<ProcessedEventCache> processed; // puede ser nullptr
+        const std::shared_ptr<RetryScheduler> retries;
+        const std::shared_ptr<DeadLetterSender> deadLetters;
+        const std::shared_ptr<ConsumerMetrics> metrics;
+        ConsumerMetrics::QueueCounters* const counters;       // de `metrics`, nunca nullptr
+
+        // Mensajes de esta suscripción sin resolver (ack, DLQ o abandonados);
+        // `settled` avisa al receptor cuando baja
+        std::mutex mutex;
+        std::condition_variable settled;
+        std::int64_t inFlight = 0;
+    };
+
+    // Sesión de una vuelta de ReceiveLoop. La comparten los mensajes que
+    // entregó: el ack individual de activemq-cpp pasa por su consumidor, así
+    // que no se destruye mientras quede uno vivo, y una vez cerrada no se
+    // confirma nada más. Los miembros se destruyen del consumidor a la conexión.
+    struct SessionState {
+        std::shared_ptr<cms::Connection> connection;
+        std::unique_ptr<cms::Session> session;
+        std::unique_ptr<cms::Queue> queue;
+        std::unique_ptr<cms::MessageConsumer> consumer;
+
+        std::mutex mutex; // un ack no corre a la vez que el cierre
+        bool closed = false;
+    };
+
+    // El mensaje se destruye antes que la sesión que lo entregó
+    struct Received {
+        std::shared_ptr<SessionState> session;
+        std::unique_ptr<cms::Message> message;
+    };
+    using Message = std::shared_ptr<Received>;
+
+    // Sólo acota cuánto tarda el receptor en notar Stop: receive() vuelve en
+    // cuanto llega un mensaje
+    static constexpr int kReceiveTimeoutMs = 250;
+
+    std::shared_ptr<ConnectionManager> connectionManager;
+    SubscriptionOptions options;
+    std::shared_ptr<Pipeline> pipeline;
+
+    std::atomic<bool> running{false};
+    std::thread receiver;
+
+public:
+    QueueSubscription(const SubscriptionRuntime& runtime, std::string queueName, std::string logTag, Handler handler)
+        : connectionManager(runtime.connectionManager), options(runtime.options),
+          pipeline(std::make_shared<Pipeline>(runtime, std::move(queueName), std::move(logTag), std::move(handler))) {}
+
+    ~QueueSubscription() { Stop(); }
+
+    QueueSubscription(const QueueSubscription&) = delete;
+    QueueSubscription& operator=(const QueueSubscription&) = delete;
+
+    void Start() {
+        if (running.exchange(true)) return;
+        receiver = std::thread([this] { ReceiveLoop(); });
+    }
+
+    // Deja de recibir sin esperar; el receptor drena y cierra por su cuenta.
+    // Sirve para detener todas las colas a la vez antes de esperarlas.
+    void StopReceiving() {
+        running = false;
+        std::lock_guard lock(pipeline->mutex);
+        pipeline->settled.notify_all();
+    }
+
+    // Deja de recibir y espera a que el receptor termine de drenar
+    // (como mucho drainTimeout)
+    void Stop() {
+        StopReceiving();
+        if (receiver.joinable()) receiver.join();
+    }
+
+private:
+    void ReceiveLoop() {
+        const auto& queueName = pipeline->queueName;
+        while (running) {
+            // Generación de la conexión sobre la que se abrió la sesión: si
+            // falla, sólo se reconecta si nadie lo hizo ya
+            std::uint64_t generation = 0;
+            std::shared_ptr<SessionState> state;
+            try {
+                auto [connection, current] = connectionManager->CurrentConnection();
+                generation = current;
+                state = std::make_shared<SessionState>();
+                state->connection = std::move(connection);
+                state->session.reset(state->connection->createSession(cms::Session::INDIVIDUAL_ACKNOWLEDGE));
+                state->queue.reset(state->session->createQueue(Destination()));
+                state->consumer.reset(state->session->createConsumer(state->queue.get()));
+
+                while (running) {
+                    if (!WaitForCapacity()) continue;
+                    std::unique_ptr<cms::Message> message(state->consumer->receive(kReceiveTimeoutMs));
+                    if (message) Route(std::make_shared<Received>(state, std::move(message)));
+                }
+                // Los acks de lo que está en curso van por este consumidor:
+                // se cierra cuando terminan. Lo adelantado por el broker y
+                // sin leer vuelve a la cola al cerrar.
+                Drain();
+                Close(*state);
+            } catch (const cms::CMSException& e) {
+                // Lo que sigue en curso ya no puede confirmarse por esta
+                // sesión: queda sin ack y el broker lo reentrega
+                if (state) Close(*state);
+                std::cerr << "[" << pipeline->logTag << "] Subscription to " << queueName << " lost: " << e.what() << std::endl;
+                connectionManager->ReconnectIfFailed(generation);
+                if (running) std::this_thread::sleep_for(std::chrono::seconds(1));
+            }
+        }
+    }
+
+    // Opciones de consumidor de activemq-cpp van en el nombre del destino
+    [[nodiscard]] std::string Destination() const {
+        if (options.prefetch == 0) return pipeline->queueName;
+        return pipeline->queueName + "?consumer.prefetchSize=" + std::to_string(options.prefetch);
+    }
+
+    // false => se detuvo o sigue en el tope tras esperar un receive
+    bool WaitForCapacity() {
+        std::unique_lock lock(pipeline->mutex);
+        return pipeline->settled.wait_for(lock, std::chrono::milliseconds(kReceiveTimeoutMs), [this] {
+            return !running || pipeline->inFlight < options.maxInFlight;
+        }) && running;
+    }
+
+    void Drain() {
+        std::unique_lock lock(pipeline->mutex);
+        if (pipeline->inFlight == 0) return;
+        std::cout << "[" << pipeline->logTag << "] Waiting for " << pipeline->inFlight << " in-flight message(s) from "
+                  << pipeline->queueName << std::endl;
+        if (!pipeline->settled.wait_for(lock, options.drainTimeout, [this] { return pipeline->inFlight <= 0; })) {
+            std::cerr << "[" << pipeline->logTag << "] " << pipeline->inFlight << " message(s) from " << pipeline->queueName
+                      << " still in flight after " << options.drainTimeout.count()
+                      << " ms; the broker will redeliver them" << std::endl;
+        }
+    }
+
+    void Route(Message message) {
+        auto& counters = *pipeline->counters;
+        Bump(counters.received);
+        counters.inFlight.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard lock(pipeline->mutex);
+            ++pipeline->inFlight;
+        }
+
+        // Leer cuerpo y propiedades puede lanzar (CMSException con la sesión
+        // caída): sin Release el cupo quedaría ocupado para siempre y Drain
+        // esperaría hasta el timeout. Sin ack: el broker lo reentrega.
+        Delivery delivery;
+        try {
+            // JSON (TextMessage) o MessagePack (BytesMessage) según contentType
+            auto decoded = messaging::DecodeEventMessage(*message->message);
+            if (!decoded) {
+                // Reintentarlo no lo va a arreglar
+                Bump(counters.failed);
+                DeadLetter(pipeline, message, std::string(messaging::ToString(decoded.error())), 1);
+                return;
+            }
+            delivery = Delivery{messaging::EventIdOf(*message->message), std::move(*decoded)};
+        } catch (...) {
+            Release(*pipeline);
+            throw;
+        }
+        if (pipeline->processed && pipeline->processed->Seen(delivery.eventId)) {
+            Bump(counters.duplicates);
+            Acknowledge(*pipeline, *message); // reentrega de algo ya aplicado
+            Release(*pipeline);
+            return;
+        }
+        if (!Dispatch(pipeline, std::move(message), std::move(delivery))) {
+            Release(*pipeline); // dispatcher detenido: sin ack, vuelve al reconectar
+        }
+    }
+
+    static bool Dispatch(const std::shared_ptr<Pipeline>& pipeline, Message message, Delivery delivery) {
+        const auto tournamentId = delivery.event.value("tournamentId", std::string{});
+        return pipeline->dispatcher->Dispatch(tournamentId, MakeWork(pipeline, std::move(message), std::move(delivery)));
+    }
+
+    static PartitionedDispatcher::Work MakeWork(const std::shared_ptr<Pipeline>& pipeline, Message message, Delivery delivery) {
+        return [pipeline, message = std::move(message), delivery = std::move(delivery)] {
+            if (delivery.attempt == 1) RecordLag(*pipeline->counters, *message->message);
+            Ack ack = [pipeline, message, delivery](std::exception_ptr error) {
+                Settle(pipeline, message, delivery, std::move(error));
+            };
+            try {
+                pipeline->handler(delivery, ack);
+            } catch (...) {
+                ack(std::current_exception());
+            }
+        };
+    }
+
+    // Cupo de un mensaje mientras espera en la rueda de reintentos. Si la
+    // rueda lo descarta sin correrlo (Stop, o Schedule rechazado) lo libera
+    // al destruirse; al correr, Take pasa la responsabilidad a quien sigue.
+    class PendingSlot {
+        std::shared_ptr<Pipeline> pipeline;
+
+    public:
+        explicit PendingSlot(std::shared_ptr<Pipeline> pipeline) : pipeline(std::move(pipeline)) {}
+        PendingSlot(PendingSlot&&) noexcept = default;
+        PendingSlot& operator=(PendingSlot&&) = delete;
+        ~PendingSlot() {
+            if (!pipeline) return;
+            std::cerr << "[" << pipeline->logTag << "] Retry dropped on shutdown; the broker will redeliver it" << std::endl;
+            Release(*pipeline);
+        }
+
+        std::shared_ptr<Pipeline> Take() { return std::move(pipeline); }
+    };
+
+    // Corre en el hilo de la rueda: no espera lugar en el dispatcher (frenaría
+    // todos los demás reintentos), vuelve a agendarse
+    static void Redeliver(std::shared_ptr<Pipeline> pipeline, std::string partitionKey, PartitionedDispatcher::Work work) {
+        switch (pipeline->dispatcher->TryDispatch(partitionKey, work)) {
+            case PartitionedDispatcher::TryResult::Accepted:
+                return;
+            case PartitionedDispatcher::TryResult::Full: {
+                const auto retries = pipeline->retries;
+                retries->Schedule(retries->Options().tick, [slot = PendingSlot(std::move(pipeline)), partitionKey = std::move(partitionKey),
+                                        work = std::move(work)]() mutable {
+                    Redeliver(slot.Take(), std::move(partitionKey), std::move(work));
+                });
+                return; // rechazado => el slot ya liberó el cupo
+            }
+            case PartitionedDispatcher::TryResult::Stopped:
+                PendingSlot dropped(std::move(pipeline)); // sin ack: lo reentrega el broker
+                return;
+        }
+    }
+
+    static void Settle(const std::shared_ptr<Pipeline>& pipeline, const Message& message,
+                       const Delivery& delivery, std::exception_ptr error) {
+        auto& counters = *pipeline->counters;
+        if (!error) {
+            if (pipeline->processed) pipeline->processed->Remember(delivery.eventId); // aplicado aunque falle el ack
+            Bump(counters.processed);
+            Acknowledge(*pipeline, *message);
+            Release(*pipeline);
+            return;
+        }
+
+        Bump(counters.failed);
+        const auto reason = Describe(error);
+        const auto& retries = pipeline->retries;
+        if (!retries || IsPermanentFailure(error) || delivery.attempt >= retries->Options().maxAttempts) {
+            DeadLetter(pipeline, message, reason, delivery.attempt);
+            return;
+        }
+
+        Delivery next = delivery;
+        ++next.attempt;
+        const auto delay = retries->DelayFor(next.attempt);
+        std::cerr << "[" << pipeline->logTag << "] Attempt " << delivery.attempt << " of event " << delivery.eventId
+                  << " failed: " << reason << "; retrying in " << delay.count() << " ms" << std::endl;
+        const bool scheduled = retries->Schedule(delay, [slot = PendingSlot(pipeline), message, next = std::move(next)]() mutable {
+            auto owner = slot.Take();
+            auto partitionKey = next.event.value("tournamentId", std::string{});
+            auto work = MakeWork(owner, message, std::move(next));
+            Redeliver(std::move(owner), std::move(partitionKey), std::move(work));
+        });
+        if (scheduled) {
+            Bump(counters.retried);
+        } // si no, el slot descartado ya liberó el cupo
+    }
+
+    // `sendAttempt`: intentos de envío a la DLQ, aparte de los del handler
+    static void DeadLetter(const std::shared_ptr<Pipeline>& pipeline, const Message& message,
+                           const std::string& reason, int attempts, int sendAttempt = 1) {
+        if (!pipeline->deadLetters) {
+            std::cerr << "[" << pipeline->logTag << "] Discarding message from " << pipeline->queueName << ": "
+                      << reason << std::endl;
+            Acknowledge(*pipeline, *message);
+        } else {
+            try {
+                pipeline->deadLetters->Send(pipeline->queueName, *message->message, {reason, attempts});
+                Bump(pipeline->counters->deadLettered);
+                std::cerr << "[" << pipeline->logTag << "] Moved message to "
+                          << pipeline->deadLetters->QueueFor(pipeline->queueName) << " after " << attempts
+                          << " attempt(s): " << reason << std::endl;
+                Acknowledge(*pipeline, *message);
+            } catch (const cms::CMSException& e) {
+                std::cerr << "[" << pipeline->logTag << "] Dead-lettering failed (attempt " << sendAttempt
+                          << "): " << e.what() << std::endl;
+                if (RetryDeadLetter(pipeline, message, reason, attempts, sendAttempt)) return; // sigue en curso
+                // Sin ack ni rollback quedaría ocupando el prefetch hasta la
+                // próxima reconexión: cerrar la sesión lo devuelve al broker
+                // (con todo lo que esa sesión entregó sin confirmar) y el
+                // receptor vuelve a suscribirse
+                std::cerr << "[" << pipeline->logTag << "] Recycling the session of " << pipeline->queueName
+                          << " so the broker redelivers it" << std::endl;
+                Close(*message->session);
+            }
+        }
+        Release(*pipeline);
+    }
+
+    // Reagenda el envío a la DLQ con la espera de los reintentos. Corre en un
+    // worker (el envío bloquea), en la partición de la cola: no hay torneo
+    // para un mensaje que ni siquiera se pudo decodificar.
+    // false => sin reintentos o agotados; el cupo sigue a cargo de quien llama.
+    static bool RetryDeadLetter(const std::shared_ptr<Pipeline>& pipeline, const Message& message,
+                                const std::string& reason, int attempts, int sendAttempt) {
+        const auto& retries = pipeline->retries;
+        if (!retries || sendAttempt >= retries->Options().maxAttempts) return false;
+        const int next = sendAttempt + 1;
+        retries->Schedule(retries->DelayFor(next), [slot = PendingSlot(pipeline), message, reason, attempts, next]() mutable {
+            auto owner = slot.Take();
+            auto partitionKey = owner->queueName;
+            PartitionedDispatcher::Work work = [owner, message, reason, attempts, next] {
+                DeadLetter(owner, message, reason, attempts, next);
+            };
+            Redeliver(std::move(owner), std::move(partitionKey), std::move(work));
+        });
+        return true; // rechazado => el slot ya liberó el cupo
+    }
+
+    // El mensaje quedó resuelto. Va después del ack: Drain cierra la sesión
+    // en cuanto no queda nada en curso.
+    static void Release(Pipeline& pipeline) {
+        pipeline.counters->inFlight.fetch_sub(1, std::memory_order_relaxed);
+        {
+            std::lock_guard lock(pipeline.mutex);
+            --pipeline.inFlight;
+        }
+        pipeline.settled.notify_all();
+    }
+
+    static void Bump(std::atomic<std::uint64_t>& counter) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Desde el envío del productor (JMSTimestamp, 0 si no lo puso) hasta que
+    // el worker lo toma: broker + cola del dispatcher. Con relojes
+    // desfasados entre máquinas puede dar negativo; se cuenta como 0.
+    static void RecordLag(ConsumerMetrics::QueueCounters& counters, const cms::Message& message) {
+        const auto sent = message.getCMSTimestamp();
+        if (sent <= 0) return;
+        const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        const auto lag = std::max<std::int64_t>(now - sent, 0);
+        counters.lag.Record(std::chrono::milliseconds(lag));
+        counters.lastLagMillis.store(lag, std::memory_order_relaxed);
+    }
+
+    static void Acknowledge(const Pipeline& pipeline, const Received& received) {
+        std::lock_guard lock(received.session->mutex);
+        if (received.session->closed) {
+            std::cerr << "[" << pipeline.logTag << "] Session closed before the ack (will be redelivered)" << std::endl;
+            return;
+        }
+        try {
+            received.message->acknowledge();
+        } catch (const cms::CMSException& e) {
+            std::cerr << "[" << pipeline.logTag << "] Ack failed (will be redelivered): " << e.what() << std::endl;
+        }
+    }
+
+    // Tras esto ningún ack toca la sesión; sus objetos viven hasta que se
+    // suelte el último mensaje que la referencia
+    static void Close(SessionState& state) {
+        std::lock_guard lock(state.mutex);
+        state.closed = true;
+        try {
+            if (state.consumer) state.consumer->close();
+            if (state.session) state.session->close();
+        } catch (const cms::CMSException&) {
+            // conexión caída: del lado del broker ya no queda nada que cerrar
+        }
+    }
+
+    static std::string Describe(const std::exception_ptr& error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            return e.what();
+        } catch (...) {
+            return "unknown error";
+        }
+    }
+
+    // Errores que se repetirían igual en cada intento. El resto (base caída,
+    // pool saturado, deadlock, serialización) se reintenta.
+    static bool IsPermanentFailure(const std::exception_ptr& error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const nlohmann::json::exception&) {
+            return true; // el evento no tiene la forma esperada
+        } catch (const pqxx::data_exception&) {
+            return true;
+        } catch (const pqxx::integrity_constraint_violation&) {
+            return true;
+        } catch (const pqxx::syntax_error&) {
+            return true;
+        } catch (const std::logic_error&) {
+            return true; // incluye pqxx::usage_error y los de conversión
+        } catch (...) {
+            return false;
+        }
+    }
+};
+
+#endif // CONSUMER_QUEUE_SUBSCRIPTION_HPP
@@ -0,0 +1,110 @@
+#ifndef CONSUMER_RETRY_SCHEDULER_HPP
+#define CONSUMER_RETRY_SCHEDULER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+struct RetryOptions {
+    // Intentos en total, contando el primero; al agotarlos el mensaje va a la DLQ
+    int maxAttempts = 5;
+    std::chrono::milliseconds initialDelay{500};
+    std::chrono::milliseconds maxDelay{30'000};
+    // Fracción de la espera que se sortea (±): reintentos de una misma caída
+    // no vuelven todos juntos
+    double jitter = 0.2;
+    // Resolución y tamaño de la rueda: esperas más largas que tick * slots
+    // dan más vueltas, no cuestan más
+    std::chrono::milliseconds tick{50};
+    std::size_t wheelSlots = 512;
+    // Cola de mensajes muertos = prefijo + cola original
+    std::string deadLetterPrefix = "DLQ.";
+};
+
+inline void from_json(const nlohmann::json& json, RetryOptions& options) {
+    options.maxAttempts = json.value("maxAttempts", 5);
+    options.initialDelay = std::chrono::milliseconds(json.value("initialDelayMs", 500));
+    options.maxDelay = std::chrono::milliseconds(json.value("maxDelayMs", 30'000));
+    options.jitter = json.value("jitter", 0.2);
+    options.tick = std::chrono::milliseconds(json.value("tickMs", 50));
+    options.wheelSlots = json.value("wheelSlots", static_cast<std::size_t>(512));
+    options.deadLetterPrefix = json.value("deadLetterPrefix", std::string("DLQ."));
+    if (options.maxAttempts < 1) options.maxAttempts = 1;
+    if (options.maxDelay < options.initialDelay) options.maxDelay = options.initialDelay;
+    if (options.jitter < 0.0) options.jitter = 0.0;
+    if (options.jitter > 1.0) options.jitter = 1.0;
+    if (options.tick.count() <= 0) options.tick = std::chrono::milliseconds(1);
+    if (options.wheelSlots == 0) options.wheelSlots = 1;
+}
+
+// Reentrega diferida de mensajes que fallaron (ver QueueSubscription): espera
+// exponencial con jitter y una rueda de temporizadores (hashed timing wheel)
+// en un solo hilo. Agendar es O(1) y cada tick sólo mira una ranura, así que
+// miles de mensajes esperando reintento no cuestan un hilo ni un heap cada uno.
+class RetryScheduler {
+public:
+    using Work = std::move_only_function<void()>;
+
+    struct Stats {
+        std::uint64_t scheduled = 0;
+        std::uint64_t fired = 0;
+        std::uint64_t dropped = 0; // pendientes al detener
+        std::size_t pending = 0;
+    };
+
+    explicit RetryScheduler(RetryOptions options);
+    ~RetryScheduler();
+
+    RetryScheduler(const RetryScheduler&) = delete;
+    RetryScheduler& operator=(const RetryScheduler&) = delete;
+
+    [[nodiscard]] const RetryOptions& Options() const { return options; }
+
+    // Espera antes del intento `attempt` (el 2 es el primer reintento):
+    // initialDelay * 2^(attempt-2), tope maxDelay, sin jitter
+    [[nodiscard]] std::chrono::milliseconds BackoffFor(int attempt) const;
+
+    // BackoffFor con el jitter aplicado
+    [[nodiscard]] std::chrono::milliseconds DelayFor(int attempt);
+
+    // Corre `work` en el hilo de la rueda pasado `delay` (redondeado al tick).
+    // false => ya se detuvo y el trabajo no se aceptó.
+    bool Schedule(std::chrono::milliseconds delay, Work work);
+
+    // Descarta lo pendiente: sus mensajes siguen sin ack y el broker los
+    // reentrega al reconectar
+    void Stop();
+
+    [[nodiscard]] Stats GetStats() const;
+
+    // Formato de texto de Prometheus, para anexar a GET /metrics
+    void RenderMetrics(std::string& out) const;
+
+private:
+    struct Timer {
+        std::size_t rounds; // vueltas completas que faltan
+        Work work;
+    };
+
+    void Run();
+
+    RetryOptions options;
+    mutable std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::vector<Timer>> wheel;
+    std::size_t cursor = 0;
+    bool stopping = false;
+    Stats stats;
+    std::mt19937 random{std::random_device{}()};
+    std::thread thread;
+};
+
+#endif // CONSUMER_RETRY_SCHEDULER_HPP
@@ -3,9 +3,11 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <nlohmann/json.hpp>
 
+#include "cms/ILiveEventPublisher.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "domain/Tournament.hpp"
@@ -14,21 +16,33 @@
 class ScoreProcessingConsumer {
     std::shared_ptr<IMatchRepository> matchRepo;
     std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepo;
+    std::shared_ptr<ILiveEventPublisher> liveEvents;  // puede ser nullptr
 
 public:
+    // Nombre con el que se marca en processed_events
+    static constexpr const char* ConsumerName = "score-processing";
+
     ScoreProcessingConsumer(
         std::shared_ptr<IMatchRepository> matchRepo,
         std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepo
     );
 
-    // Handle match_score_updated event
-    void Handle(const nlohmann::json& eventJson);
+    // Avisa a GET /tournaments/<id>/events cuando un ganador avanza de ronda
+    void UseLiveEvents(std::shared_ptr<ILiveEventPublisher> publisher) { liveEvents = std::move(publisher); }
+
+    // Handle match_score_updated event. Con eventId, una reentrega del mismo
+    // evento no vuelve a aplicar el avance de ronda ni a crear la llave.
+    // Los errores de la base se propagan: QueueSubscription reintenta el evento.
+    void Handle(const nlohmann::json& eventJson, std::string_view eventId = {});
 
 private:
-    void CheckTournamentCompletion(const std::string& tournamentId);
-    void ProcessKnockoutAdvancement(const std::string& tournamentId, const std::string& matchId);
-    void GeneratePlayoffs(const std::string& tournamentId, const std::vector<domain::Match>& rrMatches);
-    bool AllMatchesCompleted(const std::string& tournamentId);
+    using Matches = std::vector<std::shared_ptr<domain::Match>>;
+
+    // Devuelve el ganador que avanzó (vacío si no aplica)
+    std::string CollectKnockoutAdvancement(const Matches& allMatches, const std::string& matchId, ScoreEffects& effects);
+    void CollectTournamentCompletion(const std::string& tournamentId, const Matches& allMatches, ScoreEffects& effects);
+    void PublishAdvancement(const std::string& tournamentId, const std::string& fromMatchId,
+                            const std::string& winnerId, const ScoreEffects& effects);
 };
 
 #endif // CONSUMER_SCORE_PROCESSING_CONSUMER_HPP
@@ -1,7 +1,10 @@
 
 //
 #include <activemq/library/ActiveMQCPP.h>
-#include <cms/TextMessage.h>
+#include <cms/CMSException.h>
+#include <atomic>
+#include <chrono>
+#include <csignal>
 #include <thread>
 #include <iostream>
 #include <exception>
@@ -12,61 +15,27 @@
 #include "configuration/ContainerSetup.hpp"
 #include "consumer/MatchGenerationConsumer.hpp"
 #include "consumer/ScoreProcessingConsumer.hpp"
-#include "cms/ConnectionManager.hpp"
-
-// Wrapper consumer for MatchGenerationConsumer
-class MatchGenQueueListener : public cms::MessageListener {
-    std::shared_ptr<MatchGenerationConsumer> consumer;
-public:
-    explicit MatchGenQueueListener(std::shared_ptr<MatchGenerationConsumer> consumer) 
-        : consumer(std::move(consumer)) {}
-    
-    void onMessage(const cms::Message* message) override {
-        try {
-            if (auto text = dynamic_cast<const cms::TextMessage*>(message)) {
-                std::string payload = text->getText();
-                std::cout << "[MatchGenConsumer] Received message: " << payload << std::endl;
-                
-                // Parse JSON and call Handle
-                auto eventJson = nlohmann::json::parse(payload);
-                consumer->Handle(eventJson);
-            }
-        } catch (const nlohmann::json::exception& e) {
-            std::cerr << "[MatchGenConsumer] JSON parsing error: " << e.what() << std::endl;
-        } catch (const std::exception& e) {
-            std::cerr << "[MatchGenConsumer] Error processing message: " << e.what() << std::endl;
-        }
-    }
-};
-
-// Wrapper consumer for ScoreProcessingConsumer
-class ScoreProcessQueueListener : public cms::MessageListener {
-    std::shared_ptr<ScoreProcessingConsumer> consumer;
-public:
-    explicit ScoreProcessQueueListener(std::shared_ptr<ScoreProcessingConsumer> consumer) 
-        : consumer(std::move(consumer)) {}
-    
-    void onMessage(const cms::Message* message) override {
-        try {
-            if (auto text = dynamic_cast<const cms::TextMessage*>(message)) {
-                std::string payload = text->getText();
-                std::cout << "[ScoreProcessConsumer] Received message: " << payload << std::endl;
-                
-                // Parse JSON and call Handle
-                auto eventJson = nlohmann::json::parse(payload);
-                consumer->Handle(eventJson);
-            }
-        } catch (const nlohmann::json::exception& e) {
-            std::cerr << "[ScoreProcessConsumer] JSON parsing error: " << e.what() << std::endl;
-        } catch (const std::exception& e) {
-            std::cerr << "[ScoreProcessConsumer] Error processing message: " << e.what() << std::endl;
-        }
+#include "consumer/PartitionedDispatcher.hpp"
+#include "consumer/GroupDebouncer.hpp"
+#include "consumer/RetryScheduler.hpp"
+#include "consumer/ConsumerMetrics.hpp"
+#include "consumer/MetricsEndpoint.hpp"
+#include "consumer/QueueSubscription.hpp"
+
+namespace {
+    // SIGINT/SIGTERM (docker stop): el bucle principal sale y se apaga en orden
+    std::atomic<bool> stopRequested{false};
+
+    void RequestStop(int) {
+        stopRequested = true;
     }
-};
+}
 
 int main() {
     try {
         std::cout << "[Consumer] Starting tournament consumer service..." << std::endl;
+        std::signal(SIGINT, RequestStop);
+        std::signal(SIGTERM, RequestStop);
         
         // 1. Initialize ActiveMQ library
         activemq::library::ActiveMQCPP::initializeLibrary();
@@ -78,61 +47,101 @@ int main() {
         std::cout << "[Consumer] Container setup complete" << std::endl;
 
         // 3. Resolve dependencies
-        auto connectionManager = container->resolve<ConnectionManager>();
         auto matchGenConsumer = container->resolve<MatchGenerationConsumer>();
         auto scoreConsumer = container->resolve<ScoreProcessingConsumer>();
 
         std::cout << "[Consumer] Dependencies resolved" << std::endl;
 
-        // 4. Create message listeners
-        auto matchGenListener = std::make_shared<MatchGenQueueListener>(matchGenConsumer);
-        auto scoreListener = std::make_shared<ScoreProcessQueueListener>(scoreConsumer);
-
-        // 5. Create sessions and subscribe to topics
-        auto matchGenSession = connectionManager->CreateSession();
-        auto scoreSession = connectionManager->CreateSession();
-
-        // Subscribe to group.team_added for match generation
-        auto teamAddedQueue = std::unique_ptr<cms::Queue>(
-            matchGenSession->createQueue("tournament.group.team_added")
-        );
-        auto matchGenMsgConsumer = std::unique_ptr<cms::MessageConsumer>(
-            matchGenSession->createConsumer(teamAddedQueue.get())
-        );
-        matchGenMsgConsumer->setMessageListener(matchGenListener.get());
-
+        // 4. Workers por torneo: mismo torneo en orden, torneos distintos en paralelo
+        auto dispatcher = container->resolve<PartitionedDispatcher>();
+        std::cout << "[Consumer] Dispatcher workers: " << dispatcher->Workers() << std::endl;
+
+        // 5. Altas de equipos: una evaluación por ráfaga del mismo grupo; los
+        //    mensajes se confirman cuando esa evaluación termina
+        auto debouncer = container->resolve<GroupDebouncer>();
+        auto handleMatchGeneration = [debouncer, matchGenConsumer](const QueueSubscription::Delivery& delivery,
+                                                                   QueueSubscription::Ack ack) {
+            const auto tournamentId = delivery.event.value("tournamentId", std::string{});
+            const auto groupId = delivery.event.value("groupId", std::string{});
+            if (tournamentId.empty() || groupId.empty()) {
+                matchGenConsumer->Handle(delivery.event); // sólo registra el evento inválido
+                ack(nullptr);
+                return;
+            }
+            debouncer->Submit(tournamentId, groupId, std::move(ack));
+        };
+
+        // Contadores por cola, duración por handler y lag; GET /metrics local
+        auto consumerMetrics = container->resolve<ConsumerMetrics>();
+        auto& scoreTimings = consumerMetrics->Handler("ScoreProcessingConsumer::Handle");
+
+        // Una suscripción (hilo receptor) por cola, todas sobre el mismo
+        // runtime: reentregas de eventos ya confirmados se descartan en
+        // memoria (tras un reinicio las ataja processed_events), los fallos
+        // se reintentan con espera exponencial y lo que no se arregla va a
+        // DLQ.<cola>. El ack llega tras procesar.
+        auto runtime = container->resolve<SubscriptionRuntime>();
+        auto retries = runtime->retries;
+        std::vector<std::unique_ptr<QueueSubscription>> subscriptions;
+        const auto subscribe = [&](std::string queueName, std::string logTag, QueueSubscription::Handler handler) {
+            subscriptions.push_back(std::make_unique<QueueSubscription>(
+                *runtime, std::move(queueName), std::move(logTag), std::move(handler)));
+        };
+        subscribe("tournament.group.team_added", "MatchGenConsumer", handleMatchGeneration);
+        // Altas por lote (GroupDelegate::UpdateTeams): mismo manejo, basta groupId
+        subscribe("tournament.group.teams_added", "MatchGenConsumer", handleMatchGeneration);
+        subscribe("tournament.match.score_updated", "ScoreProcessConsumer",
+            [scoreConsumer, consumerMetrics, &scoreTimings](const QueueSubscription::Delivery& delivery,
+                                                            QueueSubscription::Ack ack) {
+                consumerMetrics->Time(scoreTimings, [&] {
+                    scoreConsumer->Handle(delivery.event, delivery.eventId); // si lanza, se reintenta
+                });
+                ack(nullptr);
+            });
+
+        for (auto& subscription : subscriptions) {
+            subscription->Start();
+        }
         std::cout << "[Consumer]  Subscribed to: tournament.group.team_added" << std::endl;
-
-        // Subscribe to match.score_updated for score processing
-        auto scoreUpdatedQueue = std::unique_ptr<cms::Queue>(
-            scoreSession->createQueue("tournament.match.score_updated")
-        );
-        auto scoreMsgConsumer = std::unique_ptr<cms::MessageConsumer>(
-            scoreSession->createConsumer(scoreUpdatedQueue.get())
-        );
-        scoreMsgConsumer->setMessageListener(scoreListener.get());
-
-        std::cout << "[Consumer] Subscribed to: tournament.match.score_updated" << std::endl;
+        std::cout << "[Consumer]  Subscribed to: tournament.group.teams_added" << std::endl;
+        std::cout << "[Consumer]  Subscribed to: tournament.match.score_updated" << std::endl;
 
         std::cout << "\n━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
         std::cout << "   Tournament Consumer Service Ready" << std::endl;
         std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
         std::cout << "\nActive consumers:" << std::endl;
-        std::cout << "  - MatchGenerationConsumer - tournament.group.team_added" << std::endl;
+        std::cout << "  - MatchGenerationConsumer - tournament.group.team_added, tournament.group.teams_added" << std::endl;
         std::cout << "  - ScoreProcessingConsumer - tournament.match.score_updated" << std::endl;
+        auto metricsEndpoint = container->resolve<MetricsEndpoint>();
+        if (metricsEndpoint->Start()) {
+            std::cout << "\nMetrics: http://" << metricsEndpoint->Address() << "/metrics" << std::endl;
+        }
         std::cout << "\nWaiting for events...\n" << std::endl;
 
-        // 6. Keep process alive
-        while (true) {
-            std::this_thread::sleep_for(std::chrono::seconds(60));
-            std::cout << "[Consumer] Service running... (uptime check)" << std::endl;
+        // 6. Keep process alive until SIGINT/SIGTERM
+        auto nextReport = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+        while (!stopRequested) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            if (std::chrono::steady_clock::now() >= nextReport) {
+                nextReport += std::chrono::seconds(60);
+                std::cout << "[Consumer] Service running... " << consumerMetrics->Summary() << std::endl;
+            }
         }
 
-        // 7. Cleanup (never reached in normal operation)
-        matchGenMsgConsumer->close();
-        scoreMsgConsumer->close();
-        matchGenSession->close();
-        scoreSession->close();
+        // 7. Graceful shutdown: ninguna cola recibe más y lo que está en curso
+        //    termina mientras las sesiones siguen abiertas (cada suscripción
+        //    las cierra cuando no le queda nada, o a los drainTimeoutMs)
+        std::cout << "[Consumer] Shutting down... " << consumerMetrics->Summary() << std::endl;
+        for (auto& subscription : subscriptions) {
+            subscription->StopReceiving();
+        }
+        retries->Stop();       // lo que esperaba reintento suelta su cupo sin ack: lo reentrega el broker
+        debouncer->Flush();    // grupos pendientes al worker de su torneo
+        dispatcher->Stop();    // corre lo encolado; sus acks van por sesiones aún abiertas
+        debouncer->Flush();    // lo que ese último trabajo dejó agrupado se evalúa aquí
+        subscriptions.clear(); // sin nada en curso: cierran sus sesiones y terminan
+        metricsEndpoint->Stop();
+        std::cout << "[Consumer] Stopped. " << consumerMetrics->Summary() << std::endl;
         
         activemq::library::ActiveMQCPP::shutdownLibrary();
         return 0;
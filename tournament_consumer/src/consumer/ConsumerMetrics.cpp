@@ -0,0 +1,184 @@
+#include "consumer/ConsumerMetrics.hpp"
+
+#include <algorithm>
+
+#include "metrics/PrometheusText.hpp"
+
+namespace {
+    using Counter = std::atomic<std::uint64_t> ConsumerMetrics::QueueCounters::*;
+
+    struct QueueCounter {
+        const char* name;
+        const char* help;
+        Counter counter;
+    };
+
+    constexpr std::array<QueueCounter, 6> kQueueCounters{{
+        {"tournament_consumer_messages_received_total", "Messages taken from the broker.",
+         &ConsumerMetrics::QueueCounters::received},
+        {"tournament_consumer_messages_processed_total", "Messages handled and acknowledged.",
+         &ConsumerMetrics::QueueCounters::processed},
+        {"tournament_consumer_messages_failed_total", "Failed processing attempts.",
+         &ConsumerMetrics::QueueCounters::failed},
+        {"tournament_consumer_messages_retried_total", "Attempts scheduled for redelivery.",
+         &ConsumerMetrics::QueueCounters::retried},
+        {"tournament_consumer_messages_dead_lettered_total", "Messages moved to the dead-letter queue.",
+         &ConsumerMetrics::QueueCounters::deadLettered},
+        {"tournament_consumer_messages_duplicate_total", "Redeliveries of already processed events, skipped.",
+         &ConsumerMetrics::QueueCounters::duplicates},
+    }};
+
+    std::string Label(std::string_view key, std::string_view value) {
+        std::string label(key);
+        label += "=\"";
+        label += value;
+        label += '"';
+        return label;
+    }
+
+    void Header(std::string& out, std::string_view name, std::string_view help, std::string_view type) {
+        out += "# HELP ";
+        out += name;
+        out += ' ';
+        out += help;
+        out += "\n# TYPE ";
+        out += name;
+        out += ' ';
+        out += type;
+        out += '\n';
+    }
+
+    template<typename Value>
+    void Sample(std::string& out, std::string_view name, std::string_view labels, Value value) {
+        out += name;
+        if (!labels.empty()) {
+            out += '{';
+            out += labels;
+            out += '}';
+        }
+        out += ' ';
+        out += std::to_string(value);
+        out += '\n';
+    }
+}
+
+void SharedHistogram::Record(std::chrono::microseconds elapsed) {
+    const auto micros = static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed.count(), 0));
+    buckets[metrics::BucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+    sumMicros.fetch_add(micros, std::memory_order_relaxed);
+}
+
+metrics::HistogramSnapshot SharedHistogram::Read() const {
+    metrics::HistogramSnapshot snapshot;
+    for (std::size_t i = 0; i < metrics::kBucketCount; ++i) {
+        const auto count = buckets[i].load(std::memory_order_relaxed);
+        snapshot.counts[i] = count;
+        snapshot.total += count;
+    }
+    snapshot.sumMicros = sumMicros.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+ConsumerMetrics::QueueCounters& ConsumerMetrics::Queue(std::string_view queue) {
+    std::lock_guard lock(mutex);
+    for (auto& entry : queues) {
+        if (entry.queue == queue) return entry;
+    }
+    return queues.emplace_back(std::string(queue));
+}
+
+ConsumerMetrics::HandlerTimings& ConsumerMetrics::Handler(std::string_view handler) {
+    std::lock_guard lock(mutex);
+    for (auto& entry : handlers) {
+        if (entry.handler == handler) return entry;
+    }
+    return handlers.emplace_back(std::string(handler));
+}
+
+void ConsumerMetrics::AddCollector(std::function<void(std::string&)> collector) {
+    std::lock_guard lock(mutex);
+    collectors.push_back(std::move(collector));
+}
+
+std::string ConsumerMetrics::Render() const {
+    std::string out;
+    std::unique_lock lock(mutex);
+    out.reserve((queues.size() + handlers.size()) * 2048);
+
+    for (const auto& [name, help, counter] : kQueueCounters) {
+        Header(out, name, help, "counter");
+        for (const auto& queue : queues) {
+            Sample(out, name, Label("queue", queue.queue), (queue.*counter).load(std::memory_order_relaxed));
+        }
+    }
+
+    Header(out, "tournament_consumer_messages_in_flight",
+           "Messages received and not yet acknowledged or dead-lettered.", "gauge");
+    for (const auto& queue : queues) {
+        Sample(out, "tournament_consumer_messages_in_flight", Label("queue", queue.queue),
+               queue.inFlight.load(std::memory_order_relaxed));
+    }
+
+    Header(out, "tournament_consumer_lag_seconds",
+           "Time from the producer's send (JMSTimestamp) until a worker picks the message up.", "histogram");
+    for (const auto& queue : queues) {
+        metrics::AppendHistogram(out, "tournament_consumer_lag_seconds", Label("queue", queue.queue), queue.lag.Read());
+    }
+    Header(out, "tournament_consumer_last_lag_seconds", "Lag of the most recent message.", "gauge");
+    for (const auto& queue : queues) {
+        out += "tournament_consumer_last_lag_seconds{";
+        out += Label("queue", queue.queue);
+        out += "} ";
+        out += metrics::Seconds(static_cast<std::uint64_t>(queue.lastLagMillis.load(std::memory_order_relaxed)) * 1000);
+        out += '\n';
+    }
+
+    Header(out, "tournament_consumer_handler_duration_seconds", "Time spent in each event handler.", "histogram");
+    for (const auto& handler : handlers) {
+        metrics::AppendHistogram(out, "tournament_consumer_handler_duration_seconds",
+                                 Label("handler", handler.handler), handler.duration.Read());
+    }
+    Header(out, "tournament_consumer_handler_errors_total", "Handler calls that threw.", "counter");
+    for (const auto& handler : handlers) {
+        Sample(out, "tournament_consumer_handler_errors_total", Label("handler", handler.handler),
+               handler.errors.load(std::memory_order_relaxed));
+    }
+
+    // Los colectores leen otros componentes: fuera del candado
+    const auto extra = collectors;
+    lock.unlock();
+    for (const auto& collector : extra) {
+        collector(out);
+    }
+    return out;
+}
+
+std::string ConsumerMetrics::Summary() const {
+    std::uint64_t received = 0, processed = 0, failed = 0, deadLettered = 0;
+    std::int64_t inFlight = 0, lagMillis = 0;
+    {
+        std::lock_guard lock(mutex);
+        for (const auto& queue : queues) {
+            received += queue.received.load(std::memory_order_relaxed);
+            processed += queue.processed.load(std::memory_order_relaxed);
+            failed += queue.failed.load(std::memory_order_relaxed);
+            deadLettered += queue.deadLettered.load(std::memory_order_relaxed);
+            inFlight += queue.inFlight.load(std::memory_order_relaxed);
+            lagMillis = std::max(lagMillis, queue.lastLagMillis.load(std::memory_order_relaxed));
+        }
+    }
+    return "received=" + std::to_string(received) + " processed=" + std::to_string(processed) +
+           " failed=" + std::to_string(failed) + " dead_lettered=" + std::to_string(deadLettered) +
+           " in_flight=" + std::to_string(inFlight) + " last_lag_ms=" + std::to_string(lagMillis);
+}
+
+void ConsumerMetrics::RenderPool(std::string& out, const PoolTelemetry::Snapshot& pool) {
+    Header(out, "tournament_consumer_db_acquisitions_total", "Connections taken from the pool.", "counter");
+    Sample(out, "tournament_consumer_db_acquisitions_total", "", pool.acquisitions);
+    Header(out, "tournament_consumer_db_wait_seconds_total", "Time spent waiting for a pooled connection.", "counter");
+    out += "tournament_consumer_db_wait_seconds_total ";
+    out += metrics::Seconds(pool.waitNanos / 1000);
+    out += '\n';
+    Header(out, "tournament_consumer_db_connections_in_use", "Pooled connections currently checked out.", "gauge");
+    Sample(out, "tournament_consumer_db_connections_in_use", "", pool.inUse);
+}
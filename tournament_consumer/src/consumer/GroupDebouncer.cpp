@@ -0,0 +1,156 @@
+#include "consumer/GroupDebouncer.hpp"
+
+#include <exception>
+#include <iostream>
+#include <utility>
+
+namespace {
+    void RunEvaluation(const GroupDebouncer::Evaluate& evaluate,
+                       const std::string& tournamentId,
+                       const std::string& groupId,
+                       const std::vector<GroupDebouncer::Ack>& acks) {
+        std::exception_ptr error;
+        try {
+            evaluate(tournamentId, groupId);
+        } catch (const std::exception& e) {
+            std::cerr << "GroupDebouncer: Error evaluating group " << groupId << ": " << e.what() << std::endl;
+            error = std::current_exception();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        for (const auto& ack : acks) {
+            try {
+                ack(error);
+            } catch (const std::exception& e) {
+                std::cerr << "GroupDebouncer: Ack failed: " << e.what() << std::endl;
+            }
+        }
+    }
+}
+
+GroupDebouncer::GroupDebouncer(std::shared_ptr<PartitionedDispatcher> dispatcher,
+                               DebounceOptions options,
+                               Evaluate evaluate)
+    : dispatcher(std::move(dispatcher)), options(options), evaluate(std::move(evaluate)) {
+    timer = std::thread([this] { TimerLoop(); });
+}
+
+GroupDebouncer::~GroupDebouncer() {
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    if (timer.joinable()) timer.join();
+    Flush();
+}
+
+void GroupDebouncer::Submit(const std::string& tournamentId, const std::string& groupId, Ack ack) {
+    if (options.window.count() == 0) {
+        {
+            std::lock_guard lock(mutex);
+            ++stats.received;
+            ++stats.evaluations;
+        }
+        // Sin ventana: ya estamos en el worker del torneo, se evalúa aquí
+        RunEvaluation(evaluate, tournamentId, groupId, {std::move(ack)});
+        return;
+    }
+
+    bool first = false;
+    {
+        std::lock_guard lock(mutex);
+        ++stats.received;
+        auto [it, inserted] = pending.try_emplace(groupId);
+        if (inserted) {
+            it->second.tournamentId = tournamentId;
+            it->second.deadline = std::chrono::steady_clock::now() + options.window;
+        }
+        it->second.acks.push_back(std::move(ack));
+        first = inserted;
+    }
+    if (first) changed.notify_all();
+}
+
+void GroupDebouncer::Flush() {
+    std::unordered_map<std::string, Pending> ready;
+    {
+        std::lock_guard lock(mutex);
+        ready.swap(pending);
+    }
+    for (auto& [groupId, entry] : ready) {
+        Fire(groupId, std::move(entry));
+    }
+}
+
+GroupDebouncer::Stats GroupDebouncer::GetStats() const {
+    std::lock_guard lock(mutex);
+    return stats;
+}
+
+void GroupDebouncer::RenderMetrics(std::string& out) const {
+    std::size_t waiting;
+    Stats current;
+    {
+        std::lock_guard lock(mutex);
+        waiting = pending.size();
+        current = stats;
+    }
+    out += "# HELP tournament_consumer_group_evaluations_total Group evaluations run for team_added bursts.\n"
+           "# TYPE tournament_consumer_group_evaluations_total counter\n"
+           "tournament_consumer_group_evaluations_total ";
+    out += std::to_string(current.evaluations);
+    out += "\n# HELP tournament_consumer_groups_pending Groups waiting for their debounce window.\n"
+           "# TYPE tournament_consumer_groups_pending gauge\n"
+           "tournament_consumer_groups_pending ";
+    out += std::to_string(waiting);
+    out += '\n';
+}
+
+void GroupDebouncer::TimerLoop() {
+    std::unique_lock lock(mutex);
+    while (!stopping) {
+        if (pending.empty()) {
+            changed.wait(lock, [this] { return stopping || !pending.empty(); });
+            continue;
+        }
+
+        auto next = std::chrono::steady_clock::time_point::max();
+        for (const auto& [groupId, entry] : pending) {
+            if (entry.deadline < next) next = entry.deadline;
+        }
+        if (changed.wait_until(lock, next, [this] { return stopping; })) break;
+
+        // Sacar los vencidos y evaluarlos sin el candado (Dispatch puede bloquear)
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<std::pair<std::string, Pending>> expired;
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (it->second.deadline <= now) {
+                expired.emplace_back(it->first, std::move(it->second));
+                it = pending.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        lock.unlock();
+        for (auto& [groupId, entry] : expired) {
+            Fire(groupId, std::move(entry));
+        }
+        lock.lock();
+    }
+}
+
+void GroupDebouncer::Fire(const std::string& groupId, Pending entry) {
+    {
+        std::lock_guard lock(mutex);
+        ++stats.evaluations;
+    }
+    const std::string tournamentId = entry.tournamentId;
+    // El trabajo no toca `this`: puede correr después de destruir el debouncer
+    auto work = [evaluate = evaluate, tournamentId, groupId, acks = std::move(entry.acks)] {
+        RunEvaluation(evaluate, tournamentId, groupId, acks);
+    };
+    if (!dispatcher->Dispatch(tournamentId, work)) {
+        work(); // dispatcher detenido: se evalúa aquí para no perder los acks
+    }
+}
@@ -1,6 +1,5 @@
 #include "consumer/MatchGenerationConsumer.hpp"
 #include "util/RoundRobinGenerator.hpp"
-#include "domain/Group.hpp"
 #include "domain/Match.hpp"
 #include <iostream>
 
@@ -23,78 +22,41 @@ void MatchGenerationConsumer::Handle(const nlohmann::json& eventJson) {
             return;
         }
         
-        // Get tournament to know max teams per group
-        auto tournament = tournamentRepo->ReadById(tournamentId);
-        if (!tournament) {
-            std::cerr << "MatchGenerationConsumer: Tournament not found: " << tournamentId << std::endl;
-            return;
-        }
-        
-        int maxTeamsPerGroup = tournament->Format().MaxTeamsPerGroup();
-        
-        // Check if we should generate matches
-        if (ShouldGenerateMatches(groupId, maxTeamsPerGroup)) {
-            GenerateMatchesForGroup(tournamentId, groupId);
-        }
-        
+        EvaluateGroup(tournamentId, groupId);
     } catch (const std::exception& e) {
         std::cerr << "MatchGenerationConsumer: Error handling event: " << e.what() << std::endl;
     }
 }
 
-bool MatchGenerationConsumer::ShouldGenerateMatches(const std::string& groupId, int maxTeamsPerGroup) {
-    // Check if group has reached maximum teams
-    int teamCount = groupRepo->CountTeamsInGroup(groupId);
+void MatchGenerationConsumer::EvaluateGroup(const std::string& tournamentId, const std::string& groupId) {
+    // Get tournament to know max teams per group
+    auto tournament = tournamentRepo->ReadById(tournamentId);
+    if (!tournament) {
+        std::cerr << "MatchGenerationConsumer: Tournament not found: " << tournamentId << std::endl;
+        return;
+    }
     
-    if (teamCount < maxTeamsPerGroup) {
-        return false;  // Not all teams added yet
+    const int maxTeamsPerGroup = tournament->Format().MaxTeamsPerGroup();
+    
+    // Una lectura trae a la vez el conteo y los equipos para el fixture
+    const auto teams = groupRepo->GetTeamsOfGroup(groupId);
+    if (static_cast<int>(teams.size()) < maxTeamsPerGroup) {
+        return;  // Not all teams added yet
     }
     
-    // For round-robin, matches are associated with the tournament, not the group
-    // We'll check in GenerateMatchesForGroup using tournamentId
+    // Generate matches using RoundRobinGenerator with empty groupId
+    // Round-robin tournaments don't use groups for matches
+    const auto matches = RoundRobinGenerator::Generate(teams, tournamentId, "");
+    if (matches.empty()) {
+        return;
+    }
     
-    return true;
-}
-
-void MatchGenerationConsumer::GenerateMatchesForGroup(const std::string& tournamentId, const std::string& groupId) {
-    try {
-        // Check if matches already exist for this tournament
-        auto existingMatches = matchRepo->FindByTournamentId(tournamentId);
-        if (!existingMatches.empty()) {
-            std::cout << "MatchGenerationConsumer: Matches already exist for tournament " << tournamentId << std::endl;
-            return;
-        }
-        
-        // Get group with teams
-        std::shared_ptr<domain::Group> group;
-        auto error = groupRepo->GetGroup(tournamentId, groupId, group);
-        
-        if (error.has_value() || !group) {
-            std::cerr << "MatchGenerationConsumer: Failed to get group: " << groupId << std::endl;
-            return;
-        }
-        
-        // Generate matches using RoundRobinGenerator with empty groupId
-        // Round-robin tournaments don't use groups for matches
-        auto matches = RoundRobinGenerator::Generate(group->Teams(), tournamentId, "");
-        
-        std::cout << "MatchGenerationConsumer: Generated " << matches.size() 
-                  << " round-robin matches for tournament " << tournamentId << std::endl;
-        
-        // Persist matches
-        for (const auto& match : matches) {
-            try {
-                matchRepo->Create(match);
-            } catch (const std::exception& e) {
-                std::cerr << "MatchGenerationConsumer: Failed to create match: " << e.what() << std::endl;
-            }
-        }
-        
-        std::cout << "MatchGenerationConsumer: Successfully created matches for tournament " << tournamentId << std::endl;
-        
-    } catch (const std::exception& e) {
-        std::cerr << "MatchGenerationConsumer: Error generating matches: " << e.what() << std::endl;
+    // Todo o nada, y sólo si el torneo aún no tiene partidos
+    if (!matchRepo->CreateFixtures(tournamentId, matches)) {
+        std::cout << "MatchGenerationConsumer: Matches already exist for tournament " << tournamentId << std::endl;
+        return;
     }
+    
+    std::cout << "MatchGenerationConsumer: Created " << matches.size()
+              << " round-robin matches for tournament " << tournamentId << std::endl;
 }
-
-
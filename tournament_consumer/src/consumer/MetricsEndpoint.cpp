@@ -0,0 +1,41 @@
+#include "consumer/MetricsEndpoint.hpp"
+
+#include <iostream>
+
+MetricsEndpoint::MetricsEndpoint(std::shared_ptr<ConsumerMetrics> metrics, MetricsOptions options)
+    : metrics(std::move(metrics)), options(std::move(options)) {
+    CROW_ROUTE(app, "/metrics")([this] {
+        crow::response res{crow::OK, this->metrics->Render()};
+        res.add_header("content-type", "text/plain; version=0.0.4");
+        return res;
+    });
+}
+
+MetricsEndpoint::~MetricsEndpoint() {
+    Stop();
+}
+
+bool MetricsEndpoint::Start() {
+    if (options.port == 0 || server.valid()) return options.port != 0;
+    // Las señales quedan para main: SIGINT/SIGTERM no deben cerrar sólo este servidor
+    app.loglevel(crow::LogLevel::Warning)
+        .signal_clear()
+        .bindaddr(options.bindAddress)
+        .port(options.port)
+        .concurrency(1);
+    server = app.run_async();
+    // Puerto ocupado o dirección inválida: Crow lo registra y no arranca
+    if (app.wait_for_server_start() == std::cv_status::timeout) {
+        std::cerr << "[Consumer] Metrics endpoint did not start on " << Address() << std::endl;
+        Stop();
+        return false;
+    }
+    return true;
+}
+
+void MetricsEndpoint::Stop() {
+    if (!server.valid()) return;
+    app.stop();
+    server.wait();
+    server = {};
+}
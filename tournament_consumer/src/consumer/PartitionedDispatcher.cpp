@@ -0,0 +1,111 @@
+#include "consumer/PartitionedDispatcher.hpp"
+
+#include <exception>
+#include <iostream>
+#include <string>
+
+PartitionedDispatcher::PartitionedDispatcher(DispatcherOptions options)
+    : queueCapacity(options.queueCapacity) {
+    partitions.reserve(options.workers);
+    for (std::size_t i = 0; i < options.workers; ++i) {
+        partitions.push_back(std::make_unique<Partition>());
+    }
+    for (auto& partition : partitions) {
+        partition->thread = std::thread([this, p = partition.get()] { Run(*p); });
+    }
+}
+
+PartitionedDispatcher::~PartitionedDispatcher() {
+    Stop();
+}
+
+std::size_t PartitionedDispatcher::WorkerFor(std::string_view partitionKey) const {
+    return std::hash<std::string_view>{}(partitionKey) % partitions.size();
+}
+
+bool PartitionedDispatcher::Dispatch(std::string_view partitionKey, Work work) {
+    auto& partition = *partitions[WorkerFor(partitionKey)];
+    {
+        std::unique_lock lock(partition.mutex);
+        partition.changed.wait(lock, [&] { return partition.stopping || partition.queue.size() < queueCapacity; });
+        if (partition.stopping) return false;
+        partition.queue.push_back(std::move(work));
+    }
+    partition.changed.notify_all();
+    return true;
+}
+
+PartitionedDispatcher::TryResult PartitionedDispatcher::TryDispatch(std::string_view partitionKey, Work& work) {
+    auto& partition = *partitions[WorkerFor(partitionKey)];
+    {
+        std::lock_guard lock(partition.mutex);
+        if (partition.stopping) return TryResult::Stopped;
+        if (partition.queue.size() >= queueCapacity) return TryResult::Full;
+        partition.queue.push_back(std::move(work));
+    }
+    partition.changed.notify_all();
+    return TryResult::Accepted;
+}
+
+std::size_t PartitionedDispatcher::Pending(std::size_t worker) {
+    auto& partition = *partitions.at(worker);
+    std::lock_guard lock(partition.mutex);
+    return partition.queue.size();
+}
+
+void PartitionedDispatcher::RenderMetrics(std::string& out) const {
+    out += "# HELP tournament_consumer_worker_queue_depth Messages waiting for each worker.\n"
+           "# TYPE tournament_consumer_worker_queue_depth gauge\n";
+    for (std::size_t worker = 0; worker < partitions.size(); ++worker) {
+        std::size_t depth;
+        {
+            std::lock_guard lock(partitions[worker]->mutex);
+            depth = partitions[worker]->queue.size();
+        }
+        out += "tournament_consumer_worker_queue_depth{worker=\"";
+        out += std::to_string(worker);
+        out += "\"} ";
+        out += std::to_string(depth);
+        out += '\n';
+    }
+    out += "# HELP tournament_consumer_worker_queue_capacity Queue size per worker.\n"
+           "# TYPE tournament_consumer_worker_queue_capacity gauge\n"
+           "tournament_consumer_worker_queue_capacity ";
+    out += std::to_string(queueCapacity);
+    out += '\n';
+}
+
+void PartitionedDispatcher::Stop() {
+    for (auto& partition : partitions) {
+        {
+            std::lock_guard lock(partition->mutex);
+            partition->stopping = true;
+        }
+        partition->changed.notify_all();
+    }
+    for (auto& partition : partitions) {
+        if (partition->thread.joinable()) {
+            partition->thread.join();
+        }
+    }
+}
+
+void PartitionedDispatcher::Run(Partition& partition) {
+    while (true) {
+        Work work;
+        {
+            std::unique_lock lock(partition.mutex);
+            partition.changed.wait(lock, [&] { return partition.stopping || !partition.queue.empty(); });
+            if (partition.queue.empty()) return; // detenido y sin pendientes
+            work = std::move(partition.queue.front());
+            partition.queue.pop_front();
+        }
+        partition.changed.notify_all(); // hay lugar para el receptor
+
+        try {
+            work();
+        } catch (const std::exception& e) {
+            std::cerr << "[Dispatcher] Unhandled error in worker: " << e.what() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#include "consumer/ProcessedEventCache.hpp"
+
+ProcessedEventCache::ProcessedEventCache(DedupOptions options)
+    : capacity(options.cacheSize) {
+    index.reserve(capacity);
+}
+
+bool ProcessedEventCache::Seen(std::string_view eventId) {
+    if (capacity == 0 || eventId.empty()) return false;
+    std::lock_guard lock(mutex);
+    const auto it = index.find(eventId);
+    if (it == index.end()) return false;
+    order.splice(order.begin(), order, it->second);
+    ++stats.hits;
+    return true;
+}
+
+void ProcessedEventCache::Remember(std::string_view eventId) {
+    if (capacity == 0 || eventId.empty()) return;
+    std::lock_guard lock(mutex);
+    if (const auto it = index.find(eventId); it != index.end()) {
+        order.splice(order.begin(), order, it->second);
+        return;
+    }
+    if (order.size() == capacity) {
+        index.erase(order.back());
+        order.pop_back();
+        ++stats.evictions;
+    }
+    // La clave del índice apunta al string del nodo: splice no lo mueve
+    order.emplace_front(eventId);
+    index.emplace(order.front(), order.begin());
+}
+
+void ProcessedEventCache::RenderMetrics(std::string& out) const {
+    const auto current = GetStats();
+    out += "# HELP tournament_consumer_dedup_cache_entries Event ids remembered in memory.\n"
+           "# TYPE tournament_consumer_dedup_cache_entries gauge\n"
+           "tournament_consumer_dedup_cache_entries ";
+    out += std::to_string(current.size);
+    out += "\n# HELP tournament_consumer_dedup_cache_evictions_total Event ids forgotten to stay within cacheSize.\n"
+           "# TYPE tournament_consumer_dedup_cache_evictions_total counter\n"
+           "tournament_consumer_dedup_cache_evictions_total ";
+    out += std::to_string(current.evictions);
+    out += '\n';
+}
+
+ProcessedEventCache::Stats ProcessedEventCache::GetStats() const {
+    std::lock_guard lock(mutex);
+    Stats current = stats;
+    current.size = order.size();
+    return current;
+}
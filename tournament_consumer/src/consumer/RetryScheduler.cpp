@@ -0,0 +1,119 @@
+#include "consumer/RetryScheduler.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <utility>
+
+RetryScheduler::RetryScheduler(RetryOptions options)
+    : options(std::move(options)), wheel(this->options.wheelSlots) {
+    thread = std::thread([this] { Run(); });
+}
+
+RetryScheduler::~RetryScheduler() {
+    Stop();
+}
+
+std::chrono::milliseconds RetryScheduler::BackoffFor(int attempt) const {
+    auto delay = options.initialDelay;
+    for (int i = 2; i < attempt && delay < options.maxDelay; ++i) {
+        delay *= 2;
+    }
+    return std::min(delay, options.maxDelay);
+}
+
+std::chrono::milliseconds RetryScheduler::DelayFor(int attempt) {
+    const auto base = static_cast<double>(BackoffFor(attempt).count());
+    std::uniform_real_distribution<double> spread(1.0 - options.jitter, 1.0 + options.jitter);
+    std::lock_guard lock(mutex);
+    return std::chrono::milliseconds(static_cast<std::int64_t>(base * spread(random)));
+}
+
+bool RetryScheduler::Schedule(std::chrono::milliseconds delay, Work work) {
+    const auto slots = wheel.size();
+    // Al menos un tick: el cursor ya pasó por la ranura actual
+    const auto ticks = std::max<std::size_t>(
+        1, static_cast<std::size_t>((delay + options.tick - std::chrono::milliseconds(1)) / options.tick));
+    {
+        std::lock_guard lock(mutex);
+        if (stopping) return false;
+        wheel[(cursor + ticks) % slots].push_back(Timer{(ticks - 1) / slots, std::move(work)});
+        ++stats.scheduled;
+        ++stats.pending;
+    }
+    return true;
+}
+
+void RetryScheduler::Stop() {
+    {
+        std::lock_guard lock(mutex);
+        if (stopping) return;
+        stopping = true;
+    }
+    changed.notify_all();
+    if (thread.joinable()) thread.join();
+
+    std::lock_guard lock(mutex);
+    for (auto& slot : wheel) {
+        stats.dropped += slot.size();
+        slot.clear();
+    }
+    stats.pending = 0;
+}
+
+RetryScheduler::Stats RetryScheduler::GetStats() const {
+    std::lock_guard lock(mutex);
+    return stats;
+}
+
+void RetryScheduler::RenderMetrics(std::string& out) const {
+    const auto current = GetStats();
+    out += "# HELP tournament_consumer_retries_pending Failed messages waiting for their next attempt.\n"
+           "# TYPE tournament_consumer_retries_pending gauge\n"
+           "tournament_consumer_retries_pending ";
+    out += std::to_string(current.pending);
+    out += "\n# HELP tournament_consumer_retries_fired_total Retries handed back to the workers.\n"
+           "# TYPE tournament_consumer_retries_fired_total counter\n"
+           "tournament_consumer_retries_fired_total ";
+    out += std::to_string(current.fired);
+    out += '\n';
+}
+
+void RetryScheduler::Run() {
+    auto next = std::chrono::steady_clock::now() + options.tick;
+    std::unique_lock lock(mutex);
+    while (!changed.wait_until(lock, next, [this] { return stopping; })) {
+        // Si el hilo se atrasó, los ticks perdidos se recorren uno por uno
+        next += options.tick;
+        cursor = (cursor + 1) % wheel.size();
+
+        auto& slot = wheel[cursor];
+        if (slot.empty()) continue;
+        std::vector<Work> due;
+        std::vector<Timer> waiting;
+        for (auto& timer : slot) {
+            if (timer.rounds == 0) {
+                due.push_back(std::move(timer.work));
+            } else {
+                --timer.rounds;
+                waiting.push_back(std::move(timer));
+            }
+        }
+        slot.swap(waiting);
+        if (due.empty()) continue;
+        stats.fired += due.size();
+        stats.pending -= due.size();
+
+        // Sin el candado: el trabajo suele reencolar en el dispatcher, que
+        // puede bloquear, o volver a agendar
+        lock.unlock();
+        for (auto& work : due) {
+            try {
+                work();
+            } catch (const std::exception& e) {
+                std::cerr << "RetryScheduler: Error running retry: " << e.what() << std::endl;
+            }
+        }
+        lock.lock();
+    }
+}
@@ -12,38 +12,53 @@ ScoreProcessingConsumer::ScoreProcessingConsumer(
     tournamentRepo(std::move(tournamentRepo)) {
 }
 
-void ScoreProcessingConsumer::Handle(const nlohmann::json& eventJson) {
-    try {
-        std::string tournamentId = eventJson.value("tournamentId", "");
-        std::string matchId = eventJson.value("matchId", "");
-        
-        if (tournamentId.empty() || matchId.empty()) {
-            std::cerr << "ScoreProcessingConsumer: Missing tournamentId or matchId" << std::endl;
-            return;
-        }
-        
-        std::cout << "ScoreProcessingConsumer: Processing score update for match " 
-                  << matchId << " in tournament " << tournamentId << std::endl;
-        
-        // First, try to advance if it's a knockout match
-        ProcessKnockoutAdvancement(tournamentId, matchId);
+void ScoreProcessingConsumer::Handle(const nlohmann::json& eventJson, std::string_view eventId) {
+    std::string tournamentId = eventJson.value("tournamentId", "");
+    std::string matchId = eventJson.value("matchId", "");
+    
+    if (tournamentId.empty() || matchId.empty()) {
+        std::cerr << "ScoreProcessingConsumer: Missing tournamentId or matchId" << std::endl;
+        return;
+    }
+    
+    std::cout << "ScoreProcessingConsumer: Processing score update for match " 
+              << matchId << " in tournament " << tournamentId << std::endl;
+    
+    // Una sola lectura; avance y cambio de fase se calculan sobre ella
+    // (el avance sólo coloca equipos, no cambia qué partidos están jugados)
+    const auto allMatches = matchRepo->FindByTournamentId(tournamentId);
 
-        // Then check if we need to transition phases or finish
-        CheckTournamentCompletion(tournamentId);
-        
-    } catch (const std::exception& e) {
-        std::cerr << "ScoreProcessingConsumer: Error handling event: " << e.what() << std::endl;
+    ScoreEffects effects;
+    const auto winnerId = CollectKnockoutAdvancement(allMatches, matchId, effects);
+    CollectTournamentCompletion(tournamentId, allMatches, effects);
+    if (effects.Empty()) {
+        return;
+    }
+
+    // Efectos + marca del evento en una transacción
+    if (!matchRepo->ApplyScoreEffects(ConsumerName, eventId, tournamentId, effects)) {
+        std::cout << "ScoreProcessingConsumer: Event " << eventId << " already processed, skipping" << std::endl;
+        return;
+    }
+
+    for (const auto& advanced : effects.advanced) {
+        std::cout << "ScoreProcessingConsumer: Advanced " << winnerId << " to match " << advanced.Id << std::endl;
+    }
+    if (!effects.playoffs.empty()) {
+        std::cout << "ScoreProcessingConsumer: Created " << effects.playoffs.size() << " Playoff matches." << std::endl;
     }
+    PublishAdvancement(tournamentId, matchId, winnerId, effects);
 }
 
-void ScoreProcessingConsumer::ProcessKnockoutAdvancement(const std::string& tournamentId, const std::string& matchId) {
-    auto matchPtr = matchRepo->FindByTournamentIdAndMatchId(tournamentId, matchId);
-    if (!matchPtr) return;
+std::string ScoreProcessingConsumer::CollectKnockoutAdvancement(const Matches& allMatches, const std::string& matchId,
+                                                                ScoreEffects& effects) {
+    const auto scored = std::ranges::find_if(allMatches, [&](const auto& m) { return m && m->Id == matchId; });
+    if (scored == allMatches.end()) return {};
     
-    domain::Match& match = *matchPtr;
+    const domain::Match& match = **scored;
     
-    if (match.Phase != domain::MatchPhase::Knockout) return;
-    if (!match.IsScored()) return;
+    if (match.Phase != domain::MatchPhase::Knockout) return {};
+    if (!match.IsScored()) return {};
     
     // Determine winner
     int homeScore = *match.HomeScore;
@@ -62,60 +77,38 @@ void ScoreProcessingConsumer::ProcessKnockoutAdvancement(const std::string& tour
     std::string placeholder = "W(" + match.HomeTeamId + "-" + match.AwayTeamId + ")";
     
     // Find future matches using this placeholder
-    auto allMatches = matchRepo->FindByTournamentId(tournamentId); // Maybe filter pending?
-    
-    for (auto& mPtr : allMatches) {
+    for (const auto& mPtr : allMatches) {
         if (!mPtr) continue;
+        domain::Match next = *mPtr;
         bool modified = false;
-        if (mPtr->HomeTeamId == placeholder) {
-            mPtr->HomeTeamId = winnerId;
+        if (next.HomeTeamId == placeholder) {
+            next.HomeTeamId = winnerId;
             modified = true;
         }
-        if (mPtr->AwayTeamId == placeholder) {
-            mPtr->AwayTeamId = winnerId;
+        if (next.AwayTeamId == placeholder) {
+            next.AwayTeamId = winnerId;
             modified = true;
         }
         
         if (modified) {
-            matchRepo->Update(*mPtr);
-            std::cout << "ScoreProcessingConsumer: Advanced " << winnerId << " to match " << mPtr->Id << std::endl;
+            effects.advanced.push_back(std::move(next));
         }
     }
-}
-
-void ScoreProcessingConsumer::GeneratePlayoffs(const std::string& tournamentId, const std::vector<domain::Match>& rrMatches) {
-    std::cout << "ScoreProcessingConsumer: Generating Playoffs for tournament " << tournamentId << std::endl;
-    
-    standings::StandingsCalculator calc;
-    auto table = calc.Compute(rrMatches);
-    
-    // Assume Top 8. If fewer than 8 teams, logic handles it? 
-    // The Builder requires 8 seeds for BuildTop8, or uses BuildTop8FromSeeds which checks size.
-    // Let's use the table to get seeds.
-    auto koMatches = KnockoutBracketBuilder::BuildTop8(table, tournamentId);
-    
-    if (koMatches.empty()) {
-        std::cerr << "ScoreProcessingConsumer: Not enough teams for Playoffs or error generating bracket." << std::endl;
-        return;
-    }
-    
-    for (const auto& m : koMatches) {
-        matchRepo->Create(m);
+    if (!effects.advanced.empty()) {
+        effects.placeholder = placeholder;
+        effects.winnerId = winnerId;
     }
-    
-    std::cout << "ScoreProcessingConsumer: Created " << koMatches.size() << " Playoff matches." << std::endl;
+    return winnerId;
 }
 
-void ScoreProcessingConsumer::CheckTournamentCompletion(const std::string& tournamentId) {
-    // Get all matches
-    auto allMatchesPtrs = matchRepo->FindByTournamentId(tournamentId);
-    
+void ScoreProcessingConsumer::CollectTournamentCompletion(const std::string& tournamentId, const Matches& allMatches,
+                                                          ScoreEffects& effects) {
     std::vector<domain::Match> rrMatches;
     bool hasKnockout = false;
     bool allRRComplete = true;
     bool allKOComplete = true;
     
-    for (const auto& mPtr : allMatchesPtrs) {
+    for (const auto& mPtr : allMatches) {
         if (!mPtr) continue;
         if (mPtr->Phase == domain::MatchPhase::Knockout) {
             hasKnockout = true;
@@ -130,7 +123,15 @@ void ScoreProcessingConsumer::CheckTournamentCompletion(const std::string& tourn
         // We are in RR phase
         if (allRRComplete && !rrMatches.empty()) {
             // RR finished, start Playoffs
-            GeneratePlayoffs(tournamentId, rrMatches);
+            std::cout << "ScoreProcessingConsumer: Generating Playoffs for tournament " << tournamentId << std::endl;
+            
+            standings::StandingsCalculator calc;
+            auto table = calc.Compute(rrMatches);
+            effects.playoffs = KnockoutBracketBuilder::BuildTop8(table, tournamentId);
+            
+            if (effects.playoffs.empty()) {
+                std::cerr << "ScoreProcessingConsumer: Not enough teams for Playoffs or error generating bracket." << std::endl;
+            }
         } else {
              std::cout << "ScoreProcessingConsumer: Round Robin in progress." << std::endl;
         }
@@ -145,10 +146,21 @@ void ScoreProcessingConsumer::CheckTournamentCompletion(const std::string& tourn
     }
 }
 
-bool ScoreProcessingConsumer::AllMatchesCompleted(const std::string& tournamentId) {
-    // This method might be redundant now with the new logic inside CheckTournamentCompletion
-    // Keeping it if needed for other checks, but implementing via Repo
-    int totalMatches = matchRepo->CountTotalMatchesByTournament(tournamentId);
-    int completedMatches = matchRepo->CountCompletedMatchesByTournament(tournamentId);
-    return totalMatches > 0 && completedMatches == totalMatches;
+void ScoreProcessingConsumer::PublishAdvancement(const std::string& tournamentId, const std::string& fromMatchId,
+                                                 const std::string& winnerId, const ScoreEffects& effects) {
+    if (!liveEvents) return;
+    for (const auto& next : effects.advanced) {
+        try {
+            liveEvents->Publish(tournamentId, "match.advanced", {
+                {"tournamentId", tournamentId},
+                {"matchId", next.Id},
+                {"fromMatchId", fromMatchId},
+                {"teamId", winnerId},
+                {"homeTeamId", next.HomeTeamId},
+                {"awayTeamId", next.AwayTeamId}
+            });
+        } catch (const std::exception& e) {
+            std::cerr << "ScoreProcessingConsumer: live event not published: " << e.what() << std::endl;
+        }
+    }
 }
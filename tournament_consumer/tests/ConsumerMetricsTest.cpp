@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "consumer/ConsumerMetrics.hpp"
+
+namespace {
+    bool Contains(const std::string& text, const std::string& line) {
+        return text.find(line) != std::string::npos;
+    }
+}
+
+TEST(ConsumerMetricsTest, QueueCountersAreRenderedPerQueue) {
+    ConsumerMetrics metrics;
+    auto& scores = metrics.Queue("tournament.match.score_updated");
+    EXPECT_EQ(&metrics.Queue("tournament.match.score_updated"), &scores);
+
+    scores.received += 3;
+    scores.processed += 2;
+    scores.retried += 1;
+    scores.inFlight = 1;
+    scores.lag.Record(std::chrono::milliseconds(40));
+    scores.lastLagMillis = 40;
+    metrics.Queue("tournament.group.team_added").received += 5;
+
+    const auto text = metrics.Render();
+    EXPECT_TRUE(Contains(text, "tournament_consumer_messages_received_total{queue=\"tournament.match.score_updated\"} 3\n"));
+    EXPECT_TRUE(Contains(text, "tournament_consumer_messages_received_total{queue=\"tournament.group.team_added\"} 5\n"));
+    EXPECT_TRUE(Contains(text, "tournament_consumer_messages_processed_total{queue=\"tournament.match.score_updated\"} 2\n"));
+    EXPECT_TRUE(Contains(text, "tournament_consumer_messages_retried_total{queue=\"tournament.match.score_updated\"} 1\n"));
+    EXPECT_TRUE(Contains(text, "tournament_consumer_messages_in_flight{queue=\"tournament.match.score_updated\"} 1\n"));
+    EXPECT_TRUE(Contains(text, "tournament_consumer_lag_seconds_bucket{queue=\"tournament.match.score_updated\",le=\"0.05\"} 1\n"));
+    EXPECT_TRUE(Contains(text, "tournament_consumer_last_lag_seconds{queue=\"tournament.match.score_updated\"} 0.040000\n"));
+}
+
+TEST(ConsumerMetricsTest, TimeRecordsDurationAndErrors) {
+    ConsumerMetrics metrics;
+    auto& handler = metrics.Handler("ScoreProcessingConsumer::Handle");
+
+    metrics.Time(handler, [] { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    EXPECT_THROW(metrics.Time(handler, [] { throw std::runtime_error("db down"); }), std::runtime_error);
+
+    const auto duration = handler.duration.Read();
+    EXPECT_EQ(duration.total, 2u);
+    EXPECT_GE(duration.sumMicros, 2'000u);
+    EXPECT_EQ(handler.errors, 1u);
+
+    const auto text = metrics.Render();
+    EXPECT_TRUE(Contains(text, "tournament_consumer_handler_duration_seconds_count{handler=\"ScoreProcessingConsumer::Handle\"} 2\n"));
+    EXPECT_TRUE(Contains(text, "tournament_consumer_handler_errors_total{handler=\"ScoreProcessingConsumer::Handle\"} 1\n"));
+}
+
+TEST(ConsumerMetricsTest, CollectorsAreAppendedAndSummaryAddsUpQueues) {
+    ConsumerMetrics metrics;
+    metrics.AddCollector([](std::string& out) { out += "extra_metric 7\n"; });
+    metrics.Queue("a").received += 2;
+    metrics.Queue("b").received += 3;
+    metrics.Queue("b").failed += 1;
+
+    EXPECT_TRUE(Contains(metrics.Render(), "extra_metric 7\n"));
+    EXPECT_TRUE(Contains(metrics.Summary(), "received=5 processed=0 failed=1"));
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "consumer/GroupDebouncer.hpp"
+
+namespace {
+    DebounceOptions Window(int milliseconds) {
+        DebounceOptions options;
+        options.window = std::chrono::milliseconds(milliseconds);
+        return options;
+    }
+
+    std::shared_ptr<PartitionedDispatcher> Dispatcher() {
+        DispatcherOptions options;
+        options.workers = 2;
+        options.queueCapacity = 16;
+        return std::make_shared<PartitionedDispatcher>(options);
+    }
+
+    struct Recorder {
+        std::mutex mutex;
+        std::vector<std::string> evaluations;
+        std::atomic<int> acks{0};
+
+        GroupDebouncer::Evaluate Evaluate() {
+            return [this](const std::string& tournamentId, const std::string& groupId) {
+                std::lock_guard lock(mutex);
+                evaluations.push_back(tournamentId + "/" + groupId);
+            };
+        }
+
+        GroupDebouncer::Ack Ack() {
+            return [this](std::exception_ptr error) {
+                EXPECT_EQ(error, nullptr);
+                ++acks;
+            };
+        }
+
+        std::vector<std::string> Evaluations() {
+            std::lock_guard lock(mutex);
+            return evaluations;
+        }
+    };
+
+    void WaitForAcks(const Recorder& recorder, int expected) {
+        const auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (recorder.acks < expected && std::chrono::steady_clock::now() < limit) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+TEST(GroupDebouncerTest, BurstForOneGroupIsEvaluatedOnce) {
+    Recorder recorder;
+    auto dispatcher = Dispatcher();
+    GroupDebouncer debouncer(dispatcher, Window(50), recorder.Evaluate());
+
+    for (int i = 0; i < 32; ++i) {
+        debouncer.Submit("tourn-1", "group-1", recorder.Ack());
+    }
+    EXPECT_EQ(recorder.acks, 0); // nada se confirma antes de evaluar
+
+    WaitForAcks(recorder, 32);
+    EXPECT_EQ(recorder.acks, 32);
+    EXPECT_EQ(recorder.Evaluations(), std::vector<std::string>{"tourn-1/group-1"});
+    EXPECT_EQ(debouncer.GetStats().received, 32u);
+    EXPECT_EQ(debouncer.GetStats().evaluations, 1u);
+}
+
+TEST(GroupDebouncerTest, DifferentGroupsAreEvaluatedSeparately) {
+    Recorder recorder;
+    auto dispatcher = Dispatcher();
+    GroupDebouncer debouncer(dispatcher, Window(30), recorder.Evaluate());
+
+    debouncer.Submit("tourn-1", "group-1", recorder.Ack());
+    debouncer.Submit("tourn-1", "group-2", recorder.Ack());
+    debouncer.Submit("tourn-2", "group-3", recorder.Ack());
+    debouncer.Submit("tourn-1", "group-1", recorder.Ack());
+
+    WaitForAcks(recorder, 4);
+    auto evaluations = recorder.Evaluations();
+    std::ranges::sort(evaluations);
+    EXPECT_EQ(evaluations, (std::vector<std::string>{"tourn-1/group-1", "tourn-1/group-2", "tourn-2/group-3"}));
+}
+
+TEST(GroupDebouncerTest, EventAfterTheWindowStartsANewEvaluation) {
+    Recorder recorder;
+    auto dispatcher = Dispatcher();
+    GroupDebouncer debouncer(dispatcher, Window(10), recorder.Evaluate());
+
+    debouncer.Submit("tourn-1", "group-1", recorder.Ack());
+    WaitForAcks(recorder, 1);
+    debouncer.Submit("tourn-1", "group-1", recorder.Ack());
+    WaitForAcks(recorder, 2);
+
+    EXPECT_EQ(recorder.Evaluations().size(), 2u);
+}
+
+TEST(GroupDebouncerTest, ShutdownEvaluatesPendingGroupsAndAcks) {
+    Recorder recorder;
+    auto dispatcher = Dispatcher();
+    {
+        GroupDebouncer debouncer(dispatcher, Window(60'000), recorder.Evaluate());
+        debouncer.Submit("tourn-1", "group-1", recorder.Ack());
+        debouncer.Submit("tourn-1", "group-1", recorder.Ack());
+    }
+    dispatcher->Stop();
+
+    EXPECT_EQ(recorder.acks, 2);
+    EXPECT_EQ(recorder.Evaluations().size(), 1u);
+}
+
+TEST(GroupDebouncerTest, FailedEvaluationPassesTheErrorToEveryAck) {
+    std::atomic<int> failures{0};
+    auto dispatcher = Dispatcher();
+    {
+        GroupDebouncer debouncer(dispatcher, Window(60'000),
+                                 [](const std::string&, const std::string&) { throw std::runtime_error("db down"); });
+        const auto ack = [&](std::exception_ptr error) { if (error) ++failures; };
+        debouncer.Submit("tourn-1", "group-1", ack);
+        debouncer.Submit("tourn-1", "group-1", ack);
+    }
+    dispatcher->Stop();
+
+    EXPECT_EQ(failures, 2); // cada mensaje decide su reintento
+}
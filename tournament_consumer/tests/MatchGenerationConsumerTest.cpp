@@ -38,6 +38,7 @@ public:
                 (std::string_view tournamentId, std::string_view teamId),
                 (override));
     MOCK_METHOD(void, UpdateGroupAddTeam, (std::string_view groupId, const std::shared_ptr<domain::Team>& team), (override));
+    MOCK_METHOD(std::optional<std::string>, AddTeams, (std::string_view groupId, const std::vector<std::string>& teamIds, int maxTeams, std::vector<domain::Team>& outAdded), (override));
     MOCK_METHOD(bool, ExistsGroupForTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(int, CountTeamsInGroup, (std::string_view groupId), (override));
     MOCK_METHOD(int, GroupsCountForTournament, (std::string_view tournamentId), (override));
@@ -61,6 +62,15 @@ public:
                 (std::string_view tournamentId, std::string_view matchId),
                 (override));
     MOCK_METHOD(bool, UpdateScore, (std::string_view matchId, int homeScore, int awayScore), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, UpdateScores,
+                (std::string_view tournamentId, const std::vector<ScoreUpdate>& updates), (override));
+    MOCK_METHOD(ScoreUpdateOutcome, UpdateScoreReturning,
+                (std::string_view tournamentId, const ScoreUpdate& update), (override));
+    MOCK_METHOD(bool, CreateFixtures,
+                (std::string_view tournamentId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(bool, ApplyScoreEffects,
+                (std::string_view consumer, std::string_view eventId, std::string_view tournamentId,
+                 const ScoreEffects& effects), (override));
     MOCK_METHOD(int, CountCompletedMatchesByTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(int, CountTotalMatchesByTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByGroupId, (std::string_view groupId), (override));
@@ -96,6 +106,16 @@ protected:
     }
 };
 
+namespace {
+    std::vector<domain::Team> Teams(int count) {
+        std::vector<domain::Team> teams;
+        for (int i = 1; i <= count; ++i) {
+            teams.push_back(domain::Team{"team-" + std::to_string(i), "Team " + std::to_string(i)});
+        }
+        return teams;
+    }
+}
+
 // Test: Generate matches when group is complete with even number of teams
 TEST_F(MatchGenerationConsumerTest, GenerateMatches_EvenTeams_CreatesMatches) {
     nlohmann::json event = {
@@ -110,31 +130,16 @@ TEST_F(MatchGenerationConsumerTest, GenerateMatches_EvenTeams_CreatesMatches) {
     EXPECT_CALL(*mockTournamentRepo, ReadById("tourn-1"))
         .WillOnce(::testing::Return(tournament));
     
-    EXPECT_CALL(*mockGroupRepo, CountTeamsInGroup("group-1"))
-        .WillOnce(::testing::Return(4));
+    // Una sola lectura: conteo y equipos
+    EXPECT_CALL(*mockGroupRepo, GetTeamsOfGroup("group-1"))
+        .WillOnce(::testing::Return(Teams(4)));
+    EXPECT_CALL(*mockGroupRepo, CountTeamsInGroup(::testing::_)).Times(0);
+    EXPECT_CALL(*mockMatchRepo, FindByTournamentId(::testing::_, ::testing::_)).Times(0);
     
-    // Check for existing matches by tournament ID instead of group ID
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", ::testing::_))
-        .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Match>>{}));
-    
-    auto group = std::make_shared<domain::Group>();
-    group->Id() = "group-1";
-    domain::Team team1{"team-1", "Team 1"};
-    domain::Team team2{"team-2", "Team 2"};
-    domain::Team team3{"team-3", "Team 3"};
-    domain::Team team4{"team-4", "Team 4"};
-    group->Teams() = {team1, team2, team3, team4};
-    
-    EXPECT_CALL(*mockGroupRepo, GetGroup("tourn-1", "group-1", ::testing::_))
-        .WillOnce(::testing::DoAll(
-            ::testing::SetArgReferee<2>(group),
-            ::testing::Return(std::nullopt)
-        ));
-    
-    // Should create 6 matches for 4 teams (n*(n-1)/2 = 6)
-    EXPECT_CALL(*mockMatchRepo, Create(::testing::_))
-        .Times(6)
-        .WillRepeatedly(::testing::Return("match-id"));
+    // Should create 6 matches for 4 teams (n*(n-1)/2 = 6), all in one call
+    EXPECT_CALL(*mockMatchRepo, CreateFixtures("tourn-1", ::testing::SizeIs(6)))
+        .WillOnce(::testing::Return(true));
+    EXPECT_CALL(*mockMatchRepo, Create(::testing::_)).Times(0);
     
     consumer->Handle(event);
 }
@@ -152,29 +157,12 @@ TEST_F(MatchGenerationConsumerTest, GenerateMatches_OddTeams_CreatesMatches) {
     EXPECT_CALL(*mockTournamentRepo, ReadById("tourn-1"))
         .WillOnce(::testing::Return(tournament));
     
-    EXPECT_CALL(*mockGroupRepo, CountTeamsInGroup("group-1"))
-        .WillOnce(::testing::Return(3));
-    
-    // Check for existing matches by tournament ID instead of group ID
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", ::testing::_))
-        .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Match>>{}));
-    
-    auto group = std::make_shared<domain::Group>();
-    domain::Team team1{"team-1", "Team 1"};
-    domain::Team team2{"team-2", "Team 2"};
-    domain::Team team3{"team-3", "Team 3"};
-    group->Teams() = {team1, team2, team3};
-    
-    EXPECT_CALL(*mockGroupRepo, GetGroup("tourn-1", "group-1", ::testing::_))
-        .WillOnce(::testing::DoAll(
-            ::testing::SetArgReferee<2>(group),
-            ::testing::Return(std::nullopt)
-        ));
+    EXPECT_CALL(*mockGroupRepo, GetTeamsOfGroup("group-1"))
+        .WillOnce(::testing::Return(Teams(3)));
     
     // Should create 3 matches for 3 teams (n*(n-1)/2 = 3)
-    EXPECT_CALL(*mockMatchRepo, Create(::testing::_))
-        .Times(3)
-        .WillRepeatedly(::testing::Return("match-id"));
+    EXPECT_CALL(*mockMatchRepo, CreateFixtures("tourn-1", ::testing::SizeIs(3)))
+        .WillOnce(::testing::Return(true));
     
     consumer->Handle(event);
 }
@@ -192,11 +180,11 @@ TEST_F(MatchGenerationConsumerTest, NoGeneration_IncompleteGroup) {
     EXPECT_CALL(*mockTournamentRepo, ReadById("tourn-1"))
         .WillOnce(::testing::Return(tournament));
     
-    EXPECT_CALL(*mockGroupRepo, CountTeamsInGroup("group-1"))
-        .WillOnce(::testing::Return(2));  // Only 2 of 4 teams
+    EXPECT_CALL(*mockGroupRepo, GetTeamsOfGroup("group-1"))
+        .WillOnce(::testing::Return(Teams(2)));  // Only 2 of 4 teams
     
-    // Should not attempt to find existing matches or create new ones
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentId(::testing::_, ::testing::_))
+    // Should not attempt to create matches
+    EXPECT_CALL(*mockMatchRepo, CreateFixtures(::testing::_, ::testing::_))
         .Times(0);
     EXPECT_CALL(*mockMatchRepo, Create(::testing::_))
         .Times(0);
@@ -217,15 +205,14 @@ TEST_F(MatchGenerationConsumerTest, NoRegeneration_MatchesExist) {
     EXPECT_CALL(*mockTournamentRepo, ReadById("tourn-1"))
         .WillOnce(::testing::Return(tournament));
     
-    EXPECT_CALL(*mockGroupRepo, CountTeamsInGroup("group-1"))
-        .WillOnce(::testing::Return(4));
+    EXPECT_CALL(*mockGroupRepo, GetTeamsOfGroup("group-1"))
+        .WillOnce(::testing::Return(Teams(4)));
     
-    // Matches already exist for tournament
-    auto existingMatch = std::make_shared<domain::Match>();
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", ::testing::_))
-        .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Match>>{existingMatch}));
+    // El repositorio ve que el torneo ya tiene partidos y no inserta nada
+    EXPECT_CALL(*mockMatchRepo, CreateFixtures("tourn-1", ::testing::_))
+        .WillOnce(::testing::Return(false));
     
-    // Should not create new matches
+    // Should not create new matches one by one either
     EXPECT_CALL(*mockMatchRepo, Create(::testing::_))
         .Times(0);
     
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "consumer/PartitionedDispatcher.hpp"
+
+namespace {
+    DispatcherOptions Options(std::size_t workers, std::size_t capacity) {
+        DispatcherOptions options;
+        options.workers = workers;
+        options.queueCapacity = capacity;
+        return options;
+    }
+
+    // Dos torneos que caen en workers distintos
+    std::pair<std::string, std::string> KeysOnDifferentWorkers(const PartitionedDispatcher& dispatcher) {
+        const std::string first = "tournament-0";
+        for (int i = 1; i < 1000; ++i) {
+            std::string other = "tournament-" + std::to_string(i);
+            if (dispatcher.WorkerFor(other) != dispatcher.WorkerFor(first)) return {first, other};
+        }
+        return {first, first};
+    }
+}
+
+TEST(PartitionedDispatcherTest, SameTournamentIsProcessedInOrder) {
+    std::mutex mutex;
+    std::vector<int> seen;
+    {
+        PartitionedDispatcher dispatcher(Options(4, 8));
+        for (int i = 0; i < 200; ++i) {
+            dispatcher.Dispatch("tournament-a", [&, i] {
+                std::lock_guard lock(mutex);
+                seen.push_back(i);
+            });
+        }
+    } // el destructor procesa lo pendiente
+
+    ASSERT_EQ(seen.size(), 200u);
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(seen[i], i);
+    }
+}
+
+TEST(PartitionedDispatcherTest, SlowTournamentDoesNotBlockOthers) {
+    PartitionedDispatcher dispatcher(Options(4, 8));
+    const auto [slow, fast] = KeysOnDifferentWorkers(dispatcher);
+    ASSERT_NE(dispatcher.WorkerFor(slow), dispatcher.WorkerFor(fast));
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    dispatcher.Dispatch(slow, [released] { released.wait(); });
+
+    std::promise<void> done;
+    auto finished = done.get_future();
+    dispatcher.Dispatch(fast, [&done] { done.set_value(); });
+
+    EXPECT_EQ(finished.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    release.set_value();
+}
+
+TEST(PartitionedDispatcherTest, FullWorkerQueueBlocksTheReceiver) {
+    PartitionedDispatcher dispatcher(Options(1, 2));
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> started;
+    dispatcher.Dispatch("t", [released, &started] {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+
+    dispatcher.Dispatch("t", [] {});
+    dispatcher.Dispatch("t", [] {});
+    EXPECT_EQ(dispatcher.Pending(0), 2u);
+
+    std::atomic<bool> accepted{false};
+    std::thread receiver([&] {
+        dispatcher.Dispatch("t", [] {});
+        accepted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(accepted.load());
+
+    release.set_value();
+    receiver.join();
+    EXPECT_TRUE(accepted.load());
+}
+
+TEST(PartitionedDispatcherTest, TryDispatchDoesNotWaitOnAFullQueue) {
+    PartitionedDispatcher dispatcher(Options(1, 1));
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> started;
+    dispatcher.Dispatch("t", [released, &started] {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+    dispatcher.Dispatch("t", [] {});
+
+    std::atomic<int> ran{0};
+    PartitionedDispatcher::Work work = [&ran] { ++ran; };
+    EXPECT_EQ(dispatcher.TryDispatch("t", work), PartitionedDispatcher::TryResult::Full);
+    ASSERT_TRUE(static_cast<bool>(work)); // sigue siendo del que llama
+
+    release.set_value();
+    while (dispatcher.Pending(0) != 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(dispatcher.TryDispatch("t", work), PartitionedDispatcher::TryResult::Accepted);
+
+    dispatcher.Stop();
+    EXPECT_EQ(ran.load(), 1);
+    PartitionedDispatcher::Work late = [] {};
+    EXPECT_EQ(dispatcher.TryDispatch("t", late), PartitionedDispatcher::TryResult::Stopped);
+}
+
+TEST(PartitionedDispatcherTest, RejectsWorkAfterStopAndSurvivesThrowingHandlers) {
+    PartitionedDispatcher dispatcher(Options(2, 4));
+    std::atomic<int> processed{0};
+    dispatcher.Dispatch("t", [] { throw std::runtime_error("boom"); });
+    dispatcher.Dispatch("t", [&processed] { ++processed; });
+    dispatcher.Stop();
+
+    EXPECT_EQ(processed.load(), 1);
+    EXPECT_FALSE(dispatcher.Dispatch("t", [&processed] { ++processed; }));
+    EXPECT_EQ(processed.load(), 1);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "consumer/ProcessedEventCache.hpp"
+
+namespace {
+    DedupOptions Size(std::size_t cacheSize) {
+        DedupOptions options;
+        options.cacheSize = cacheSize;
+        return options;
+    }
+}
+
+TEST(ProcessedEventCacheTest, RemembersProcessedEvents) {
+    ProcessedEventCache cache(Size(4));
+    EXPECT_FALSE(cache.Seen("evt-1"));
+
+    cache.Remember("evt-1");
+    EXPECT_TRUE(cache.Seen("evt-1"));
+    EXPECT_FALSE(cache.Seen("evt-2"));
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+}
+
+TEST(ProcessedEventCacheTest, EvictsTheLeastRecentlyUsed) {
+    ProcessedEventCache cache(Size(2));
+    cache.Remember("evt-1");
+    cache.Remember("evt-2");
+    EXPECT_TRUE(cache.Seen("evt-1")); // evt-2 queda como el más viejo
+
+    cache.Remember("evt-3");
+    EXPECT_TRUE(cache.Seen("evt-1"));
+    EXPECT_FALSE(cache.Seen("evt-2"));
+    EXPECT_TRUE(cache.Seen("evt-3"));
+    EXPECT_EQ(cache.GetStats().size, 2u);
+    EXPECT_EQ(cache.GetStats().evictions, 1u);
+}
+
+TEST(ProcessedEventCacheTest, RememberingTwiceKeepsOneEntry) {
+    ProcessedEventCache cache(Size(2));
+    cache.Remember("evt-1");
+    cache.Remember("evt-1");
+    cache.Remember("evt-2");
+    EXPECT_TRUE(cache.Seen("evt-1"));
+    EXPECT_TRUE(cache.Seen("evt-2"));
+    EXPECT_EQ(cache.GetStats().evictions, 0u);
+}
+
+TEST(ProcessedEventCacheTest, ZeroSizeOrEmptyIdDisablesIt) {
+    ProcessedEventCache disabled(Size(0));
+    disabled.Remember("evt-1");
+    EXPECT_FALSE(disabled.Seen("evt-1"));
+
+    ProcessedEventCache cache(Size(4));
+    cache.Remember("");
+    EXPECT_FALSE(cache.Seen(""));
+    EXPECT_EQ(cache.GetStats().size, 0u);
+}
+
+TEST(ProcessedEventCacheTest, ConcurrentUseStaysBounded) {
+    ProcessedEventCache cache(Size(64));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < 2000; ++i) {
+                const auto id = "evt-" + std::to_string(t) + "-" + std::to_string(i);
+                cache.Remember(id);
+                cache.Seen(id);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(cache.GetStats().size, 64u);
+}
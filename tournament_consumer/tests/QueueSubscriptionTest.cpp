@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cms/testing/FakeBroker.hpp"
+#include "consumer/QueueSubscription.hpp"
+
+namespace {
+    using std::chrono::milliseconds;
+
+    constexpr const char* kQueue = "tournament.team-add";
+
+    template<typename Predicate>
+    bool WaitFor(Predicate done, std::chrono::seconds limit = std::chrono::seconds(5)) {
+        const auto deadline = std::chrono::steady_clock::now() + limit;
+        while (!done() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(milliseconds(2));
+        }
+        return done();
+    }
+
+    std::string Event(const std::string& tournamentId) {
+        return nlohmann::json{{"tournamentId", tournamentId}, {"teamId", "t-1"}}.dump();
+    }
+
+    struct QueueSubscriptionTest : ::testing::Test {
+        std::shared_ptr<fakecms::Broker> broker = std::make_shared<fakecms::Broker>();
+        SubscriptionRuntime runtime;
+        std::unique_ptr<QueueSubscription> subscription;
+
+        // Lo que vio el handler
+        std::mutex mutex;
+        std::vector<int> attempts;
+        std::vector<QueueSubscription::Ack> pending;
+
+        QueueSubscriptionTest() {
+            runtime.connectionManager = std::make_shared<ConnectionManager>();
+            runtime.connectionManager->initialize(std::make_unique<fakecms::FakeConnectionFactory>(broker));
+            runtime.dispatcher = std::make_shared<PartitionedDispatcher>(DispatcherOptions{2, 16});
+            runtime.deadLetters = std::make_shared<DeadLetterSender>(runtime.connectionManager, "DLQ.");
+            runtime.metrics = std::make_shared<ConsumerMetrics>();
+            runtime.options.drainTimeout = milliseconds(200);
+            UseRetries(3);
+        }
+
+        ~QueueSubscriptionTest() override {
+            // Mismo orden que main: suscripción, reintentos, workers
+            subscription.reset();
+            if (runtime.retries) runtime.retries->Stop();
+            runtime.dispatcher->Stop();
+        }
+
+        void UseRetries(int maxAttempts) {
+            RetryOptions options;
+            options.maxAttempts = maxAttempts;
+            options.initialDelay = milliseconds(10);
+            options.maxDelay = milliseconds(40);
+            options.jitter = 0.0;
+            options.tick = milliseconds(5);
+            options.wheelSlots = 64;
+            runtime.retries = std::make_shared<RetryScheduler>(options);
+        }
+
+        void Start(QueueSubscription::Handler handler) {
+            subscription = std::make_unique<QueueSubscription>(runtime, kQueue, "Test", std::move(handler));
+            subscription->Start();
+        }
+
+        // Falla con `error` mientras el intento sea menor que `succeedAt` (0 => siempre)
+        template<typename Error>
+        QueueSubscription::Handler FailUntil(int succeedAt, Error error) {
+            return [this, succeedAt, error](const QueueSubscription::Delivery& delivery, QueueSubscription::Ack ack) {
+                {
+                    std::lock_guard lock(mutex);
+                    attempts.push_back(delivery.attempt);
+                }
+                if (succeedAt == 0 || delivery.attempt < succeedAt) throw error;
+                ack(nullptr);
+            };
+        }
+
+        QueueSubscription::Handler Hold() {
+            return [this](const QueueSubscription::Delivery&, QueueSubscription::Ack ack) {
+                std::lock_guard lock(mutex);
+                pending.push_back(std::move(ack));
+            };
+        }
+
+        std::size_t Held() {
+            std::lock_guard lock(mutex);
+            return pending.size();
+        }
+
+        std::vector<int> Attempts() {
+            std::lock_guard lock(mutex);
+            return attempts;
+        }
+
+        ConsumerMetrics::QueueCounters& Counters() { return runtime.metrics->Queue(kQueue); }
+
+        std::vector<fakecms::SentMessage> DeadLettered() {
+            std::vector<fakecms::SentMessage> result;
+            for (auto& sent : broker->Sent()) {
+                if (sent.queue == std::string("DLQ.") + kQueue) result.push_back(std::move(sent));
+            }
+            return result;
+        }
+    };
+}
+
+TEST_F(QueueSubscriptionTest, ProcessedMessageIsAcknowledged) {
+    broker->Push(kQueue, "m1", Event("T1"));
+    Start(FailUntil(1, std::runtime_error("unused")));
+
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_EQ(broker->Acked()[0], "m1");
+    EXPECT_EQ(Attempts(), std::vector<int>{1});
+    EXPECT_EQ(Counters().processed.load(), 1u);
+    EXPECT_TRUE(WaitFor([&] { return Counters().inFlight.load() == 0; }));
+}
+
+TEST_F(QueueSubscriptionTest, FailedAttemptIsRetriedBeforeTheAck) {
+    broker->Push(kQueue, "m1", Event("T1"));
+    Start(FailUntil(3, std::runtime_error("database unavailable")));
+
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_EQ(Attempts(), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(Counters().failed.load(), 2u);
+    EXPECT_EQ(Counters().retried.load(), 2u);
+    EXPECT_TRUE(DeadLettered().empty());
+}
+
+TEST_F(QueueSubscriptionTest, ExhaustedRetriesGoToTheDeadLetterQueue) {
+    broker->Push(kQueue, "m1", Event("T1"));
+    Start(FailUntil(0, std::runtime_error("database unavailable")));
+
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_EQ(Attempts(), (std::vector<int>{1, 2, 3}));
+    const auto dead = DeadLettered();
+    ASSERT_EQ(dead.size(), 1u);
+    EXPECT_EQ(std::get<int>(dead[0].properties.at(DeadLetterSender::AttemptsProperty)), 3);
+    EXPECT_EQ(std::get<std::string>(dead[0].properties.at(DeadLetterSender::ReasonProperty)), "database unavailable");
+    EXPECT_EQ(Counters().deadLettered.load(), 1u);
+}
+
+TEST_F(QueueSubscriptionTest, PermanentFailureSkipsTheRetries) {
+    broker->Push(kQueue, "m1", Event("T1"));
+    Start(FailUntil(0, std::invalid_argument("unknown team")));
+
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_EQ(Attempts(), std::vector<int>{1});
+    ASSERT_EQ(DeadLettered().size(), 1u);
+    EXPECT_EQ(Counters().retried.load(), 0u);
+}
+
+TEST_F(QueueSubscriptionTest, UndecodableMessageIsDeadLetteredWithoutReachingTheHandler) {
+    broker->Push(kQueue, "m1", "not json");
+    Start(FailUntil(1, std::runtime_error("unused")));
+
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_TRUE(Attempts().empty());
+    const auto dead = DeadLettered();
+    ASSERT_EQ(dead.size(), 1u);
+    EXPECT_EQ(dead[0].text, "not json");
+}
+
+TEST_F(QueueSubscriptionTest, NonIntegerSchemaVersionIsDeadLetteredWithoutReconnecting) {
+    broker->Push(kQueue, "m1", Event("T1"), {{messaging::SchemaVersionProperty, std::string("2")}});
+    Start(FailUntil(1, std::runtime_error("unused")));
+
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_TRUE(Attempts().empty());
+    const auto dead = DeadLettered();
+    ASSERT_EQ(dead.size(), 1u);
+    EXPECT_EQ(std::get<std::string>(dead[0].properties.at(DeadLetterSender::ReasonProperty)),
+              "unsupported schema version");
+    EXPECT_EQ(broker->ConnectionsCreated(), 1);
+}
+
+TEST_F(QueueSubscriptionTest, FailedDeadLetterSendIsRetried) {
+    broker->Push(kQueue, "m1", Event("T1"));
+    broker->FailNextSends(2);
+    Start(FailUntil(0, std::invalid_argument("unknown team")));
+
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_EQ(DeadLettered().size(), 1u);
+    EXPECT_EQ(Attempts(), std::vector<int>{1}); // el handler no vuelve a correr
+    EXPECT_EQ(broker->Redelivered(), 0);
+    EXPECT_TRUE(WaitFor([&] { return Counters().inFlight.load() == 0; }));
+}
+
+TEST_F(QueueSubscriptionTest, DeadLetterFailureWithoutRetriesRecyclesTheSession) {
+    runtime.retries.reset();
+    broker->Push(kQueue, "m1", Event("T1"));
+    broker->FailNextSends(1);
+    Start(FailUntil(0, std::invalid_argument("unknown team")));
+
+    // No queda ocupando el prefetch: vuelve a la cola, se reentrega por una
+    // sesión nueva y esta vez llega a la DLQ
+    ASSERT_TRUE(WaitFor([&] { return broker->Acked().size() == 1; }));
+    EXPECT_EQ(broker->Redelivered(), 1);
+    EXPECT_EQ(Attempts(), (std::vector<int>{1, 1}));
+    EXPECT_EQ(DeadLettered().size(), 1u);
+    EXPECT_GE(broker->SessionsClosed(), 1);
+}
+
+TEST_F(QueueSubscriptionTest, InFlightLimitPausesTheReceiver) {
+    runtime.options.maxInFlight = 2;
+    for (int i = 0; i < 5; ++i) broker->Push(kQueue, "m" + std::to_string(i), Event("T" + std::to_string(i)));
+    Start(Hold());
+
+    ASSERT_TRUE(WaitFor([&] { return Held() == 2; }));
+    std::this_thread::sleep_for(milliseconds(100));
+    EXPECT_EQ(Held(), 2u);
+    EXPECT_EQ(broker->Waiting(kQueue), 3u);
+
+    {
+        std::lock_guard lock(mutex);
+        pending[0](nullptr);
+    }
+    ASSERT_TRUE(WaitFor([&] { return Held() == 3; }));
+    EXPECT_EQ(broker->Waiting(kQueue), 2u);
+}
+
+TEST_F(QueueSubscriptionTest, LateAckAfterStopDoesNotTouchTheClosedSession) {
+    runtime.options.drainTimeout = milliseconds(20);
+    broker->Push(kQueue, "m1", Event("T1"));
+    Start(Hold());
+    ASSERT_TRUE(WaitFor([&] { return Held() == 1; }));
+
+    subscription->Stop(); // vence el drain: la sesión se cierra con el mensaje sin ack
+    {
+        std::lock_guard lock(mutex);
+        pending[0](nullptr);
+    }
+
+    EXPECT_EQ(broker->AcksAfterClose(), 0);
+    EXPECT_TRUE(broker->Acked().empty());
+    EXPECT_EQ(broker->Redelivered(), 1);
+    EXPECT_EQ(Counters().inFlight.load(), 0);
+}
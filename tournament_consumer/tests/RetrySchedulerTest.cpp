@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "consumer/RetryScheduler.hpp"
+
+namespace {
+    using std::chrono::milliseconds;
+
+    RetryOptions Wheel(int tickMs, std::size_t slots) {
+        RetryOptions options;
+        options.initialDelay = milliseconds(100);
+        options.maxDelay = milliseconds(1000);
+        options.tick = milliseconds(tickMs);
+        options.wheelSlots = slots;
+        return options;
+    }
+
+    template<typename Predicate>
+    bool WaitFor(Predicate done) {
+        const auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!done() && std::chrono::steady_clock::now() < limit) {
+            std::this_thread::sleep_for(milliseconds(2));
+        }
+        return done();
+    }
+}
+
+TEST(RetrySchedulerTest, BackoffDoublesUpToTheCap) {
+    RetryScheduler scheduler(Wheel(50, 8));
+    EXPECT_EQ(scheduler.BackoffFor(2), milliseconds(100));
+    EXPECT_EQ(scheduler.BackoffFor(3), milliseconds(200));
+    EXPECT_EQ(scheduler.BackoffFor(5), milliseconds(800));
+    EXPECT_EQ(scheduler.BackoffFor(6), milliseconds(1000));
+    EXPECT_EQ(scheduler.BackoffFor(40), milliseconds(1000));
+}
+
+TEST(RetrySchedulerTest, JitterStaysWithinBounds) {
+    auto options = Wheel(50, 8);
+    options.jitter = 0.2;
+    RetryScheduler scheduler(options);
+    for (int i = 0; i < 200; ++i) {
+        const auto delay = scheduler.DelayFor(3);
+        EXPECT_GE(delay, milliseconds(160));
+        EXPECT_LE(delay, milliseconds(240));
+    }
+
+    options.jitter = 0.0;
+    RetryScheduler exact(options);
+    EXPECT_EQ(exact.DelayFor(3), milliseconds(200));
+}
+
+TEST(RetrySchedulerTest, OptionsFromJsonAreClamped) {
+    const auto options = nlohmann::json{{"maxAttempts", 0}, {"initialDelayMs", 800}, {"maxDelayMs", 100},
+                                        {"jitter", 3.0}, {"tickMs", 0}, {"deadLetterPrefix", "dead."}}
+                             .get<RetryOptions>();
+    EXPECT_EQ(options.maxAttempts, 1);
+    EXPECT_EQ(options.maxDelay, milliseconds(800));
+    EXPECT_EQ(options.jitter, 1.0);
+    EXPECT_EQ(options.tick, milliseconds(1));
+    EXPECT_EQ(options.deadLetterPrefix, "dead.");
+}
+
+TEST(RetrySchedulerTest, RunsWorkAfterItsDelay) {
+    RetryScheduler scheduler(Wheel(5, 64));
+    std::atomic<bool> ran{false};
+    const auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration elapsed{};
+
+    ASSERT_TRUE(scheduler.Schedule(milliseconds(40), [&] {
+        elapsed = std::chrono::steady_clock::now() - start;
+        ran = true;
+    }));
+    EXPECT_FALSE(ran);
+    ASSERT_TRUE(WaitFor([&] { return ran.load(); }));
+    EXPECT_GE(elapsed, milliseconds(35));
+
+    const auto stats = scheduler.GetStats();
+    EXPECT_EQ(stats.scheduled, 1u);
+    EXPECT_EQ(stats.fired, 1u);
+    EXPECT_EQ(stats.pending, 0u);
+}
+
+TEST(RetrySchedulerTest, DelaysLongerThanOneTurnWaitForTheirRound) {
+    RetryScheduler scheduler(Wheel(5, 4)); // una vuelta = 20 ms
+    std::mutex mutex;
+    std::vector<std::string> order;
+    const auto record = [&](std::string name) {
+        return [&, name] {
+            std::lock_guard lock(mutex);
+            order.push_back(name);
+        };
+    };
+
+    // Misma ranura (60 ms = 3 vueltas justas, 20 ms = 1), distintas vueltas
+    scheduler.Schedule(milliseconds(60), record("late"));
+    scheduler.Schedule(milliseconds(20), record("early"));
+    scheduler.Schedule(milliseconds(1), record("first"));
+
+    ASSERT_TRUE(WaitFor([&] {
+        std::lock_guard lock(mutex);
+        return order.size() == 3;
+    }));
+    EXPECT_EQ(order, (std::vector<std::string>{"first", "early", "late"}));
+}
+
+TEST(RetrySchedulerTest, StopDropsPendingAndRejectsNewWork) {
+    RetryScheduler scheduler(Wheel(5, 8));
+    std::atomic<int> runs{0};
+    scheduler.Schedule(milliseconds(60'000), [&] { ++runs; });
+
+    scheduler.Stop();
+    EXPECT_FALSE(scheduler.Schedule(milliseconds(1), [&] { ++runs; }));
+    EXPECT_EQ(scheduler.GetStats().dropped, 1u);
+    EXPECT_EQ(scheduler.GetStats().pending, 0u);
+    EXPECT_EQ(runs, 0);
+}
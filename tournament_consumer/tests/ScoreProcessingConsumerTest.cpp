@@ -29,6 +29,15 @@ public:
                 (std::string_view tournamentId, std::string_view matchId),
                 (override));
     MOCK_METHOD(bool, UpdateScore, (std::string_view matchId, int homeScore, int awayScore), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, UpdateScores,
+                (std::string_view tournamentId, const std::vector<ScoreUpdate>& updates), (override));
+    MOCK_METHOD(ScoreUpdateOutcome, UpdateScoreReturning,
+                (std::string_view tournamentId, const ScoreUpdate& update), (override));
+    MOCK_METHOD(bool, CreateFixtures,
+                (std::string_view tournamentId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(bool, ApplyScoreEffects,
+                (std::string_view consumer, std::string_view eventId, std::string_view tournamentId,
+                 const ScoreEffects& effects), (override));
     MOCK_METHOD(int, CountCompletedMatchesByTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(int, CountTotalMatchesByTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByGroupId, (std::string_view groupId), (override));
@@ -44,6 +53,11 @@ public:
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
 };
 
+class MockLiveEventPublisher : public ILiveEventPublisher {
+public:
+    MOCK_METHOD(void, Publish, (std::string_view tournamentId, std::string_view type, const nlohmann::json& data), (override));
+};
+
 class ScoreProcessingConsumerTest : public ::testing::Test {
 protected:
     std::shared_ptr<MockMatchRepository> mockMatchRepo;
@@ -87,23 +101,21 @@ TEST_F(ScoreProcessingConsumerTest, ProcessScore_RRNotComplete) {
     auto m2 = createMatch("match-2", MatchPhase::RoundRobin, -1, -1); // Pending
     std::vector<std::shared_ptr<Match>> matches = {m1, m2};
 
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "match-1"))
-        .WillOnce(::testing::Return(m1));
-
     EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", MatchFilter::All))
         .WillOnce(::testing::Return(matches));
     
-    // Should not generate playoffs or complete tournament
+    // Nada que escribir: ni llave ni marca en processed_events
+    EXPECT_CALL(*mockMatchRepo, ApplyScoreEffects(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
     EXPECT_CALL(*mockMatchRepo, Create(::testing::_)).Times(0);
     
-    consumer->Handle(event);
+    consumer->Handle(event, "evt-1");
 }
 
 // Test: RR Complete, Generate Playoffs
 TEST_F(ScoreProcessingConsumerTest, ProcessScore_RRComplete_GeneratesPlayoffs) {
     nlohmann::json event = {
         {"tournamentId", "tourn-1"},
-        {"matchId", "match-6"}
+        {"matchId", "match-5"}
     };
     
     // 4 Teams -> 6 Matches
@@ -115,17 +127,22 @@ TEST_F(ScoreProcessingConsumerTest, ProcessScore_RRComplete_GeneratesPlayoffs) {
         matches.push_back(m);
     }
 
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "match-6"))
-        .WillOnce(::testing::Return(matches.back()));
-
+    // Una sola lectura para avance y cambio de fase
     EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", MatchFilter::All))
         .WillOnce(::testing::Return(matches));
+    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId(::testing::_, ::testing::_)).Times(0);
     
-    // Should create at least one playoff match (Top 4 -> 2 semis + 1 final)
-    // Actually BuildTop8FromSeeds will create 3 matches (2 semis, 1 final) if 4 teams
-    EXPECT_CALL(*mockMatchRepo, Create(::testing::_)).Times(::testing::AtLeast(1));
+    // La llave va junto con la marca del evento, en una sola escritura
+    EXPECT_CALL(*mockMatchRepo, ApplyScoreEffects(std::string_view(ScoreProcessingConsumer::ConsumerName),
+                                                  std::string_view("evt-6"), std::string_view("tourn-1"), ::testing::_))
+        .WillOnce([](std::string_view, std::string_view, std::string_view, const ScoreEffects& effects) {
+            EXPECT_FALSE(effects.playoffs.empty());
+            EXPECT_TRUE(effects.advanced.empty());
+            return true;
+        });
+    EXPECT_CALL(*mockMatchRepo, Create(::testing::_)).Times(0);
     
-    consumer->Handle(event);
+    consumer->Handle(event, "evt-6");
 }
 
 // Test: KO Match, Advances Winner
@@ -145,22 +162,75 @@ TEST_F(ScoreProcessingConsumerTest, ProcessScore_KOMatch_AdvancesWinner) {
 
     std::vector<std::shared_ptr<Match>> matches = {mKO, mNext};
 
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "ko-1"))
-        .WillOnce(::testing::Return(mKO));
+    EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", MatchFilter::All))
+        .WillOnce(::testing::Return(matches));
+
+    // Should update mNext with Winner T1
+    EXPECT_CALL(*mockMatchRepo, ApplyScoreEffects(::testing::_, std::string_view("evt-ko-1"), std::string_view("tourn-1"), ::testing::_))
+        .WillOnce([](std::string_view, std::string_view, std::string_view, const ScoreEffects& effects) {
+            EXPECT_TRUE(effects.playoffs.empty());
+            EXPECT_EQ(effects.advanced.size(), 1u);
+            if (effects.advanced.empty()) return true;
+            EXPECT_EQ(effects.advanced[0].Id, "ko-2");
+            EXPECT_EQ(effects.advanced[0].HomeTeamId, "T1");
+            // El repositorio reemplaza sólo el placeholder, no el documento
+            EXPECT_EQ(effects.placeholder, "W(T1-T2)");
+            EXPECT_EQ(effects.winnerId, "T1");
+            return true;
+        });
+    EXPECT_CALL(*mockMatchRepo, Update(::testing::_)).Times(0);
+
+    consumer->Handle(event, "evt-ko-1");
+}
+
+// Test: KO advancement is pushed to live subscribers
+TEST_F(ScoreProcessingConsumerTest, ProcessScore_KOMatch_PublishesAdvancement) {
+    auto live = std::make_shared<MockLiveEventPublisher>();
+    consumer->UseLiveEvents(live);
+
+    auto mKO = createMatch("ko-1", MatchPhase::Knockout, 0, 3);
+    mKO->HomeTeamId = "T1";
+    mKO->AwayTeamId = "T2";
+    auto mNext = createMatch("ko-2", MatchPhase::Knockout);
+    mNext->HomeTeamId = "T3";
+    mNext->AwayTeamId = "W(T1-T2)";
+    std::vector<std::shared_ptr<Match>> matches = {mKO, mNext};
 
-    // Expect 2 calls to FindByTournamentId (one for advancement, one for completion check)
     EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", MatchFilter::All))
-        .Times(2)
         .WillRepeatedly(::testing::Return(matches));
+    EXPECT_CALL(*mockMatchRepo, ApplyScoreEffects(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(true));
 
-    // Should update mNext with Winner T1
-    EXPECT_CALL(*mockMatchRepo, Update(::testing::_)).WillOnce([&](const Match& m){
-        EXPECT_EQ(m.Id, "ko-2");
-        EXPECT_EQ(m.HomeTeamId, "T1");
-        return "ko-2";
-    });
+    EXPECT_CALL(*live, Publish(std::string_view("tourn-1"), std::string_view("match.advanced"), ::testing::_))
+        .WillOnce([](std::string_view, std::string_view, const nlohmann::json& data) {
+            EXPECT_EQ(data["matchId"], "ko-2");
+            EXPECT_EQ(data["fromMatchId"], "ko-1");
+            EXPECT_EQ(data["teamId"], "T2");
+        });
 
-    consumer->Handle(event);
+    consumer->Handle(nlohmann::json{{"tournamentId", "tourn-1"}, {"matchId", "ko-1"}});
+}
+
+// Test: a redelivered event is detected by the repository and has no visible effects
+TEST_F(ScoreProcessingConsumerTest, ProcessScore_DuplicateEventIsNotReapplied) {
+    auto live = std::make_shared<MockLiveEventPublisher>();
+    consumer->UseLiveEvents(live);
+
+    auto mKO = createMatch("ko-1", MatchPhase::Knockout, 2, 1);
+    mKO->HomeTeamId = "T1";
+    mKO->AwayTeamId = "T2";
+    auto mNext = createMatch("ko-2", MatchPhase::Knockout);
+    mNext->HomeTeamId = "W(T1-T2)";
+    std::vector<std::shared_ptr<Match>> matches = {mKO, mNext};
+
+    EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", MatchFilter::All))
+        .WillOnce(::testing::Return(matches));
+    // processed_events ya tiene (consumer, evt-1): el repositorio no escribe nada
+    EXPECT_CALL(*mockMatchRepo, ApplyScoreEffects(::testing::_, std::string_view("evt-1"), ::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(false));
+    EXPECT_CALL(*live, Publish(::testing::_, ::testing::_, ::testing::_)).Times(0);
+
+    consumer->Handle(nlohmann::json{{"tournamentId", "tourn-1"}, {"matchId", "ko-1"}}, "evt-1");
 }
 
 // Test: All Completed
@@ -173,13 +243,9 @@ TEST_F(ScoreProcessingConsumerTest, ProcessScore_AllCompleted) {
     auto mKO = createMatch("ko-final", MatchPhase::Knockout, 2, 1);
     std::vector<std::shared_ptr<Match>> matches = {mKO};
 
-     EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "ko-final"))
-        .WillOnce(::testing::Return(mKO));
-
-     // Expect 2 calls (advancement + completion)
      EXPECT_CALL(*mockMatchRepo, FindByTournamentId("tourn-1", MatchFilter::All))
-        .Times(2)
-        .WillRepeatedly(::testing::Return(matches));
+        .WillOnce(::testing::Return(matches));
+     EXPECT_CALL(*mockMatchRepo, ApplyScoreEffects(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
 
      // Just prints for now
      consumer->Handle(event);
@@ -202,7 +268,7 @@ TEST_F(ScoreProcessingConsumerTest, HandlesMissingMatchId) {
         // Missing matchId
     };
     
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId(::testing::_, ::testing::_))
+    EXPECT_CALL(*mockMatchRepo, FindByTournamentId(::testing::_, ::testing::_))
         .Times(0);
     
     EXPECT_NO_THROW(consumer->Handle(event));
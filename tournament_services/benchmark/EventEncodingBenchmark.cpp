@@ -0,0 +1,75 @@
+// Micro-benchmark del cuerpo de los eventos hacia tournament_consumer:
+// JSON (dump/parse, el camino anterior) contra MessagePack, para el evento
+// más frecuente (match.score_updated) y uno de lote (group.teams_added).
+// Reporta bytes por mensaje y us por encode/decode.
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+#include "messaging/DomainEvents.hpp"
+#include "messaging/EventCodec.hpp"
+
+namespace {
+    using messaging::EventEncoding;
+
+    nlohmann::json scoreUpdated() {
+        domain::Match match;
+        match.Id = "5f2a7c1e-8b4d-4f7a-9c3e-1a2b3c4d5e6f";
+        match.TournamentId = "0b6c3a52-2f7e-4d1a-8f35-7c9e1d2a4b6f";
+        match.GroupId = "9d8e7f6a-5b4c-4d3e-8f2a-1b0c9d8e7f6a";
+        match.HomeTeamId = "a1b2c3d4-e5f6-4a7b-8c9d-0e1f2a3b4c5d";
+        match.AwayTeamId = "b2c3d4e5-f6a7-4b8c-9d0e-1f2a3b4c5d6e";
+        return payloads::MatchScoreUpdated(match.TournamentId, match.Id, match, 3, 1);
+    }
+
+    nlohmann::json teamsAdded(std::size_t count) {
+        std::vector<domain::Team> teams;
+        for (std::size_t i = 0; i < count; ++i) {
+            teams.push_back(domain::Team{"a1b2c3d4-e5f6-4a7b-8c9d-" + std::to_string(200000000000 + i),
+                                         "Team " + std::to_string(i)});
+        }
+        return payloads::GroupTeamsAdded("0b6c3a52-2f7e-4d1a-8f35-7c9e1d2a4b6f",
+                                         "9d8e7f6a-5b4c-4d3e-8f2a-1b0c9d8e7f6a", teams);
+    }
+
+    template<typename Fn>
+    double usPerCall(int iterations, Fn&& fn) {
+        volatile std::size_t sink = 0; // evita que el compilador elimine el ciclo
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            sink = sink + fn();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    }
+
+    bool report(const char* name, const nlohmann::json& payload, int iterations) {
+        std::cout << name << '\n';
+        for (const auto encoding : {EventEncoding::Json, EventEncoding::MessagePack}) {
+            const auto body = messaging::EncodeEvent(payload, encoding);
+            if (messaging::DecodeEvent(body, encoding) != payload) {
+                std::cerr << "round trip mismatch for " << messaging::ContentType(encoding) << '\n';
+                return false;
+            }
+            const double encodeUs = usPerCall(iterations, [&] { return messaging::EncodeEvent(payload, encoding).size(); });
+            const double decodeUs = usPerCall(iterations, [&] { return messaging::DecodeEvent(body, encoding).size(); });
+            std::cout << "  " << messaging::ContentType(encoding) << ":\t"
+                      << body.size() << " bytes, encode " << encodeUs << " us, decode " << decodeUs << " us\n";
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    const int iterations = argc > 1 ? std::stoi(argv[1]) : 200'000;
+    const std::size_t batchTeams = argc > 2 ? std::stoul(argv[2]) : 32;
+
+    if (!report("match.score_updated", scoreUpdated(), iterations)) return 1;
+    if (!report("group.teams_added", teamsAdded(batchTeams), iterations / 10)) return 1;
+}
@@ -0,0 +1,55 @@
+// Micro-benchmark de validación de ids de ruta:
+// std::regex (validación anterior en los controladores) contra util::IsValidId
+// y util::Uuid::Parse.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "util/Uuid.hpp"
+
+namespace {
+    template<typename Fn>
+    double nsPerCall(std::uint64_t iterations, const std::vector<std::string>& ids, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        volatile std::uint64_t sink = 0; // evita que el compilador elimine el ciclo
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            sink = sink + static_cast<std::uint64_t>(fn(ids[i % ids.size()]));
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::uint64_t iterations = argc > 1 ? std::stoull(argv[1]) : 2'000'000;
+
+    // Mezcla de ids válidos e inválidos como llegarían en /tournaments/<id>
+    const std::vector<std::string> ids{
+        "5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6e",
+        "A0B1C2D3-E4F5-4a6b-8c7d-0123456789ab",
+        "5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6g",
+        "5f2a7c1e_8b4d_4f7a_9c3e_1d2b3a4c5d6e",
+        "not a uuid",
+    };
+
+    const std::regex idValue{R"(^[A-Za-z0-9-]+$)"};
+
+    const double regex = nsPerCall(iterations, ids, [&](const std::string& id) {
+        return std::regex_match(id, idValue);
+    });
+    const double isValidId = nsPerCall(iterations, ids, [](const std::string& id) {
+        return util::IsValidId(id);
+    });
+    const double uuidParse = nsPerCall(iterations, ids, [](const std::string& id) {
+        return util::Uuid::Parse(id).has_value();
+    });
+
+    std::cout << "iterations:        " << iterations << '\n'
+              << "std::regex_match:  " << regex << " ns/op\n"
+              << "util::IsValidId:   " << isValidId << " ns/op\n"
+              << "util::Uuid::Parse: " << uuidParse << " ns/op\n";
+}
@@ -0,0 +1,68 @@
+// Micro-benchmark de serialización de GET /tournaments/<id>/matches:
+// MatchDTO::ToJson() + nlohmann::json::dump() (camino anterior) contra
+// serialization::MatchesToJson (JsonWriter directo a buffer).
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "serialization/ResponseSerializers.hpp"
+
+namespace {
+    std::vector<MatchDTO> makeMatches(std::size_t count) {
+        std::vector<MatchDTO> matches;
+        matches.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            MatchDTO dto;
+            dto.matchId = "5f2a7c1e-8b4d-4f7a-9c3e-" + std::to_string(100000000000 + i);
+            dto.tournamentId = "0b6c3a52-2f7e-4d1a-8f35-7c9e1d2a4b6f";
+            dto.groupId = "9d8e7f6a-5b4c-4d3e-8f2a-1b0c9d8e7f6a";
+            dto.home = {"a1b2c3d4-e5f6-4a7b-8c9d-" + std::to_string(200000000000 + i), "Team " + std::to_string(i)};
+            dto.visitor = {"b2c3d4e5-f6a7-4b8c-9d0e-" + std::to_string(300000000000 + i), "Team " + std::to_string(i + 1)};
+            dto.round = "regular";
+            if (i % 2 == 0) dto.score = MatchDTO::ScoreInfo{static_cast<int>(i % 7), static_cast<int>(i % 5)};
+            matches.push_back(std::move(dto));
+        }
+        return matches;
+    }
+
+    template<typename Fn>
+    double usPerCall(int iterations, Fn&& fn) {
+        volatile std::size_t sink = 0; // evita que el compilador elimine el ciclo
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            sink = sink + fn().size();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 10'000;
+    const int iterations = argc > 2 ? std::stoi(argv[2]) : 50;
+    const auto matches = makeMatches(count);
+
+    const auto viaNlohmann = [&] {
+        nlohmann::json array = nlohmann::json::array();
+        for (const auto& match : matches) array.push_back(match.ToJson());
+        return array.dump();
+    };
+    const auto viaWriter = [&] { return serialization::MatchesToJson(matches); };
+
+    if (viaNlohmann() != viaWriter()) {
+        std::cerr << "output mismatch between serializers\n";
+        return 1;
+    }
+
+    const double nlohmannUs = usPerCall(iterations, viaNlohmann);
+    const double writerUs = usPerCall(iterations, viaWriter);
+
+    std::cout << "matches per body:    " << count << '\n'
+              << "nlohmann ToJson+dump: " << nlohmannUs << " us/body\n"
+              << "JsonWriter:           " << writerUs << " us/body\n"
+              << "speedup:              " << nlohmannUs / writerUs << "x\n";
+}
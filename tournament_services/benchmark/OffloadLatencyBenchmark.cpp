@@ -0,0 +1,137 @@
+// Latencia de un endpoint barato mientras un endpoint lento (simula una
+// consulta pqxx de varios ms) satura el servicio, con los handlers en los
+// hilos de I/O de Crow (binding anterior) y con dispatchRouteAsync sobre el
+// BlockingExecutor. Levanta un servidor real en localhost por cada modo.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <crow.h>
+#include <Hypodermic/Hypodermic.h>
+
+#include "concurrency/BlockingExecutor.hpp"
+#include "configuration/RouteDefinition.hpp"
+
+namespace {
+    constexpr auto SlowQuery = std::chrono::milliseconds(20);
+
+    class BenchController {
+    public:
+        crow::response Slow(const crow::request&) const {
+            std::this_thread::sleep_for(SlowQuery);
+            return crow::response{crow::OK, "slow"};
+        }
+
+        crow::response Cheap(const crow::request&, const std::string& id) const {
+            return crow::response{crow::OK, id};
+        }
+    };
+
+    // Un request por conexión: el endpoint barato cae en cualquier hilo de I/O
+    bool httpGet(std::uint16_t port, const std::string& path) {
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return false;
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        bool ok = ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+        if (ok) {
+            const std::string request = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+            ok = ::send(fd, request.data(), request.size(), 0) == static_cast<ssize_t>(request.size());
+        }
+        char buffer[512];
+        std::string response;
+        while (ok) {
+            const ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) break;
+            response.append(buffer, static_cast<std::size_t>(n));
+        }
+        ::close(fd);
+        return response.starts_with("HTTP/1.1 200");
+    }
+
+    double percentile(std::vector<double>& samples, double p) {
+        std::sort(samples.begin(), samples.end());
+        const auto index = static_cast<std::size_t>(p * static_cast<double>(samples.size() - 1));
+        return samples[index];
+    }
+
+    void run(const char* label, std::size_t executorThreads, std::uint16_t port,
+             int ioThreads, int slowClients, int cheapRequests) {
+        Hypodermic::ContainerBuilder builder;
+        builder.registerType<BenchController>().singleInstance();
+        // El endpoint barato no toca la base: se queda en el hilo de I/O
+        builder.registerInstance(std::make_shared<concurrency::BlockingExecutor>(
+            executorThreads, 4096, std::set<std::string, std::less<>>{"/bench/cheap/<string>"}));
+        const auto container = builder.build();
+
+        crow::SimpleApp app;
+        app.loglevel(crow::LogLevel::Warning);
+        for (auto& def : routeRegistry()) {
+            def.binder(app, container);
+        }
+        auto server = app.port(port).concurrency(ioThreads).run_async();
+        app.wait_for_server_start();
+
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> load;
+        for (int i = 0; i < slowClients; ++i) {
+            load.emplace_back([&] {
+                while (!stop.load(std::memory_order_relaxed)) httpGet(port, "/bench/slow");
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200)); // que la carga se estabilice
+
+        std::vector<double> latencies;
+        latencies.reserve(static_cast<std::size_t>(cheapRequests));
+        int failures = 0;
+        for (int i = 0; i < cheapRequests; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            if (!httpGet(port, "/bench/cheap/t1")) ++failures;
+            latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        stop = true;
+        for (auto& thread : load) thread.join();
+        app.stop();
+        server.wait();
+
+        std::cout << label << '\n'
+                  << "  cheap p50:  " << percentile(latencies, 0.50) << " ms\n"
+                  << "  cheap p99:  " << percentile(latencies, 0.99) << " ms\n"
+                  << "  cheap max:  " << latencies.back() << " ms\n"
+                  << "  failures:   " << failures << '\n';
+    }
+}
+
+REGISTER_ROUTE(BenchController, Slow, "/bench/slow", "GET"_method)
+REGISTER_ROUTE(BenchController, Cheap, "/bench/cheap/<string>", "GET"_method)
+
+int main(int argc, char** argv) {
+    const int cheapRequests = argc > 1 ? std::stoi(argv[1]) : 500;
+    constexpr int ioThreads = 4;     // runConfig.concurrency
+    constexpr int poolSize = 2;      // databaseConfig.poolSize
+    constexpr int slowClients = 16;
+
+    std::cout << "io threads: " << ioThreads << ", executor threads: " << poolSize
+              << ", slow clients: " << slowClients << ", slow handler: " << SlowQuery.count() << " ms\n";
+
+    run("handlers on io threads", 0, 18081, ioThreads, slowClients, cheapRequests);
+    run("handlers on blocking executor", poolSize, 18082, ioThreads, slowClients, cheapRequests);
+}
@@ -0,0 +1,61 @@
+// Micro-benchmark del costo de despacho por request:
+// resolver el controlador en el contenedor en cada llamada (binding anterior)
+// contra el puntero capturado una sola vez al enlazar la ruta (REGISTER_ROUTE actual).
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <crow.h>
+#include <Hypodermic/Hypodermic.h>
+
+#include "configuration/RouteDefinition.hpp"
+
+namespace {
+    class BenchController {
+    public:
+        crow::response Get(const crow::request&, const std::string& id) const {
+            return crow::response{crow::OK, id};
+        }
+    };
+
+    template<typename Fn>
+    double nsPerCall(std::uint64_t iterations, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        volatile std::uint64_t sink = 0; // evita que el compilador elimine el ciclo
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            sink = sink + static_cast<std::uint64_t>(fn().code);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::uint64_t iterations = argc > 1 ? std::stoull(argv[1]) : 2'000'000;
+
+    Hypodermic::ContainerBuilder builder;
+    builder.registerType<BenchController>().singleInstance();
+    const auto container = builder.build();
+
+    const crow::request request;
+    const std::string id = "5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6e";
+
+    const double perRequestResolve = nsPerCall(iterations, [&] {
+        auto controller = container->resolve<BenchController>();
+        return invokeController(controller.get(), &BenchController::Get, request, id);
+    });
+
+    const auto owner = container->resolve<BenchController>();
+    BenchController* target = owner.get();
+    const double cachedPointer = nsPerCall(iterations, [&] {
+        return invokeController(target, &BenchController::Get, request, id);
+    });
+
+    std::cout << "iterations:           " << iterations << '\n'
+              << "resolve per request:  " << perRequestResolve << " ns/op\n"
+              << "cached at bind time:  " << cachedPointer << " ns/op\n"
+              << "saved per request:    " << (perRequestResolve - cachedPointer) << " ns\n";
+}
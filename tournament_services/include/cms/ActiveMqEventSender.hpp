@@ -0,0 +1,91 @@
+#ifndef SERVICE_ACTIVEMQ_EVENT_SENDER_HPP
+#define SERVICE_ACTIVEMQ_EVENT_SENDER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cms/CMSException.h>
+#include <cms/MessageProducer.h>
+#include <cms/Queue.h>
+#include <cms/Session.h>
+
+#include "cms/ConnectionManager.hpp"
+#include "cms/EventMessages.hpp"
+#include "messaging/AsyncEventBus.hpp"
+
+// Envía los lotes del AsyncEventBus a las colas "tournament.<topic>" que
+// escucha tournament_consumer. Una sesión transaccional: el lote completo es
+// un commit. Sólo la usa el hilo de envío del bus, así que no lleva candado.
+class ActiveMqEventSender : public messaging::IEventBatchSender {
+    struct QueueProducer {
+        std::unique_ptr<cms::Queue> queue;
+        std::unique_ptr<cms::MessageProducer> producer;
+    };
+
+    std::shared_ptr<ConnectionManager> connectionManager;
+    std::shared_ptr<cms::Connection> connection; // la sesión no debe sobrevivir a su conexión
+    std::uint64_t generation = 0;
+    std::unique_ptr<cms::Session> session;
+    std::unordered_map<std::string, QueueProducer> producers;
+
+public:
+    static constexpr const char* QueuePrefix = "tournament.";
+
+    explicit ActiveMqEventSender(const std::shared_ptr<ConnectionManager>& connectionManager)
+        : connectionManager(connectionManager) {}
+
+    ~ActiveMqEventSender() override { Reset(); }
+
+    void SendBatch(const std::vector<messaging::PendingEvent>& batch) override {
+        try {
+            Open();
+            for (const auto& event : batch) {
+                const auto message = messaging::CreateEventMessage(*session, event.body, event.encoding, event.eventId);
+                ProducerFor(event.topic).send(message.get());
+            }
+            session->commit();
+        } catch (const cms::CMSException&) {
+            // Nada del lote quedó confirmado; el bus reintenta con sesión nueva
+            Reset();
+            connectionManager->ReconnectIfFailed(generation);
+            throw;
+        }
+    }
+
+private:
+    void Open() {
+        if (session) return;
+        auto [current, currentGeneration] = connectionManager->CurrentConnection();
+        connection = std::move(current);
+        generation = currentGeneration;
+        session.reset(connection->createSession(cms::Session::SESSION_TRANSACTED));
+    }
+
+    cms::MessageProducer& ProducerFor(const std::string& topic) {
+        auto it = producers.find(topic);
+        if (it == producers.end()) {
+            QueueProducer entry;
+            entry.queue.reset(session->createQueue(QueuePrefix + topic));
+            entry.producer.reset(session->createProducer(entry.queue.get()));
+            entry.producer->setDeliveryMode(cms::DeliveryMode::PERSISTENT);
+            it = producers.emplace(topic, std::move(entry)).first;
+        }
+        return *it->second.producer;
+    }
+
+    void Reset() {
+        try {
+            producers.clear();
+            if (session) session->close();
+        } catch (const cms::CMSException&) {
+            // conexión caída: no hay nada que cerrar del lado del broker
+        }
+        producers.clear();
+        session.reset();
+        connection.reset();
+    }
+};
+
+#endif // SERVICE_ACTIVEMQ_EVENT_SENDER_HPP
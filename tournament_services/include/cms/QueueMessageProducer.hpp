@@ -5,26 +5,112 @@
 #ifndef SERVICE_MESSAGE_PRODUCER_HPP
 #define SERVICE_MESSAGE_PRODUCER_HPP
 
-#include <string_view>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <cms/CMSException.h>
+#include <cms/MessageProducer.h>
+#include <cms/Queue.h>
+#include <cms/TextMessage.h>
 
 #include "IQueueMessageProducer.hpp"
 #include "cms/ConnectionManager.hpp"
 
+// Antes cada mensaje abría sesión, destino y productor y los cerraba al
+// terminar (varios viajes al broker por publicación). Ahora se reutilizan:
+// un canal = una sesión CMS + un productor por cola. Las sesiones no son
+// thread-safe, así que cada canal lo usa un solo hilo a la vez (se presta y
+// se devuelve); hay tantos canales como hilos publicando simultáneamente.
 class QueueMessageProducer: public IQueueMessageProducer {
+    struct Channel {
+        struct QueueProducer {
+            std::unique_ptr<cms::Queue> queue;
+            std::unique_ptr<cms::MessageProducer> producer;
+        };
+
+        // La sesión no debe sobrevivir a su conexión (declarada primero => se destruye al final)
+        std::shared_ptr<cms::Connection> connection;
+        std::uint64_t generation = 0;
+        std::unique_ptr<cms::Session> session;
+        std::unordered_map<std::string, QueueProducer> producers;
+
+        ~Channel() {
+            try {
+                producers.clear();
+                if (session) session->close();
+            } catch (const cms::CMSException&) {
+                // conexión caída: no hay nada que cerrar del lado del broker
+            }
+        }
+
+        cms::MessageProducer& ProducerFor(std::string_view queueName) {
+            auto it = producers.find(std::string(queueName));
+            if (it == producers.end()) {
+                QueueProducer entry;
+                entry.queue.reset(session->createQueue(std::string(queueName)));
+                entry.producer.reset(session->createProducer(entry.queue.get()));
+                entry.producer->setDeliveryMode(cms::DeliveryMode::NON_PERSISTENT);
+                it = producers.emplace(std::string(queueName), std::move(entry)).first;
+            }
+            return *it->second.producer;
+        }
+    };
+
     std::shared_ptr<ConnectionManager> connectionManager;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Channel>> idle;
+
 public:
     explicit QueueMessageProducer(const std::shared_ptr<ConnectionManager>& connectionManager) : connectionManager(connectionManager){}
 
     void SendMessage(const std::string_view& message, const std::string_view& queue) override {
-        auto session = connectionManager->CreateSession();
-        const auto destination = std::unique_ptr<cms::Destination>(session->createQueue(queue.data()));
-        auto producer = std::unique_ptr<cms::MessageProducer>(session->createProducer(destination.get()));
-        producer->setDeliveryMode( cms::DeliveryMode::NON_PERSISTENT );
+        for (int attempt = 0;; ++attempt) {
+            std::uint64_t generation = 0;
+            try {
+                auto channel = Acquire(generation);
+                const auto brokerMessage = std::unique_ptr<cms::TextMessage>(
+                    channel->session->createTextMessage(std::string(message)));
+                channel->ProducerFor(queue).send(brokerMessage.get());
+                Release(std::move(channel));
+                return;
+            } catch (const cms::CMSException&) {
+                // El canal que falló se descarta. Si el transporte se cayó se
+                // reabre la conexión y se reintenta una vez con un canal nuevo.
+                if (attempt > 0 || !connectionManager->ReconnectIfFailed(generation)) throw;
+            }
+        }
+    }
+
+private:
+    std::unique_ptr<Channel> Acquire(std::uint64_t& generation) {
+        auto [connection, current] = connectionManager->CurrentConnection();
+        generation = current;
+        std::vector<std::unique_ptr<Channel>> stale; // de una conexión anterior; se cierran sin el candado
+        {
+            std::lock_guard lock(mutex);
+            while (!idle.empty()) {
+                auto channel = std::move(idle.back());
+                idle.pop_back();
+                if (channel->generation == current) return channel;
+                stale.push_back(std::move(channel));
+            }
+        }
+
+        auto channel = std::make_unique<Channel>();
+        channel->connection = std::move(connection);
+        channel->generation = current;
+        channel->session.reset(channel->connection->createSession(cms::Session::AUTO_ACKNOWLEDGE));
+        return channel;
+    }
 
-        const auto brokerMessage = std::unique_ptr<cms::TextMessage>(session->createTextMessage(message.data()));
-        producer->send(brokerMessage.get());
+    void Release(std::unique_ptr<Channel> channel) {
+        std::lock_guard lock(mutex);
+        idle.push_back(std::move(channel));
     }
 };
 
-#endif //SERVICE_MESSAGE_PRODUCER_HPP
\ No newline at end of file
+#endif //SERVICE_MESSAGE_PRODUCER_HPP
@@ -0,0 +1,75 @@
+#ifndef SERVICES_COMPRESSION_RESPONSE_COMPRESSOR_HPP
+#define SERVICES_COMPRESSION_RESPONSE_COMPRESSOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+namespace compression {
+
+    // runConfig.compression. Por debajo de minBytes el gzip cuesta más CPU de
+    // lo que ahorra en la red; cacheBytes = 0 desactiva la caché.
+    struct CompressionOptions {
+        bool enabled = false;
+        std::size_t minBytes = 1024;
+        int level = 6;
+        std::size_t cacheBytes = 8 * 1024 * 1024;
+    };
+
+    inline void from_json(const nlohmann::json& json, CompressionOptions& options) {
+        options.enabled = json.value("enabled", options.enabled);
+        options.minBytes = json.value("minBytes", options.minBytes);
+        options.level = std::clamp(json.value("level", options.level), 1, 9);
+        options.cacheBytes = json.value("cacheBytes", options.cacheBytes);
+    }
+
+    // Accept-Encoding incluye gzip (o *) sin q=0
+    bool AcceptsGzip(std::string_view acceptEncoding);
+
+    std::string Gzip(std::string_view body, int level);
+
+    // Comprime en gzip las respuestas grandes cuando el cliente lo acepta. Los
+    // listados repetidos producen el mismo cuerpo, así que se guarda la copia
+    // comprimida junto al cuerpo original (LRU acotada por bytes) y un hit
+    // solo cuesta el hash y la comparación.
+    class ResponseCompressor {
+        struct Entry {
+            std::size_t hash;
+            std::string body;
+            std::string compressed;
+        };
+
+        CompressionOptions options;
+        std::mutex mutex;
+        std::list<Entry> entries;
+        std::unordered_map<std::size_t, std::list<Entry>::iterator> index;
+        std::size_t cachedBytes = 0;
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+
+    public:
+        explicit ResponseCompressor(CompressionOptions options) : options(options) {}
+
+        ResponseCompressor(const ResponseCompressor&) = delete;
+        ResponseCompressor& operator=(const ResponseCompressor&) = delete;
+
+        void Apply(const crow::request& request, crow::response& response);
+
+        [[nodiscard]] std::uint64_t CacheHits() const { return hits.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::uint64_t CacheMisses() const { return misses.load(std::memory_order_relaxed); }
+
+    private:
+        std::string Compress(const std::string& body);
+        void Remember(std::size_t hash, const std::string& body, const std::string& compressed);
+    };
+}
+
+#endif // SERVICES_COMPRESSION_RESPONSE_COMPRESSOR_HPP
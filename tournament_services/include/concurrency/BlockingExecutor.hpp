@@ -0,0 +1,132 @@
+#ifndef SERVICES_CONCURRENCY_BLOCKING_EXECUTOR_HPP
+#define SERVICES_CONCURRENCY_BLOCKING_EXECUTOR_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace concurrency {
+
+    // threads == 0 => mismo tamaño que el pool de conexiones (databaseConfig.poolSize)
+    // inlineRoutes: rutas baratas, sin base de datos, que se quedan en el hilo de I/O
+    struct BlockingExecutorOptions {
+        bool enabled = false;
+        std::size_t threads = 0;
+        std::size_t queueCapacity = 1024;
+        std::set<std::string, std::less<>> inlineRoutes;
+    };
+
+    inline void from_json(const nlohmann::json& json, BlockingExecutorOptions& options) {
+        options.enabled = json.value("enabled", false);
+        options.threads = json.value("threads", static_cast<std::size_t>(0));
+        options.queueCapacity = json.value("queueCapacity", static_cast<std::size_t>(1024));
+        if (options.queueCapacity == 0) options.queueCapacity = 1;
+        if (json.contains("inlineRoutes")) {
+            json.at("inlineRoutes").get_to(options.inlineRoutes);
+        }
+    }
+
+    // Pool fijo para el trabajo bloqueante (pqxx, productores de ActiveMQ) que
+    // no debe correr en los hilos de I/O de Crow. La cola es acotada: si se
+    // llena, TrySubmit() devuelve false y el llamador responde de inmediato
+    // en lugar de acumular latencia sin límite.
+    class BlockingExecutor {
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<std::move_only_function<void()>> tasks;
+        std::size_t capacity;
+        std::set<std::string, std::less<>> inlineRoutes;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+
+    public:
+        BlockingExecutor(std::size_t threads, std::size_t queueCapacity,
+                         std::set<std::string, std::less<>> inlineRoutes = {})
+            : capacity(queueCapacity), inlineRoutes(std::move(inlineRoutes)) {
+            workers.reserve(threads);
+            for (std::size_t i = 0; i < threads; ++i) {
+                workers.emplace_back([this] { Run(); });
+            }
+        }
+
+        // Termina lo que ya estaba en cola antes de unir los hilos
+        ~BlockingExecutor() {
+            {
+                std::lock_guard lock(mutex);
+                stopping = true;
+            }
+            available.notify_all();
+            // Grow() ya no agrega hilos una vez marcado stopping
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        BlockingExecutor(const BlockingExecutor&) = delete;
+        BlockingExecutor& operator=(const BlockingExecutor&) = delete;
+
+        [[nodiscard]] bool Enabled() {
+            return Threads() > 0;
+        }
+
+        [[nodiscard]] std::size_t Threads() {
+            std::lock_guard lock(mutex);
+            return workers.size();
+        }
+
+        // Solo crece, y solo si ya estaba habilitado: las rutas se enlazaron
+        // como síncronas o asíncronas según Offloads() al arrancar.
+        void Grow(std::size_t threads) {
+            std::lock_guard lock(mutex);
+            if (stopping || workers.empty()) return;
+            while (workers.size() < threads) {
+                workers.emplace_back([this] { Run(); });
+            }
+        }
+
+        // Se consulta una sola vez, al enlazar la ruta
+        [[nodiscard]] bool Offloads(std::string_view route) {
+            return Enabled() && !inlineRoutes.contains(route);
+        }
+
+        bool TrySubmit(std::move_only_function<void()> task) {
+            {
+                std::lock_guard lock(mutex);
+                if (stopping || workers.empty() || tasks.size() >= capacity) {
+                    return false;
+                }
+                tasks.push_back(std::move(task));
+            }
+            available.notify_one();
+            return true;
+        }
+
+    private:
+        void Run() {
+            while (true) {
+                std::move_only_function<void()> task;
+                {
+                    std::unique_lock lock(mutex);
+                    available.wait(lock, [this] { return stopping || !tasks.empty(); });
+                    if (tasks.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                task();
+            }
+        }
+    };
+}
+
+#endif // SERVICES_CONCURRENCY_BLOCKING_EXECUTOR_HPP
@@ -0,0 +1,85 @@
+#ifndef SERVICES_CONCURRENCY_POOL_SIZE_TUNER_HPP
+#define SERVICES_CONCURRENCY_POOL_SIZE_TUNER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <crow/logging.h>
+
+#include "concurrency/BlockingExecutor.hpp"
+#include "configuration/ConcurrencySizing.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+
+namespace concurrency {
+
+    // Con databaseConfig.poolSize = "auto": cada intervalo mide λ y W en el
+    // pool y lo agranda (junto con el BlockingExecutor, que no sirve de nada
+    // con más hilos que conexiones) hasta autoSizing.maxPoolSize.
+    class PoolSizeTuner {
+        std::shared_ptr<PostgresConnectionProvider> pool;
+        std::shared_ptr<BlockingExecutor> executor;
+        config::AutoSizingOptions options;
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+        std::thread worker;
+
+    public:
+        PoolSizeTuner(std::shared_ptr<PostgresConnectionProvider> pool,
+                      std::shared_ptr<BlockingExecutor> executor,
+                      config::AutoSizingOptions options)
+            : pool(std::move(pool)), executor(std::move(executor)), options(options) {
+            worker = std::thread([this] { Run(); });
+        }
+
+        ~PoolSizeTuner() {
+            {
+                std::lock_guard lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            worker.join();
+        }
+
+        PoolSizeTuner(const PoolSizeTuner&) = delete;
+        PoolSizeTuner& operator=(const PoolSizeTuner&) = delete;
+
+    private:
+        void Run() {
+            auto previous = pool->TelemetryInterval();
+            auto since = std::chrono::steady_clock::now();
+            std::unique_lock lock(mutex);
+            while (!wake.wait_for(lock, std::chrono::milliseconds(options.intervalMs), [this] { return stopping; })) {
+                lock.unlock();
+                const auto now = std::chrono::steady_clock::now();
+                const auto current = pool->TelemetryInterval();
+                const std::chrono::duration<double> elapsed = now - since;
+                Adjust(current - previous, elapsed.count());
+                previous = current;
+                since = now;
+                lock.lock();
+            }
+        }
+
+        void Adjust(const PoolTelemetry::Snapshot& delta, double elapsedSeconds) {
+            const auto size = pool->Size();
+            const auto target = config::NextPoolSize(delta, elapsedSeconds, size, options);
+            if (target <= size) return;
+
+            try {
+                pool->Grow(target);
+            } catch (const std::exception& e) {
+                CROW_LOG_WARNING << "pool auto-sizing: could not open connections: " << e.what();
+                return;
+            }
+            executor->Grow(target);
+            CROW_LOG_INFO << "pool auto-sizing: " << size << " -> " << target << " connections ("
+                          << delta.acquisitions << " acquisitions in " << elapsedSeconds << "s, peak in use "
+                          << delta.peakInUse << ")";
+        }
+    };
+}
+
+#endif // SERVICES_CONCURRENCY_POOL_SIZE_TUNER_HPP
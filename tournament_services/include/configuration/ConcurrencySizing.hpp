@@ -0,0 +1,130 @@
+#ifndef TOURNAMENTS_CONCURRENCY_SIZING_HPP
+#define TOURNAMENTS_CONCURRENCY_SIZING_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <nlohmann/json.hpp>
+
+#include "persistence/configuration/PoolTelemetry.hpp"
+
+namespace config {
+
+    // "auto" en runConfig.concurrency / databaseConfig.poolSize. Los límites
+    // acotan lo que concurrency::PoolSizeTuner puede hacer crecer el pool en caliente.
+    struct AutoSizingOptions {
+        std::size_t minPoolSize = 2;
+        std::size_t maxPoolSize = 32;
+        // Margen sobre L = λ·W para absorber ráfagas
+        double headroom = 1.5;
+        int intervalMs = 10000;
+    };
+
+    inline void from_json(const nlohmann::json& json, AutoSizingOptions& options) {
+        options.minPoolSize = std::max<std::size_t>(1, json.value("minPoolSize", options.minPoolSize));
+        options.maxPoolSize = std::max(options.minPoolSize, json.value("maxPoolSize", options.maxPoolSize));
+        options.headroom = std::max(1.0, json.value("headroom", options.headroom));
+        options.intervalMs = std::max(100, json.value("intervalMs", options.intervalMs));
+    }
+
+    // cgroup v2, /sys/fs/cgroup/cpu.max: "<quota> <period>" o "max <period>"
+    inline std::optional<double> ParseCpuMax(std::string_view text) {
+        std::istringstream in{std::string(text)};
+        std::string quota;
+        double period = 0;
+        if (!(in >> quota >> period) || quota == "max" || period <= 0) {
+            return std::nullopt;
+        }
+        double value = 0;
+        const auto [end, ec] = std::from_chars(quota.data(), quota.data() + quota.size(), value);
+        if (ec != std::errc{} || value <= 0) {
+            return std::nullopt;
+        }
+        return value / period;
+    }
+
+    // cgroup v1: cpu.cfs_quota_us vale -1 cuando no hay límite
+    inline std::optional<double> ParseCfsQuota(std::string_view quotaText, std::string_view periodText) {
+        double quota = 0;
+        double period = 0;
+        std::istringstream{std::string(quotaText)} >> quota;
+        std::istringstream{std::string(periodText)} >> period;
+        if (quota <= 0 || period <= 0) {
+            return std::nullopt;
+        }
+        return quota / period;
+    }
+
+    // Una cuota de 1.5 CPU da 2 hilos: redondear hacia abajo dejaría medio
+    // CPU sin usar, y el exceso solo se nota como throttling breve.
+    inline std::size_t EffectiveCpus(unsigned hardwareThreads, std::optional<double> quota) {
+        std::size_t cpus = hardwareThreads > 0 ? hardwareThreads : 1;
+        if (quota) {
+            cpus = std::min(cpus, static_cast<std::size_t>(std::ceil(*quota)));
+        }
+        return std::max<std::size_t>(1, cpus);
+    }
+
+    inline std::optional<std::string> ReadFile(const char* path) {
+        std::ifstream file(path);
+        if (!file) return std::nullopt;
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    inline std::optional<double> CgroupCpuQuota() {
+        if (const auto cpuMax = ReadFile("/sys/fs/cgroup/cpu.max")) {
+            return ParseCpuMax(*cpuMax);
+        }
+        const auto quota = ReadFile("/sys/fs/cgroup/cpu/cpu.cfs_quota_us");
+        const auto period = ReadFile("/sys/fs/cgroup/cpu/cpu.cfs_period_us");
+        if (quota && period) {
+            return ParseCfsQuota(*quota, *period);
+        }
+        return std::nullopt;
+    }
+
+    inline std::size_t AvailableCpus() {
+        return EffectiveCpus(std::thread::hardware_concurrency(), CgroupCpuQuota());
+    }
+
+    // Ley de Little: conexiones ocupadas en promedio L = λ·W, con λ las
+    // adquisiciones por segundo y W el tiempo medio que se retiene cada una.
+    inline std::size_t LittlesLawPoolSize(double acquisitionsPerSecond, double meanHoldSeconds,
+                                          const AutoSizingOptions& options) {
+        const double busy = acquisitionsPerSecond * meanHoldSeconds * options.headroom;
+        const auto wanted = static_cast<std::size_t>(std::ceil(busy));
+        return std::clamp(wanted, options.minPoolSize, options.maxPoolSize);
+    }
+
+    // Tamaño siguiente a partir de la diferencia de telemetría de un
+    // intervalo. Nunca achica: una conexión ociosa cuesta poco y cerrarla
+    // con carga en vuelo obligaría a coordinar con Connection().
+    inline std::size_t NextPoolSize(const PoolTelemetry::Snapshot& delta, double elapsedSeconds,
+                                    std::size_t current, const AutoSizingOptions& options) {
+        if (delta.acquisitions == 0 || elapsedSeconds <= 0) {
+            return current;
+        }
+        const double rate = static_cast<double>(delta.acquisitions) / elapsedSeconds;
+        const double meanHold = static_cast<double>(delta.holdNanos) / 1e9 / static_cast<double>(delta.acquisitions);
+        return std::max(current, LittlesLawPoolSize(rate, meanHold, options));
+    }
+
+    // Acepta un número o "auto"; 0 significa "auto"
+    inline std::size_t SizeOrAuto(const nlohmann::json& json) {
+        if (json.is_string() && json.get<std::string>() == "auto") {
+            return 0;
+        }
+        return json.get<std::size_t>();
+    }
+}
+
+#endif //TOURNAMENTS_CONCURRENCY_SIZING_HPP
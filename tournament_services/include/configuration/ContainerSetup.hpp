@@ -11,9 +11,13 @@
 #include <memory>
 
 #include "persistence/repository/IRepository.hpp"
-#include "persistence/repository/TeamRepository.hpp"
+#include "persistence/repository/PostgresTeamRepository.hpp"
 #include "persistence/repository/ITeamRepository.hpp"
 #include "RunConfiguration.hpp"
+#include "compression/ResponseCompressor.hpp"
+#include "concurrency/BlockingExecutor.hpp"
+#include "concurrency/PoolSizeTuner.hpp"
+#include "ConcurrencySizing.hpp"
 #include "cms/ConnectionManager.hpp"
 #include "delegate/TeamDelegate.hpp"
 #include "controller/TeamController.hpp"
@@ -30,10 +34,20 @@
 #include "controller/GroupController.hpp"
 #include "persistence/repository/MatchRepository.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
+#include "persistence/repository/OutboxRepository.hpp"
 #include "delegate/IMatchDelegate.hpp"
 #include "delegate/MatchDelegate.hpp"
 #include "controller/MatchController.hpp"
+#include "controller/MetricsController.hpp"
+#include "metrics/MetricsRegistry.hpp"
+#include "messaging/AsyncEventBus.hpp"
 #include "messaging/EventBus.hpp"
+#include "messaging/LiveEventBus.hpp"
+#include "messaging/OutboxRelay.hpp"
+#include "cms/ActiveMqEventSender.hpp"
+#include "cms/LiveEventPublisher.hpp"
+#include "events/TournamentEventHub.hpp"
+#include "events/LiveEventRelay.hpp"
 
 namespace config {
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
@@ -45,11 +59,46 @@ namespace config {
         std::shared_ptr<RunConfiguration> appConfig = std::make_shared<RunConfiguration>(configuration["runConfig"]);
         builder.registerInstance(appConfig);
 
+        // "auto": hilos de Crow = CPUs del contenedor; el pool arranca igual
+        // y PoolSizeTuner lo agranda según la latencia medida.
+        const size_t cpus = AvailableCpus();
+        if (appConfig->concurrency <= 0) {
+            appConfig->concurrency = static_cast<int>(cpus);
+        }
+        const size_t configuredPoolSize = SizeOrAuto(configuration["databaseConfig"]["poolSize"]);
+        const bool autoPoolSize = configuredPoolSize == 0;
+        const auto& autoSizing = appConfig->autoSizing;
+        const size_t poolSize = autoPoolSize
+                              ? std::clamp(cpus, autoSizing.minPoolSize, autoSizing.maxPoolSize)
+                              : configuredPoolSize;
         std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
             configuration["databaseConfig"]["connectionString"].get<std::string>(),
-            configuration["databaseConfig"]["poolSize"].get<size_t>());
+            poolSize);
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
+        // Más hilos que conexiones solo agrega espera dentro de Connection()
+        const auto& executorOptions = appConfig->blockingExecutor;
+        const size_t executorThreads = !executorOptions.enabled ? 0
+                                     : executorOptions.threads > 0 ? executorOptions.threads
+                                     : poolSize;
+        auto blockingExecutor = std::make_shared<concurrency::BlockingExecutor>(
+            executorThreads, executorOptions.queueCapacity, executorOptions.inlineRoutes);
+        builder.registerInstance(blockingExecutor);
+
+        builder.registerInstance(std::make_shared<metrics::MetricsRegistry>());
+        builder.registerType<MetricsController>().singleInstance();
+        builder.registerInstance(std::make_shared<compression::ResponseCompressor>(appConfig->compression));
+
+        if (autoPoolSize) {
+            builder.registerInstance(std::make_shared<concurrency::PoolSizeTuner>(
+                postgressConnection, blockingExecutor, autoSizing));
+        }
+
+        CROW_LOG_INFO << "concurrency: cpus=" << cpus
+                      << " crowThreads=" << appConfig->concurrency
+                      << " dbPool=" << poolSize << (autoPoolSize ? " (auto, max " + std::to_string(autoSizing.maxPoolSize) + ")" : "")
+                      << " executorThreads=" << executorThreads;
+
         builder.registerType<ConnectionManager>()
             .onActivated([configuration](Hypodermic::ComponentContext&, const std::shared_ptr<ConnectionManager>& instance) {
                 instance->initialize(configuration["activemq"]["broker-url"].get<std::string>());
@@ -57,17 +106,33 @@ namespace config {
             .singleInstance();
 
         builder.registerType<QueueMessageProducer>().as<IQueueMessageProducer>().singleInstance();
-        builder.registerType<QueueMessageProducer>().named("tournamentAddTeamQueue");
+        // Instancia única: cada QueueMessageProducer guarda sus sesiones/productores
+        builder.registerType<QueueMessageProducer>().named("tournamentAddTeamQueue").singleInstance();
         builder.registerType<QueueResolver>().as<IResolver<IQueueMessageProducer> >().named("queueResolver").
                 singleInstance();
 
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string_view> >().singleInstance();
-        builder.registerType<GroupRepository>().as<IGroupRepository>().singleInstance();
+        auto teamRepository = std::make_shared<PostgresTeamRepository>(
+            postgressConnection,
+            configuration["databaseConfig"].value("teamWriteBehind", nlohmann::json::object()).get<TeamWriteBehindOptions>());
+        builder.registerInstance(teamRepository).as<ITeamRepository>();
+        // Formato de los eventos hacia tournament_consumer ("json" o "msgpack")
+        const auto eventEncoding = messaging::ParseEventEncoding(
+            configuration["activemq"].value("encoding", std::string{"json"}));
+        // Con outbox los repositorios escriben los eventos en su propia transacción
+        auto outboxOptions = configuration["databaseConfig"]
+            .value("outbox", nlohmann::json::object()).get<OutboxOptions>();
+        outboxOptions.encoding = eventEncoding;
+        builder.registerInstance(std::make_shared<GroupRepository>(postgressConnection, outboxOptions.enabled))
+            .as<IGroupRepository>();
 
         builder.registerType<TeamDelegate>()
             .as<ITeamDelegate>()
             .singleInstance();
-        builder.registerType<TeamController>().singleInstance();
+        builder.registerType<TeamController>()
+            .onActivated([appConfig](Hypodermic::ComponentContext&, const std::shared_ptr<TeamController>& instance) {
+                instance->UseFastJson(appConfig->UsesFastJson("teams"));
+            })
+            .singleInstance();
 
         builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string> >().singleInstance();
         builder.registerType<TournamentRepository>().as<ITournamentRepository>().singleInstance();
@@ -75,18 +140,80 @@ namespace config {
         builder.registerType<TournamentDelegate>()
             .as<ITournamentDelegate>()
             .singleInstance();
-        builder.registerType<TournamentController>().singleInstance();
+        builder.registerType<TournamentController>()
+            .onActivated([appConfig](Hypodermic::ComponentContext&, const std::shared_ptr<TournamentController>& instance) {
+                instance->UseFastJson(appConfig->UsesFastJson("tournaments"));
+            })
+            .singleInstance();
 
         builder.registerType<GroupDelegate>().as<IGroupDelegate>().singleInstance();
-        builder.registerType<GroupController>().singleInstance();
+        builder.registerType<GroupController>()
+            .onActivated([appConfig](Hypodermic::ComponentContext&, const std::shared_ptr<GroupController>& instance) {
+                instance->UseFastJson(appConfig->UsesFastJson("groups"));
+            })
+            .singleInstance();
 
-        builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
-        builder.registerType<NullEventBus>().as<IEventBus>().singleInstance();
+        auto matchRepository = std::make_shared<MatchRepository>(
+            postgressConnection,
+            configuration["databaseConfig"].value("scoreGroupCommit", nlohmann::json::object()).get<ScoreGroupCommitOptions>(),
+            outboxOptions.enabled);
+        builder.registerInstance(matchRepository).as<IMatchRepository>();
+        builder.registerInstance(std::make_shared<OutboxRepository>(postgressConnection)).as<IOutboxRepository>();
+        builder.registerInstanceFactory([outboxOptions](Hypodermic::ComponentContext& context) {
+                auto relay = std::make_shared<messaging::OutboxRelay>(
+                    context.resolve<IOutboxRepository>(),
+                    std::make_shared<ActiveMqEventSender>(context.resolve<ConnectionManager>()),
+                    outboxOptions);
+                if (outboxOptions.enabled) {
+                    context.resolve<metrics::MetricsRegistry>()->AddCollector(
+                        [weak = std::weak_ptr<messaging::OutboxRelay>(relay)](std::string& out) {
+                            if (auto live = weak.lock()) live->RenderMetrics(out);
+                        });
+                }
+                return relay;
+            })
+            .singleInstance();
+        builder.registerInstanceFactory([](Hypodermic::ComponentContext& context) {
+                auto publisher = std::make_shared<LiveEventPublisher>(context.resolve<ConnectionManager>());
+                context.resolve<metrics::MetricsRegistry>()->AddCollector(
+                    [weak = std::weak_ptr<LiveEventPublisher>(publisher)](std::string& out) {
+                        if (auto live = weak.lock()) live->RenderMetrics(out);
+                    });
+                return publisher;
+            })
+            .as<ILiveEventPublisher>()
+            .singleInstance();
+        // Eventos hacia tournament_consumer: con outbox los lleva OutboxRelay y el
+        // bus sólo alimenta a los clientes en vivo; si no, encolados sin esperar al broker
+        auto eventBusOptions = configuration["activemq"]
+            .value("eventBus", nlohmann::json::object()).get<messaging::AsyncEventBusOptions>();
+        eventBusOptions.encoding = eventEncoding;
+        builder.registerInstanceFactory([eventBusOptions, outboxOptions](Hypodermic::ComponentContext& context) {
+                std::shared_ptr<IEventBus> inner = std::make_shared<NullEventBus>();
+                if (eventBusOptions.enabled && !outboxOptions.enabled) {
+                    auto bus = std::make_shared<messaging::AsyncEventBus>(
+                        std::make_shared<ActiveMqEventSender>(context.resolve<ConnectionManager>()), eventBusOptions);
+                    context.resolve<metrics::MetricsRegistry>()->AddCollector(
+                        [weak = std::weak_ptr<messaging::AsyncEventBus>(bus)](std::string& out) {
+                            if (auto live = weak.lock()) live->RenderMetrics(out);
+                        });
+                    inner = std::move(bus);
+                }
+                return std::make_shared<LiveEventBus>(std::move(inner), context.resolve<ILiveEventPublisher>());
+            })
+            .as<IEventBus>()
+            .singleInstance();
+        builder.registerType<events::TournamentEventHub>().singleInstance();
+        builder.registerType<events::LiveEventRelay>().singleInstance();
         
         builder.registerType<MatchDelegate>()
             .as<IMatchDelegate>()
             .singleInstance();
-        builder.registerType<MatchController>().singleInstance();
+        builder.registerType<MatchController>()
+            .onActivated([appConfig](Hypodermic::ComponentContext&, const std::shared_ptr<MatchController>& instance) {
+                instance->UseFastJson(appConfig->UsesFastJson("matches"));
+            })
+            .singleInstance();
 
         return builder.build();
     }
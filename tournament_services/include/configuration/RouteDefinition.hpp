@@ -6,10 +6,23 @@
 #define RESTAPI_ROUTE_DEFINITION_HPP
 
 #include <crow.h>
+#include <crow/version.h>
 #include <Hypodermic/Container.h>
 #include <vector>
+#include <exception>
 #include <functional>
 #include <string>
+#include <string_view>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "compression/ResponseCompressor.hpp"
+#include "concurrency/BlockingExecutor.hpp"
+#include "metrics/MetricsRegistry.hpp"
+#include "util/Uuid.hpp"
 
 // Route definition storage
 struct RouteDefinition {
@@ -23,8 +36,13 @@ inline std::vector<RouteDefinition> &routeRegistry() {
     return registry;
 }
 
+template<typename>
+inline constexpr bool unsupported_controller_method_v = false;
+
+// Se resuelve por completo en compilación: una firma de controlador que no
+// encaje con la ruta rompe el build en lugar de lanzar en cada request.
 template<typename Controller, typename Method, typename... Args>
-auto invokeController(Controller* controller, Method method, const crow::request& request, Args&&... args) {
+decltype(auto) invokeController(Controller* controller, Method method, const crow::request& request, Args&&... args) {
     if constexpr(std::is_invocable_v<Method, Controller*>) {
         return (controller->*method)();
     }
@@ -34,25 +52,192 @@ auto invokeController(Controller* controller, Method method, const crow::request
     else if constexpr( std::is_invocable_v<Method, Controller*, const crow::request&>) {
         return (controller->*method)(request);
     }
-    if constexpr(std::is_invocable_v<Method, Controller*, const crow::request&, Args...>) {
+    else if constexpr(std::is_invocable_v<Method, Controller*, const crow::request&, Args...>) {
         return (controller->*method)(request, std::forward<Args>(args)...);
     }
-    else  {
-        throw std::runtime_error("Controller does not exist");
+    else {
+        static_assert(unsupported_controller_method_v<Method>,
+                      "Controller method signature does not match the route parameters");
+    }
+}
+
+// Parámetros de ruta tipados: cada <string> de la ruta se convierte al tipo
+// que declara el método del controlador antes de invocarlo. Un valor inválido
+// responde 400 sin llegar al handler.
+template<typename T>
+struct RouteParam {
+    static_assert(unsupported_controller_method_v<T>, "Unsupported route parameter type");
+};
+
+template<>
+struct RouteParam<std::string> {
+    // Todos los <string> de la API son ids
+    static std::optional<std::string> Parse(std::string raw) {
+        if (!util::IsValidId(raw)) return std::nullopt;
+        return raw;
+    }
+};
+
+// Ids que son columnas uuid en Postgres: el controlador recibe el id ya
+// validado y en forma canónica, sin volver a comprobarlo
+template<>
+struct RouteParam<util::Uuid> {
+    static std::optional<util::Uuid> Parse(const std::string& raw) {
+        return util::Uuid::Parse(raw);
+    }
+};
+
+template<typename... Params>
+struct RouteParamList {
+    using type = std::tuple<std::remove_cvref_t<Params>...>;
+};
+
+template<typename... Params>
+struct RouteParamList<const crow::request&, Params...> {
+    using type = std::tuple<std::remove_cvref_t<Params>...>;
+};
+
+template<typename Method>
+struct ControllerMethodTraits;
+
+template<typename Result, typename Controller, typename... Params>
+struct ControllerMethodTraits<Result (Controller::*)(Params...)> {
+    using RouteParams = typename RouteParamList<Params...>::type;
+};
+
+template<typename Result, typename Controller, typename... Params>
+struct ControllerMethodTraits<Result (Controller::*)(Params...) const> {
+    using RouteParams = typename RouteParamList<Params...>::type;
+};
+
+template<typename Method, typename... Raw>
+concept RouteBindable =
+    sizeof...(Raw) == std::tuple_size_v<typename ControllerMethodTraits<Method>::RouteParams> &&
+    (std::is_convertible_v<Raw, std::string> && ...);
+
+template<typename Controller, typename Method, typename... Raw>
+crow::response dispatchRoute(Controller* controller, Method method, const crow::request& request, Raw&&... raw) {
+    using Params = typename ControllerMethodTraits<Method>::RouteParams;
+
+    return [&]<std::size_t... I>(std::index_sequence<I...>) -> crow::response {
+        std::tuple<std::optional<std::tuple_element_t<I, Params>>...> parsed{
+            RouteParam<std::tuple_element_t<I, Params>>::Parse(std::forward<Raw>(raw))...
+        };
+        if (!(std::get<I>(parsed).has_value() && ...)) {
+            return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+        }
+        return invokeController(controller, method, request, std::move(*std::get<I>(parsed))...);
+    }(std::index_sequence_for<Raw...>{});
+}
+
+// Mientras una respuesta asíncrona está pendiente, el único dueño de la
+// conexión en Crow 1.2 es el complete_request_handler_ de la respuesta, y
+// end() lo reemplaza a media llamada (la conexión se libera debajo de sí
+// misma). Crow no expone otra forma de retener la conexión: response declara
+// amiga a toda especialización de crow::Connection y esta solo copia el
+// handler para sostenerla durante end(). Depende de los internos de 1.2, así
+// que otra versión no compila hasta revisar dispatchRouteAsync.
+static_assert(std::string_view(crow::VERSION).starts_with("1.2."),
+              "RouteCompletionAccess relies on crow::response internals of Crow 1.2; "
+              "re-check dispatchRouteAsync before upgrading Crow");
+
+struct RouteCompletionAccess;
+
+template<>
+class crow::Connection<RouteCompletionAccess, RouteCompletionAccess> {
+    static_assert(std::is_same_v<decltype(crow::response::complete_request_handler_), std::function<void()>>,
+                  "crow::response::complete_request_handler_ changed type");
+
+public:
+    static std::function<void()> Retain(const crow::response& response) {
+        return response.complete_request_handler_;
+    }
+};
+
+// Asignar la respuesta entera borraría las cabeceras que Crow y los
+// middlewares ya pusieron en `response` (connection: Keep-Alive se agrega al
+// volver el handler). Se copian código y cuerpo, y las cabeceras del
+// resultado reemplazan sólo a las de mismo nombre.
+inline void applyRouteResult(crow::response& response, crow::response&& result) {
+    response.code = result.code;
+    response.body = std::move(result.body);
+    for (const auto& [name, value] : result.headers) {
+        response.headers.erase(name);
     }
+    response.headers.merge(result.headers);
+}
+
+// Modo asíncrono: el handler (y su pqxx bloqueante) corre en el BlockingExecutor
+// y el hilo de I/O queda libre para las demás conexiones. La respuesta se
+// completa con un post al io_context de la conexión, porque Crow no permite
+// escribir en el socket desde otro hilo. `request` sigue vivo hasta end():
+// la conexión se retiene a sí misma mientras la respuesta está pendiente.
+template<typename Controller, typename Method, typename... Raw>
+void dispatchRouteAsync(concurrency::BlockingExecutor& executor, metrics::RequestTimer timer,
+                        compression::ResponseCompressor* compressor, Controller* controller,
+                        Method method, const crow::request& request, crow::response& response, Raw&&... raw) {
+    // Si TrySubmit la rechaza, la tarea se destruye sin correr
+    timer.AbandonedStatus(crow::SERVICE_UNAVAILABLE);
+    auto task = [controller, method, compressor, &request, &response, timer = std::move(timer),
+                 ...params = std::string(std::forward<Raw>(raw))]() mutable {
+        crow::response result;
+        try {
+            result = dispatchRoute(controller, method, request, std::move(params)...);
+            if (compressor) compressor->Apply(request, result);
+        } catch (const std::exception& e) {
+            CROW_LOG_ERROR << "Unhandled exception in " << request.url << ": " << e.what();
+            result = crow::response{crow::INTERNAL_SERVER_ERROR};
+        }
+        asio::post(*request.io_context, [&response, result = std::move(result), timer = std::move(timer)]() mutable {
+            const auto retain = crow::Connection<RouteCompletionAccess, RouteCompletionAccess>::Retain(response);
+            timer.Finish(result.code);
+            applyRouteResult(response, std::move(result));
+            response.end();
+        });
+    };
 
+    if (!executor.TrySubmit(std::move(task))) {
+        response = crow::response{crow::SERVICE_UNAVAILABLE, "Server busy"};
+        response.end();
+    }
 }
 
 // Annotation-style macro
+// Los controladores son singleInstance(): se resuelven una sola vez al enlazar
+// la ruta y el handler guarda el puntero, sin pasar por el contenedor por request.
+// Con runConfig.blockingExecutor habilitado el handler se despacha con dispatchRouteAsync.
+// Cada ruta queda medida en metrics::MetricsRegistry (GET /metrics) y su
+// respuesta pasa por compression::ResponseCompressor (runConfig.compression).
 #define REGISTER_ROUTE(Controller, Method, Path, HttpMethod) \
 struct Controller## _##Method##_RouteRegistrator { \
     Controller##_##Method##_RouteRegistrator() { \
         routeRegistry().push_back({ Path, HttpMethod, \
             [](crow::SimpleApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
-                    CROW_ROUTE(app, Path).methods(HttpMethod)( \
-                        [container](const crow::request& request ,auto&&... args) { \
-                        auto controller = container->resolve<Controller>(); \
-                        return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                    std::shared_ptr<Controller> controller = container->resolve<Controller>(); \
+                    std::shared_ptr<concurrency::BlockingExecutor> executor = container->resolve<concurrency::BlockingExecutor>(); \
+                    std::shared_ptr<metrics::MetricsRegistry> metrics = container->resolve<metrics::MetricsRegistry>(); \
+                    const std::size_t metricsRoute = metrics ? metrics->Route(Path, crow::method_name(HttpMethod)) : 0; \
+                    std::shared_ptr<compression::ResponseCompressor> compressor = container->resolve<compression::ResponseCompressor>(); \
+                    auto& rule = CROW_ROUTE(app, Path).methods(HttpMethod); \
+                    if (executor && executor->Offloads(Path)) { \
+                        rule([owner = controller, target = controller.get(), executor, metrics, metricsRoute, compressor]( \
+                                const crow::request& request, crow::response& response, auto&&... args) \
+                            requires RouteBindable<decltype(&Controller::Method), decltype(args)...> { \
+                            dispatchRouteAsync(*executor, metrics::RequestTimer{metrics.get(), metricsRoute}, compressor.get(), \
+                                               target, &Controller::Method, request, response, \
+                                               std::forward<decltype(args)>(args)...); \
+                        }); \
+                        return; \
+                    } \
+                    rule( \
+                        [owner = controller, target = controller.get(), metrics, metricsRoute, compressor]( \
+                            const crow::request& request, auto&&... args) \
+                        requires RouteBindable<decltype(&Controller::Method), decltype(args)...> { \
+                        metrics::RequestTimer timer{metrics.get(), metricsRoute}; \
+                        auto response = dispatchRoute(target, &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                        if (compressor) compressor->Apply(request, response); \
+                        timer.Finish(response.code); \
+                        return response; \
                     } \
                 ); \
             } \
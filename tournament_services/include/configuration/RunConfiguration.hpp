@@ -1,16 +1,47 @@
 #ifndef TOURNAMENTS_APPLICATION_PROPERTIES_HPP
 #define TOURNAMENTS_APPLICATION_PROPERTIES_HPP
+#include <set>
+#include <string>
 #include <nlohmann/json.hpp>
 
+#include "compression/ResponseCompressor.hpp"
+#include "concurrency/BlockingExecutor.hpp"
+#include "ConcurrencySizing.hpp"
+
 namespace config{
     struct RunConfiguration{
         int port;
+        // "auto" (0 al leer) => CPUs disponibles, respetando la cuota del cgroup
         int concurrency;
+        // Controladores que serializan con serialization::JsonWriter
+        // ("teams", "groups", "matches", "tournaments")
+        std::set<std::string> fastJson;
+        // Handlers fuera de los hilos de I/O de Crow (ver dispatchRouteAsync)
+        concurrency::BlockingExecutorOptions blockingExecutor;
+        AutoSizingOptions autoSizing;
+        // gzip negociado para respuestas grandes (listados de partidos)
+        compression::CompressionOptions compression;
+
+        [[nodiscard]] bool UsesFastJson(const std::string& route) const {
+            return fastJson.contains(route);
+        }
     };
 
     inline void from_json(const nlohmann::json& json, RunConfiguration& applicationProperties) {
         json.at("port").get_to(applicationProperties.port);
-        json.at("concurrency").get_to(applicationProperties.concurrency);
+        applicationProperties.concurrency = static_cast<int>(SizeOrAuto(json.at("concurrency")));
+        if (json.contains("fastJson")) {
+            json.at("fastJson").get_to(applicationProperties.fastJson);
+        }
+        if (json.contains("blockingExecutor")) {
+            json.at("blockingExecutor").get_to(applicationProperties.blockingExecutor);
+        }
+        if (json.contains("autoSizing")) {
+            json.at("autoSizing").get_to(applicationProperties.autoSizing);
+        }
+        if (json.contains("compression")) {
+            json.at("compression").get_to(applicationProperties.compression);
+        }
     }
 }
 #endif
@@ -15,37 +15,42 @@
 #include "delegate/IGroupDelegate.hpp"
 #include "domain/Group.hpp"
 #include "domain/Utilities.hpp"
+#include "util/Uuid.hpp"
 
 class GroupController {
     std::shared_ptr<IGroupDelegate> groupDelegate;
+    bool fastJson = false;
 
 public:
     explicit GroupController(const std::shared_ptr<IGroupDelegate>& delegate);
     ~GroupController() = default;
 
+    // Serializador directo a buffer en lugar de nlohmann::json (runConfig.fastJson)
+    void UseFastJson(bool enabled) { fastJson = enabled; }
+
     // GET /tournaments/<TOURNAMENT-ID>/groups
-    crow::response GetGroups(const std::string& tournamentId);
+    crow::response GetGroups(const util::Uuid& tournamentId);
 
     // GET /tournaments/<TOURNAMENT-ID>/groups/<GROUP-ID>
-    crow::response GetGroup(const std::string& tournamentId, const std::string& groupId);
+    crow::response GetGroup(const util::Uuid& tournamentId, const util::Uuid& groupId);
 
     // POST /tournaments/<TOURNAMENT-ID>/groups
-    crow::response CreateGroup(const crow::request& request, const std::string& tournamentId);
+    crow::response CreateGroup(const crow::request& request, const util::Uuid& tournamentId);
 
     // PATCH /tournaments/<TOURNAMENT-ID>/groups/<GROUP-ID>
     crow::response UpdateGroup(const crow::request& request,
-                               const std::string& tournamentId,
-                               const std::string& groupId);
+                               const util::Uuid& tournamentId,
+                               const util::Uuid& groupId);
 
     // PATCH /tournaments/<TOURNAMENT-ID>/groups/<GROUP-ID>/teams
     crow::response UpdateTeams(const crow::request& request,
-                               const std::string& tournamentId,
-                               const std::string& groupId);
+                               const util::Uuid& tournamentId,
+                               const util::Uuid& groupId);
 
     // POST /tournaments/<TOURNAMENT-ID>/groups/<GROUP-ID>
     crow::response AddTeam(const crow::request& request,
-                           const std::string& tournamentId,
-                           const std::string& groupId);
+                           const util::Uuid& tournamentId,
+                           const util::Uuid& groupId);
 };
 
 #endif /* A7B3517D_1DC1_4B59_A78C_D3E03D29710C */
@@ -1,6 +1,7 @@
 #ifndef SERVICES_MATCH_CONTROLLER_HPP
 #define SERVICES_MATCH_CONTROLLER_HPP
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <crow.h>
@@ -9,10 +10,17 @@
 
 class MatchController {
     std::shared_ptr<IMatchDelegate> matchDelegate;
+    bool fastJson = false;
 
 public:
+    // Tope de partidos por POST .../matches:batchScore (4 parámetros por fila en el UPDATE)
+    static constexpr std::size_t MaxScoreBatch = 1000;
+
     explicit MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate);
 
+    // Serializador directo a buffer en lugar de nlohmann::json (runConfig.fastJson)
+    void UseFastJson(bool enabled) { fastJson = enabled; }
+
     // GET /tournaments/<tournamentId>/matches
     [[nodiscard]] crow::response GetMatches(const crow::request& request, 
                                            const std::string& tournamentId) const;
@@ -25,6 +33,10 @@ public:
     [[nodiscard]] crow::response UpdateMatchScore(const crow::request& request,
                                                   const std::string& tournamentId,
                                                   const std::string& matchId) const;
+
+    // POST /tournaments/<tournamentId>/matches:batchScore
+    [[nodiscard]] crow::response UpdateMatchScores(const crow::request& request,
+                                                   const std::string& tournamentId) const;
 };
 
 #endif
@@ -0,0 +1,19 @@
+#ifndef RESTAPI_METRICS_CONTROLLER_HPP
+#define RESTAPI_METRICS_CONTROLLER_HPP
+
+#include <memory>
+#include <crow.h>
+
+#include "metrics/MetricsRegistry.hpp"
+
+class MetricsController {
+    std::shared_ptr<metrics::MetricsRegistry> registry;
+
+public:
+    explicit MetricsController(const std::shared_ptr<metrics::MetricsRegistry>& registry);
+
+    // GET /metrics (Prometheus)
+    [[nodiscard]] crow::response Scrape() const;
+};
+
+#endif // RESTAPI_METRICS_CONTROLLER_HPP
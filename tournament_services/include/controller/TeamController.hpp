@@ -3,25 +3,30 @@
 #ifndef RESTAPI_TEAM_CONTROLLER_HPP
 #define RESTAPI_TEAM_CONTROLLER_HPP
 
+#include <cstddef>
 #include <memory>
-#include <regex>
 #include <string>
 #include <crow.h>
 #include <nlohmann/json.hpp>
 
 #include "delegate/ITeamDelegate.hpp"
-
-// Patrón simple para IDs (coincidir con otros controladores/proyectos)
-inline const std::regex ID_VALUE{R"(^[A-Za-z0-9-]+$)"};
+#include "util/Uuid.hpp"
 
 class TeamController {
+    // Tope de equipos por POST /teams:batch (un INSERT con un parámetro por equipo)
+    static constexpr std::size_t MaxTeamBatch = 256;
+
     std::shared_ptr<ITeamDelegate> teamDelegate;
+    bool fastJson = false;
 
 public:
     explicit TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate);
 
+    // Serializador directo a buffer en lugar de nlohmann::json (runConfig.fastJson)
+    void UseFastJson(bool enabled) { fastJson = enabled; }
+
     // GET /teams/<id>
-    [[nodiscard]] crow::response getTeam(const std::string& teamId) const;
+    [[nodiscard]] crow::response getTeam(const util::Uuid& teamId) const;
 
     // GET /teams  (firma que usan los tests)
     [[nodiscard]] crow::response GetTeams(const crow::request& request) const;
@@ -32,9 +37,12 @@ public:
     // POST /teams
     [[nodiscard]] crow::response SaveTeam(const crow::request& request) const;
 
+    // POST /teams:batch  (arreglo de equipos; resultado por elemento, en orden)
+    [[nodiscard]] crow::response SaveTeams(const crow::request& request) const;
+
     // PATCH /teams/<id>
     [[nodiscard]] crow::response UpdateTeam(const crow::request& request,
-                                            const std::string& teamId) const;
+                                            const util::Uuid& teamId) const;
 };
 
 #endif // RESTAPI_TEAM_CONTROLLER_HPP
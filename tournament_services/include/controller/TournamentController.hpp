@@ -9,16 +9,21 @@
 #include <crow.h>
 
 #include "delegate/ITournamentDelegate.hpp"
+#include "util/Uuid.hpp"
 
 
 class TournamentController {
     std::shared_ptr<ITournamentDelegate> tournamentDelegate;
+    bool fastJson = false;
 public:
     explicit TournamentController(std::shared_ptr<ITournamentDelegate> tournament);
+
+    // Serializador directo a buffer en lugar de nlohmann::json (runConfig.fastJson)
+    void UseFastJson(bool enabled) { fastJson = enabled; }
     [[nodiscard]] crow::response CreateTournament(const crow::request &request) const;
     [[nodiscard]] crow::response ReadAll() const;
-    [[nodiscard]] crow::response GetById(const crow::request &request, const std::string& id) const;
-    [[nodiscard]] crow::response UpdateTournament(const crow::request &request, const std::string& id) const;
+    [[nodiscard]] crow::response GetById(const crow::request &request, const util::Uuid& id) const;
+    [[nodiscard]] crow::response UpdateTournament(const crow::request &request, const util::Uuid& id) const;
 };
 
 
@@ -8,6 +8,8 @@
 #include <memory>
 #include <nlohmann/json.hpp>
 
+#include "persistence/repository/IMatchRepository.hpp"
+
 // DTO for match response with team names
 struct MatchDTO {
     std::string matchId;
@@ -30,6 +32,9 @@ struct MatchDTO {
     };
     
     std::optional<ScoreInfo> score;
+
+    // Versión de la fila; viaja como ETag, no en el cuerpo
+    int version = 0;
     
     nlohmann::json ToJson() const {
         nlohmann::json j;
@@ -72,13 +77,23 @@ public:
              std::string_view matchId,
              MatchDTO& outMatch) = 0;
     
-    // Update match score
+    // Update match score in one round trip; expectedVersion (If-Match) rejects
+    // the write if someone else updated the match first. outVersion: new version
     // Returns: nullopt on success, error message on failure
     virtual std::optional<std::string>
     UpdateScore(std::string_view tournamentId,
                 std::string_view matchId,
                 int homeScore,
-                int awayScore) = 0;
+                int awayScore,
+                std::optional<int> expectedVersion,
+                int& outVersion) = 0;
+
+    // Update many scores of one tournament in a single transaction
+    // Returns: nullopt on success (unknown match ids in outNotFound), error message on failure
+    virtual std::optional<std::string>
+    UpdateScores(std::string_view tournamentId,
+                 const std::vector<ScoreUpdate>& updates,
+                 std::vector<std::string>& outNotFound) = 0;
 };
 
 #endif
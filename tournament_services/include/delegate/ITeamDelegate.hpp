@@ -15,6 +15,11 @@ public:
     // Evitar vistas colgantes: regresar std::string con el id creado o "" si hubo duplicado
     virtual std::string SaveTeam(const domain::Team& team) = 0;
 
+    // Alta en lote: nullopt = OK y outIds trae un id por equipo, en orden ("" = duplicado);
+    // string = error ("invalid_team_name")
+    virtual std::optional<std::string> SaveTeams(const std::vector<domain::Team>& teams,
+                                                 std::vector<std::string>& outIds) = 0;
+
     // C++17: nullopt = OK; string = mensaje de error ("team_not_found", etc.)
     virtual std::optional<std::string> UpdateTeam(const domain::Team& team) const = 0;
 };
@@ -9,20 +9,20 @@
 
 #include "delegate/IMatchDelegate.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 #include "persistence/repository/ITournamentRepository.hpp"
 #include "domain/Team.hpp"
 #include "messaging/IEventBus.hpp"
 
 class MatchDelegate : public IMatchDelegate {
     std::shared_ptr<IMatchRepository> matchRepo;
-    std::shared_ptr<IRepository<domain::Team, std::string_view>> teamRepo;
+    std::shared_ptr<ITeamRepository> teamRepo;
     std::shared_ptr<ITournamentRepository> tournamentRepo;
     std::shared_ptr<IEventBus> eventBus;
 
 public:
     MatchDelegate(std::shared_ptr<IMatchRepository> matchRepo,
-                  std::shared_ptr<IRepository<domain::Team, std::string_view>> teamRepo,
+                  std::shared_ptr<ITeamRepository> teamRepo,
                   std::shared_ptr<ITournamentRepository> tournamentRepo,
                   std::shared_ptr<IEventBus> eventBus);
 
@@ -40,10 +40,19 @@ public:
     UpdateScore(std::string_view tournamentId,
                 std::string_view matchId,
                 int homeScore,
-                int awayScore) override;
+                int awayScore,
+                std::optional<int> expectedVersion,
+                int& outVersion) override;
+
+    std::optional<std::string>
+    UpdateScores(std::string_view tournamentId,
+                 const std::vector<ScoreUpdate>& updates,
+                 std::vector<std::string>& outNotFound) override;
 
 private:
     std::optional<MatchDTO> ConvertToDTO(const domain::Match& match);
+    void PublishScoreUpdated(std::string_view tournamentId, std::string_view matchId,
+                             const domain::Match& match, int homeScore, int awayScore);
 };
 
 #endif
\ No newline at end of file
@@ -4,12 +4,12 @@
 #include <vector>
 #include <optional>
 #include "delegate/ITeamDelegate.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 #include "domain/Team.hpp"
 
 class TeamDelegate : public ITeamDelegate {
 public:
-    explicit TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string_view>> repository)
+    explicit TeamDelegate(std::shared_ptr<ITeamRepository> repository)
         : teamRepository(std::move(repository)) {}
 
     std::vector<std::shared_ptr<domain::Team>> GetAllTeams() override {
@@ -21,9 +21,13 @@ public:
     // Devuelve id creado o "" si duplicado (el repo ya aplica unicidad)
     std::string SaveTeam(const domain::Team& team) override;
 
+    // Valida todo el lote antes de insertar; un solo INSERT multi-fila
+    std::optional<std::string> SaveTeams(const std::vector<domain::Team>& teams,
+                                         std::vector<std::string>& outIds) override;
+
     // nullopt = OK; string = error ("team_not_found", …)
     std::optional<std::string> UpdateTeam(const domain::Team& team) const override;
 
 private:
-    std::shared_ptr<IRepository<domain::Team, std::string_view>> teamRepository;
+    std::shared_ptr<ITeamRepository> teamRepository;
 };
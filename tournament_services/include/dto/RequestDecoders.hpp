@@ -0,0 +1,62 @@
+#ifndef SERVICES_DTO_REQUEST_DECODERS_HPP
+#define SERVICES_DTO_REQUEST_DECODERS_HPP
+
+#include <cstddef>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "domain/Group.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include "persistence/repository/IMatchRepository.hpp"
+
+// Decodificadores de cuerpos de request: recorren el JSON una sola vez (SAX)
+// y llenan directamente la estructura destino, sin accept() previo ni DOM.
+namespace dto {
+
+    struct DecodeError {
+        enum class Kind {
+            Syntax,        // JSON mal formado
+            MissingField,  // falta un campo obligatorio
+            InvalidType    // el campo existe pero con otro tipo
+        };
+
+        Kind kind;
+        std::string field;        // ruta del campo: "name", "score.home", "teams[].id"
+        std::size_t position = 0; // byte del cuerpo donde se detectó (Syntax)
+        std::string message;
+    };
+
+    struct TournamentCreateRequest {
+        std::string name;
+        domain::TournamentFormat format;
+    };
+
+    struct ScoreUpdateRequest {
+        int home = 0;
+        int visitor = 0;
+    };
+
+    // { "id"?: string, "name"?: string }
+    std::expected<domain::Team, DecodeError> DecodeTeam(std::string_view body);
+
+    // [ { "id"?: string, "name"?: string }, ... ]
+    std::expected<std::vector<domain::Team>, DecodeError> DecodeTeams(std::string_view body);
+
+    // { "id"?, "name"?, "tournamentId"?: string, "teams"?: [team...] }
+    std::expected<domain::Group, DecodeError> DecodeGroup(std::string_view body);
+
+    // { "name"?: string, "format"?: { "numberOfGroups", "maxTeamsPerGroup", "type" },
+    //   "groupsCount"?, "maxTeamsPerGroup"? }  (las dos últimas por compatibilidad)
+    std::expected<TournamentCreateRequest, DecodeError> DecodeTournamentCreate(std::string_view body);
+
+    // { "score": { "home": int, "visitor": int } }
+    std::expected<ScoreUpdateRequest, DecodeError> DecodeScoreUpdate(std::string_view body);
+
+    // [ { "matchId": string, "score": { "home": int, "visitor": int } }, ... ]
+    std::expected<std::vector<ScoreUpdate>, DecodeError> DecodeScoreBatch(std::string_view body);
+}
+
+#endif // SERVICES_DTO_REQUEST_DECODERS_HPP
@@ -0,0 +1,97 @@
+#ifndef SERVICES_EVENTS_LIVE_EVENT_RELAY_HPP
+#define SERVICES_EVENTS_LIVE_EVENT_RELAY_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <cms/CMSException.h>
+#include <cms/MessageConsumer.h>
+#include <cms/Session.h>
+#include <cms/TextMessage.h>
+#include <cms/Topic.h>
+#include <crow/logging.h>
+
+#include "cms/ConnectionManager.hpp"
+#include "cms/LiveEventPublisher.hpp"
+#include "events/TournamentEventHub.hpp"
+
+namespace events {
+
+    // Suscriptor del topic tournament.live en este nodo: lo que publiquen los
+    // delegates de cualquier nodo y el consumer llega a los websockets locales.
+    // Lee en su propio hilo; si el broker no está o la conexión se cae, pide
+    // reconexión y vuelve a suscribirse solo. Lo publicado mientras tanto se
+    // pierde (topic sin durabilidad): el siguiente GET lo corrige.
+    class LiveEventRelay {
+        static constexpr int kReceiveTimeoutMs = 250;
+        static constexpr std::chrono::seconds kRetryDelay{1};
+
+        std::shared_ptr<ConnectionManager> connectionManager;
+        std::shared_ptr<TournamentEventHub> hub;
+        std::atomic<bool> running{false};
+        std::thread receiver;
+
+    public:
+        LiveEventRelay(const std::shared_ptr<ConnectionManager>& connectionManager,
+                       const std::shared_ptr<TournamentEventHub>& hub)
+            : connectionManager(connectionManager), hub(hub) {}
+
+        ~LiveEventRelay() { Stop(); }
+
+        LiveEventRelay(const LiveEventRelay&) = delete;
+        LiveEventRelay& operator=(const LiveEventRelay&) = delete;
+
+        void Start() {
+            if (running.exchange(true)) return;
+            receiver = std::thread([this] { ReceiveLoop(); });
+        }
+
+        void Stop() {
+            running = false;
+            if (receiver.joinable()) receiver.join();
+        }
+
+    private:
+        void ReceiveLoop() {
+            while (running) {
+                std::uint64_t generation = 0;
+                try {
+                    auto [connection, current] = connectionManager->CurrentConnection();
+                    generation = current;
+                    const std::unique_ptr<cms::Session> session(connection->createSession(cms::Session::AUTO_ACKNOWLEDGE));
+                    const std::unique_ptr<cms::Topic> topic(session->createTopic(LiveEventPublisher::Topic));
+                    const std::unique_ptr<cms::MessageConsumer> consumer(session->createConsumer(topic.get()));
+                    CROW_LOG_INFO << "live event relay: subscribed to " << LiveEventPublisher::Topic;
+
+                    while (running) {
+                        const std::unique_ptr<cms::Message> message(consumer->receive(kReceiveTimeoutMs));
+                        if (message) Forward(*message);
+                    }
+                    consumer->close();
+                    session->close();
+                } catch (const cms::CMSException& e) {
+                    CROW_LOG_WARNING << "live event relay: subscription lost, retrying: " << e.what();
+                    connectionManager->ReconnectIfFailed(generation);
+                    Pause();
+                }
+            }
+        }
+
+        void Forward(const cms::Message& message) {
+            const auto* text = dynamic_cast<const cms::TextMessage*>(&message);
+            if (text == nullptr || !text->propertyExists(LiveEventPublisher::TournamentIdProperty)) return;
+            hub->Broadcast(text->getStringProperty(LiveEventPublisher::TournamentIdProperty), text->getText());
+        }
+
+        void Pause() {
+            const auto until = std::chrono::steady_clock::now() + kRetryDelay;
+            while (running && std::chrono::steady_clock::now() < until) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+        }
+    };
+}
+
+#endif // SERVICES_EVENTS_LIVE_EVENT_RELAY_HPP
@@ -0,0 +1,45 @@
+#ifndef SERVICES_EVENTS_TOURNAMENT_EVENT_HUB_HPP
+#define SERVICES_EVENTS_TOURNAMENT_EVENT_HUB_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <crow/websocket.h>
+
+namespace events {
+
+    // Fan-out por torneo hacia los websockets de GET /tournaments/<id>/events.
+    // No hay hilos por conexión: send_text solo encola el frame en el
+    // io_context de cada conexión. Unsubscribe (desde onclose) toma el mismo
+    // lock que Broadcast, así que una conexión nunca se usa ya destruida.
+    class TournamentEventHub {
+        struct Channel {
+            std::string tournamentId;
+            std::mutex mutex;
+            std::vector<crow::websocket::connection*> subscribers;
+            // Posición en subscribers, para quitar en O(1) con miles de clientes
+            std::unordered_map<crow::websocket::connection*, std::size_t> positions;
+        };
+
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, std::shared_ptr<Channel>> channels;
+        std::unordered_map<crow::websocket::connection*, std::shared_ptr<Channel>> memberships;
+
+    public:
+        void Subscribe(const std::string& tournamentId, crow::websocket::connection& connection);
+
+        void Unsubscribe(crow::websocket::connection& connection);
+
+        // `frame` ya serializado una sola vez; devuelve a cuántos se envió
+        std::size_t Broadcast(std::string_view tournamentId, const std::string& frame);
+
+        [[nodiscard]] std::size_t Subscribers() const;
+        [[nodiscard]] std::size_t Subscribers(std::string_view tournamentId) const;
+    };
+}
+
+#endif // SERVICES_EVENTS_TOURNAMENT_EVENT_HUB_HPP
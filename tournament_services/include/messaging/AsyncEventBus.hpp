@@ -0,0 +1,156 @@
+#ifndef SERVICES_MESSAGING_ASYNC_EVENT_BUS_HPP
+#define SERVICES_MESSAGING_ASYNC_EVENT_BUS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "IEventBus.hpp"
+#include "messaging/BoundedRing.hpp"
+#include "messaging/EventCodec.hpp"
+#include "metrics/LatencyHistogram.hpp"
+
+namespace messaging {
+
+    // Qué hace Publish cuando el anillo está lleno (broker caído o lento)
+    enum class Backpressure {
+        Block,      // espera a que el hilo de envío libere lugar
+        DropOldest, // descarta el evento más viejo sin enviar
+        Fail        // lanza EventBusFull al que publica
+    };
+
+    struct AsyncEventBusOptions {
+        bool enabled = false;
+        std::size_t capacity = 8192;
+        std::size_t maxBatchSize = 128;
+        Backpressure backpressure = Backpressure::Block;
+        // Reintentos de un lote antes de descartarlo (con espera creciente)
+        int maxSendAttempts = 5;
+        std::chrono::milliseconds retryBackoff{100};
+        // Lo fija ContainerSetup desde activemq.encoding (lo comparte OutboxRelay)
+        EventEncoding encoding = EventEncoding::Json;
+    };
+
+    inline void from_json(const nlohmann::json& json, AsyncEventBusOptions& options) {
+        options.enabled = json.value("enabled", false);
+        options.capacity = json.value("capacity", static_cast<std::size_t>(8192));
+        options.maxBatchSize = json.value("maxBatchSize", static_cast<std::size_t>(128));
+        const auto policy = json.value("backpressure", std::string{"block"});
+        options.backpressure = policy == "drop-oldest" ? Backpressure::DropOldest
+                             : policy == "fail"        ? Backpressure::Fail
+                                                       : Backpressure::Block;
+        options.maxSendAttempts = json.value("maxSendAttempts", 5);
+        options.retryBackoff = std::chrono::milliseconds(json.value("retryBackoffMs", 100));
+        if (options.maxBatchSize == 0) options.maxBatchSize = 1;
+        if (options.maxSendAttempts < 1) options.maxSendAttempts = 1;
+    }
+
+    class EventBusFull : public std::runtime_error {
+    public:
+        EventBusFull() : std::runtime_error("event bus full") {}
+    };
+
+    // El cuerpo ya va codificado: el hilo de envío no toca el DOM de json
+    struct PendingEvent {
+        std::string topic;
+        std::string body;
+        std::chrono::steady_clock::time_point enqueued;
+        EventEncoding encoding = EventEncoding::Json;
+        // Id estable ante reenvíos ("outbox:<fila>", "bus:<instancia>:<n>"):
+        // un lote reintentado llega con los mismos ids y el consumer descarta
+        // lo que ya aplicó. Vacío => usa el JMSMessageID, que cambia si el
+        // productor reenvía.
+        std::string eventId;
+    };
+
+    // Envía un lote completo (una transacción del broker). Lanza si falla;
+    // el bus reintenta el mismo lote.
+    class IEventBatchSender {
+    public:
+        virtual ~IEventBatchSender() = default;
+        virtual void SendBatch(const std::vector<PendingEvent>& batch) = 0;
+    };
+
+    struct AsyncEventBusStats {
+        std::uint64_t published = 0;   // confirmados por el broker
+        std::uint64_t dropped = 0;     // descartados por drop-oldest
+        std::uint64_t rejected = 0;    // rechazados por fail
+        std::uint64_t failed = 0;      // perdidos tras agotar reintentos
+        std::uint64_t batches = 0;
+        std::size_t queued = 0;
+        std::size_t capacity = 0;
+        // Desde Publish hasta el commit del lote, en µs
+        metrics::HistogramSnapshot latency;
+    };
+
+    // IEventBus que no espera al broker: Publish serializa y encola en un
+    // anillo sin locks; un hilo propio saca lotes y los envía. El orden de
+    // publicación se conserva (un solo hilo de envío). Cada evento recibe su
+    // eventId al publicarse, así los reintentos del lote no lo duplican.
+    class AsyncEventBus : public IEventBus {
+    public:
+        AsyncEventBus(std::shared_ptr<IEventBatchSender> sender, AsyncEventBusOptions options);
+        ~AsyncEventBus() override; // Stop()
+
+        AsyncEventBus(const AsyncEventBus&) = delete;
+        AsyncEventBus& operator=(const AsyncEventBus&) = delete;
+
+        // Con Backpressure::Block espera lugar en el anillo. Con el bus ya
+        // detenido, o si se detiene mientras espera, lanza EventBusFull.
+        void Publish(std::string_view topic, const nlohmann::json& payload) override;
+
+        // Envía lo pendiente y termina el hilo de envío. Idempotente.
+        void Stop();
+
+        [[nodiscard]] AsyncEventBusStats Stats() const;
+
+        // Formato de texto de Prometheus, para anexar a GET /metrics
+        void RenderMetrics(std::string& out) const;
+
+    private:
+        void Enqueue(PendingEvent event);
+        void WaitForSpace();
+        void NotifySpace();
+        void Wake();
+        void DrainLoop();
+        void Send(std::vector<PendingEvent>& batch);
+
+        std::shared_ptr<IEventBatchSender> sender;
+        AsyncEventBusOptions options;
+        BoundedRing<PendingEvent> ring;
+
+        // Prefijo de los eventId: distinto en cada arranque, así el contador
+        // puede empezar de cero
+        const std::string instanceId;
+        std::atomic<std::uint64_t> sequence{0};
+
+        std::atomic<bool> stopping{false};
+        std::atomic<bool> idle{false};
+        std::atomic<std::uint32_t> wakeups{0};
+        // Publish bloqueados por el anillo lleno (Backpressure::Block) y el
+        // aviso que les da el hilo de envío al sacar, o Stop
+        std::atomic<std::uint32_t> blocked{0};
+        std::atomic<std::uint32_t> spaceFreed{0};
+
+        // Contadores: los de Publish los tocan varios hilos, el resto sólo el de envío
+        std::atomic<std::uint64_t> dropped{0};
+        std::atomic<std::uint64_t> rejected{0};
+        std::atomic<std::uint64_t> published{0};
+        std::atomic<std::uint64_t> failed{0};
+        std::atomic<std::uint64_t> batches{0};
+        std::array<std::atomic<std::uint64_t>, metrics::kBucketCount> latencyBuckets{};
+        std::atomic<std::uint64_t> latencySumMicros{0};
+
+        std::thread drainer;
+    };
+}
+
+#endif // SERVICES_MESSAGING_ASYNC_EVENT_BUS_HPP
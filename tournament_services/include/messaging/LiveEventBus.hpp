@@ -0,0 +1,36 @@
+#ifndef SERVICES_LIVE_EVENT_BUS_HPP
+#define SERVICES_LIVE_EVENT_BUS_HPP
+
+#include <exception>
+#include <memory>
+#include <crow/logging.h>
+
+#include "IEventBus.hpp"
+#include "cms/ILiveEventPublisher.hpp"
+
+// Decora el bus de eventos: todo evento con tournamentId sale además hacia
+// los clientes de GET /tournaments/<id>/events. El publicador sólo encola
+// (LiveEventPublisher), así que el request no espera al broker; un fallo no
+// debe tumbar la operación que ya se guardó.
+class LiveEventBus : public IEventBus {
+    std::shared_ptr<IEventBus> inner;
+    std::shared_ptr<ILiveEventPublisher> live;
+
+public:
+    LiveEventBus(std::shared_ptr<IEventBus> inner, std::shared_ptr<ILiveEventPublisher> live)
+        : inner(std::move(inner)), live(std::move(live)) {}
+
+    void Publish(std::string_view topic, const nlohmann::json& payload) override {
+        inner->Publish(topic, payload);
+
+        const auto tournamentId = payload.find("tournamentId");
+        if (tournamentId == payload.end() || !tournamentId->is_string()) return;
+        try {
+            live->Publish(tournamentId->get_ref<const std::string&>(), topic, payload);
+        } catch (const std::exception& e) {
+            CROW_LOG_WARNING << "live event " << topic << " not published: " << e.what();
+        }
+    }
+};
+
+#endif // SERVICES_LIVE_EVENT_BUS_HPP
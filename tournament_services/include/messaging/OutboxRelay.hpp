@@ -0,0 +1,67 @@
+#ifndef SERVICES_MESSAGING_OUTBOX_RELAY_HPP
+#define SERVICES_MESSAGING_OUTBOX_RELAY_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "messaging/AsyncEventBus.hpp"
+#include "persistence/repository/IOutboxRepository.hpp"
+
+namespace messaging {
+
+    struct OutboxRelayStats {
+        std::uint64_t relayed = 0; // filas publicadas y borradas
+        std::uint64_t batches = 0;
+        std::uint64_t errors = 0;  // lotes que fallaron (broker o base) y se reintentan
+    };
+
+    // Lleva la tabla outbox al broker: lotes en orden de id, uno por
+    // transacción del broker, y los borra al confirmar. Entrega al menos una
+    // vez: si el borrado falla después del commit del broker, el lote se
+    // vuelve a enviar.
+    class OutboxRelay {
+    public:
+        OutboxRelay(std::shared_ptr<IOutboxRepository> outbox,
+                    std::shared_ptr<IEventBatchSender> sender,
+                    OutboxOptions options);
+        ~OutboxRelay();
+
+        OutboxRelay(const OutboxRelay&) = delete;
+        OutboxRelay& operator=(const OutboxRelay&) = delete;
+
+        // No hace nada si el outbox está deshabilitado en la configuración
+        void Start();
+        void Stop();
+
+        // Un lote; devuelve cuántas filas publicó (lanza si falló)
+        std::size_t RelayOnce();
+
+        [[nodiscard]] OutboxRelayStats Stats() const;
+        void RenderMetrics(std::string& out) const;
+
+    private:
+        void Loop();
+        void Pause(std::chrono::milliseconds interval);
+
+        std::shared_ptr<IOutboxRepository> outbox;
+        std::shared_ptr<IEventBatchSender> sender;
+        OutboxOptions options;
+
+        std::mutex mutex;
+        std::condition_variable stopSignal;
+        bool stopping = false;
+        std::thread worker;
+
+        std::atomic<std::uint64_t> relayed{0};
+        std::atomic<std::uint64_t> batches{0};
+        std::atomic<std::uint64_t> errors{0};
+    };
+}
+
+#endif // SERVICES_MESSAGING_OUTBOX_RELAY_HPP
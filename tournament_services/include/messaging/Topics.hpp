@@ -1,5 +0,0 @@
-#pragma once
-namespace topics {
-    inline constexpr const char* GroupCreated   = "group.created";
-    inline constexpr const char* GroupTeamAdded = "group.team_added";
-}
@@ -0,0 +1,195 @@
+#ifndef SERVICES_METRICS_METRICS_REGISTRY_HPP
+#define SERVICES_METRICS_METRICS_REGISTRY_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "metrics/LatencyHistogram.hpp"
+#include "metrics/PrometheusText.hpp" // AppendHistogram, para los colectores
+
+namespace metrics {
+
+    // Contadores de una ruta en un hilo. Un único hilo escribe (load + store,
+    // sin instrucciones con lock) y el scrape lee con relaxed: puede ver un
+    // request a medias entre contadores, nunca un valor roto.
+    struct RouteSlot {
+        std::array<std::atomic<std::uint64_t>, kBucketCount> buckets{};
+        // 1xx..5xx
+        std::array<std::atomic<std::uint64_t>, 5> statuses{};
+        std::atomic<std::uint64_t> sumMicros{0};
+        // Puede quedar negativo en un hilo si el request terminó en otro
+        // (dispatchRouteAsync); la suma entre hilos es la correcta.
+        std::atomic<std::int64_t> inFlight{0};
+    };
+
+    struct RouteSnapshot {
+        std::string path;
+        std::string method;
+        HistogramSnapshot latency;
+        std::array<std::uint64_t, 5> statuses{};
+        std::int64_t inFlight = 0;
+    };
+
+    // Métricas por ruta sin locks en el camino del request: cada hilo tiene
+    // su propio shard y el scrape de GET /metrics los suma. Las rutas se
+    // registran una vez, al enlazarlas (REGISTER_ROUTE).
+    class MetricsRegistry {
+    public:
+        static constexpr std::size_t kMaxRoutes = 256;
+
+        MetricsRegistry() : generation(NextGeneration()) {}
+
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+        std::size_t Route(std::string path, std::string method) {
+            std::lock_guard lock(mutex);
+            for (std::size_t id = 0; id < routes.size(); ++id) {
+                if (routes[id].first == path && routes[id].second == method) return id;
+            }
+            if (routes.size() == kMaxRoutes) {
+                throw std::length_error("metrics: too many routes");
+            }
+            routes.emplace_back(std::move(path), std::move(method));
+            return routes.size() - 1;
+        }
+
+        void Started(std::size_t route) {
+            Bump(LocalShard().Slot(route).inFlight, 1);
+        }
+
+        void Finished(std::size_t route, int status, std::chrono::nanoseconds elapsed) {
+            auto& slot = LocalShard().Slot(route);
+            const auto micros = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+            Bump(slot.buckets[BucketIndex(micros)], 1);
+            Bump(slot.sumMicros, micros);
+            Bump(slot.statuses[StatusClass(status)], 1);
+            Bump(slot.inFlight, -1);
+        }
+
+        [[nodiscard]] std::vector<RouteSnapshot> Snapshot() const;
+
+        // Formato de texto de Prometheus (text/plain; version=0.0.4)
+        [[nodiscard]] std::string Render() const;
+
+        // Métricas que no son de rutas (p. ej. el bus de eventos): cada
+        // colector agrega su texto al final de Render()
+        void AddCollector(std::function<void(std::string&)> collector) {
+            std::lock_guard lock(mutex);
+            collectors.push_back(std::move(collector));
+        }
+
+    private:
+        struct Shard {
+            std::array<std::atomic<RouteSlot*>, kMaxRoutes> slots{};
+
+            ~Shard() {
+                for (auto& slot : slots) delete slot.load();
+            }
+
+            RouteSlot& Slot(std::size_t route) {
+                auto* slot = slots[route].load(std::memory_order_acquire);
+                if (slot == nullptr) {
+                    slot = new RouteSlot;
+                    slots[route].store(slot, std::memory_order_release);
+                }
+                return *slot;
+            }
+        };
+
+        template<typename T, typename Delta>
+        static void Bump(std::atomic<T>& counter, Delta delta) {
+            counter.store(counter.load(std::memory_order_relaxed) + static_cast<T>(delta), std::memory_order_relaxed);
+        }
+
+        static std::size_t StatusClass(int status) {
+            const int index = status / 100 - 1;
+            return static_cast<std::size_t>(index < 0 ? 0 : index > 4 ? 4 : index);
+        }
+
+        static std::uint64_t NextGeneration() {
+            static std::atomic<std::uint64_t> next{1};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // El hilo guarda su shard por registro; la generación evita confundir
+        // un registro nuevo con uno destruido que ocupaba la misma dirección.
+        Shard& LocalShard() {
+            thread_local std::vector<std::pair<std::uint64_t, Shard*>> local;
+            for (const auto& [owner, shard] : local) {
+                if (owner == generation) return *shard;
+            }
+            auto shard = std::make_unique<Shard>();
+            auto* raw = shard.get();
+            {
+                std::lock_guard lock(mutex);
+                shards.push_back(std::move(shard));
+            }
+            local.emplace_back(generation, raw);
+            return *raw;
+        }
+
+        const std::uint64_t generation;
+        mutable std::mutex mutex;
+        std::vector<std::pair<std::string, std::string>> routes;
+        std::vector<std::unique_ptr<Shard>> shards;
+        std::vector<std::function<void(std::string&)>> collectors;
+    };
+
+    // Mide un request de principio a fin. Se mueve junto con el trabajo en
+    // dispatchRouteAsync; si se destruye sin Finish() (excepción, tarea
+    // rechazada) cuenta con abandonedStatus.
+    class RequestTimer {
+        MetricsRegistry* registry = nullptr;
+        std::size_t route = 0;
+        std::chrono::steady_clock::time_point start;
+        int abandonedStatus = 500;
+
+    public:
+        RequestTimer() = default;
+
+        RequestTimer(MetricsRegistry* registry, std::size_t route)
+            : registry(registry), route(route), start(std::chrono::steady_clock::now()) {
+            if (registry) registry->Started(route);
+        }
+
+        RequestTimer(RequestTimer&& other) noexcept
+            : registry(std::exchange(other.registry, nullptr)), route(other.route), start(other.start),
+              abandonedStatus(other.abandonedStatus) {}
+
+        RequestTimer& operator=(RequestTimer&& other) noexcept {
+            if (this != &other) {
+                Finish(abandonedStatus);
+                registry = std::exchange(other.registry, nullptr);
+                route = other.route;
+                start = other.start;
+                abandonedStatus = other.abandonedStatus;
+            }
+            return *this;
+        }
+
+        ~RequestTimer() { Finish(abandonedStatus); }
+
+        void AbandonedStatus(int status) { abandonedStatus = status; }
+
+        void Finish(int status) {
+            if (auto* target = std::exchange(registry, nullptr)) {
+                target->Finished(route, status, std::chrono::steady_clock::now() - start);
+            }
+        }
+    };
+}
+
+#endif // SERVICES_METRICS_METRICS_REGISTRY_HPP
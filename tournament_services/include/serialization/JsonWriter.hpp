@@ -0,0 +1,67 @@
+#ifndef SERVICES_SERIALIZATION_JSON_WRITER_HPP
+#define SERVICES_SERIALIZATION_JSON_WRITER_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace serialization {
+
+    // Escritor JSON directo a un buffer. No construye DOM: las llaves se
+    // escriben como fragmentos precalculados y los enteros con std::to_chars.
+    // Clear() conserva la capacidad, así que un escritor reutilizado deja de
+    // pedir memoria una vez que alcanzó el tamaño de la respuesta típica.
+    class JsonWriter {
+        std::string buffer;
+
+    public:
+        explicit JsonWriter(std::size_t reserve = 0) { buffer.reserve(reserve); }
+
+        void Clear() noexcept { buffer.clear(); }
+
+        [[nodiscard]] std::string_view View() const noexcept { return buffer; }
+        [[nodiscard]] std::size_t Capacity() const noexcept { return buffer.capacity(); }
+
+        // Fragmento ya válido como JSON (llaves, separadores, `{"id":`)
+        void Raw(std::string_view fragment) { buffer.append(fragment); }
+        void Raw(char c) { buffer.push_back(c); }
+
+        void Int(long long value) {
+            char digits[24];
+            const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+            buffer.append(digits, result.ptr);
+        }
+
+        // Cadena entre comillas con el mismo escape que nlohmann::json::dump()
+        void String(std::string_view value) {
+            buffer.push_back('"');
+            std::size_t start = 0;
+            for (std::size_t i = 0; i < value.size(); ++i) {
+                const auto c = static_cast<unsigned char>(value[i]);
+                if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+                buffer.append(value.data() + start, i - start);
+                start = i + 1;
+                switch (c) {
+                    case '"':  buffer.append("\\\""); break;
+                    case '\\': buffer.append("\\\\"); break;
+                    case '\b': buffer.append("\\b"); break;
+                    case '\f': buffer.append("\\f"); break;
+                    case '\n': buffer.append("\\n"); break;
+                    case '\r': buffer.append("\\r"); break;
+                    case '\t': buffer.append("\\t"); break;
+                    default: {
+                        constexpr char hex[] = "0123456789abcdef";
+                        const char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0x0F]};
+                        buffer.append(escaped, sizeof(escaped));
+                    }
+                }
+            }
+            buffer.append(value.data() + start, value.size() - start);
+            buffer.push_back('"');
+        }
+    };
+}
+
+#endif // SERVICES_SERIALIZATION_JSON_WRITER_HPP
@@ -0,0 +1,40 @@
+#ifndef SERVICES_SERIALIZATION_RESPONSE_SERIALIZERS_HPP
+#define SERVICES_SERIALIZATION_RESPONSE_SERIALIZERS_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "serialization/JsonWriter.hpp"
+#include "delegate/IMatchDelegate.hpp"
+#include "domain/Group.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+
+// Serializadores rápidos para las respuestas GET. Producen exactamente el mismo
+// texto que el camino con nlohmann::json (llaves en orden alfabético), así que
+// cada ruta puede cambiar de uno a otro sin que el cliente note diferencia.
+namespace serialization {
+
+    void WriteTeam(JsonWriter& writer, const domain::Team& team);
+    void WriteGroup(JsonWriter& writer, const domain::Group& group);
+    void WriteMatch(JsonWriter& writer, const MatchDTO& match);
+    // {"id","name"}: la forma que usan GET /tournaments y GET /tournaments/<id>
+    void WriteTournamentSummary(JsonWriter& writer, const domain::Tournament& tournament);
+
+    // Cuerpos completos. Usan un JsonWriter por hilo que se reutiliza entre requests.
+    std::string TeamToJson(const domain::Team& team);
+    std::string TeamsToJson(const std::vector<std::shared_ptr<domain::Team>>& teams);
+    std::string GroupToJson(const domain::Group& group);
+    std::string GroupsToJson(const std::vector<std::shared_ptr<domain::Group>>& groups);
+    std::string MatchToJson(const MatchDTO& match);
+    std::string MatchesToJson(const std::vector<MatchDTO>& matches);
+    std::string TournamentToJson(const domain::Tournament& tournament);
+    std::string TournamentsToJson(const std::vector<std::shared_ptr<domain::Tournament>>& tournaments);
+
+    // POST /teams:batch, un elemento por equipo en el orden del request:
+    // {"id","name","status":201} o {"error":"duplicate team","name","status":409}
+    std::string TeamBatchToJson(const std::vector<domain::Team>& teams, const std::vector<std::string>& ids);
+}
+
+#endif // SERVICES_SERIALIZATION_RESPONSE_SERIALIZERS_HPP
@@ -15,10 +15,21 @@ int main() {
         def.binder(app, container);
     }
 
+    // ConnectionManager conecta al primer uso, así que sin broker el servicio
+    // arranca igual (resolver los controladores no lo toca). El relay se
+    // suscribe en su propio hilo y reintenta hasta que el broker aparezca.
+    auto liveEventRelay = container->resolve<events::LiveEventRelay>();
+    liveEventRelay->Start();
+
+    // Arranca sólo si databaseConfig.outbox.enabled; si el broker no está,
+    // cada lote falla y se reintenta tras databaseConfig.outbox.retryBackoffMs
+    container->resolve<messaging::OutboxRelay>()->Start();
+
     auto appConfig = container->resolve<config::RunConfiguration>();
 
     app.port(appConfig->port)
         .concurrency(appConfig->concurrency)
         .run();
+    liveEventRelay->Stop();
     activemq::library::ActiveMQCPP::shutdownLibrary();
 }
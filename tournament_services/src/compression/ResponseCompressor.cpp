@@ -0,0 +1,143 @@
+#include "compression/ResponseCompressor.hpp"
+
+#include <charconv>
+#include <functional>
+#include <stdexcept>
+#include <zlib.h>
+
+namespace compression {
+    namespace {
+        std::string_view Trim(std::string_view text) {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) text.remove_suffix(1);
+            return text;
+        }
+
+        bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+            if (a.size() != b.size()) return false;
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                const auto lower = [](char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; };
+                if (lower(a[i]) != lower(b[i])) return false;
+            }
+            return true;
+        }
+
+        // "gzip;q=0.5" => 0.5; sin q => 1
+        double Quality(std::string_view parameters) {
+            while (!parameters.empty()) {
+                const auto end = parameters.find(';');
+                const auto parameter = Trim(parameters.substr(0, end));
+                if (parameter.size() > 2 && (parameter[0] == 'q' || parameter[0] == 'Q') && parameter[1] == '=') {
+                    double q = 0;
+                    const auto value = parameter.substr(2);
+                    std::from_chars(value.data(), value.data() + value.size(), q);
+                    return q;
+                }
+                if (end == std::string_view::npos) break;
+                parameters.remove_prefix(end + 1);
+            }
+            return 1.0;
+        }
+    }
+
+    bool AcceptsGzip(std::string_view acceptEncoding) {
+        bool wildcard = false;
+        while (!acceptEncoding.empty()) {
+            const auto end = acceptEncoding.find(',');
+            const auto item = acceptEncoding.substr(0, end);
+            const auto separator = item.find(';');
+            const auto coding = Trim(item.substr(0, separator));
+            const auto q = separator == std::string_view::npos ? 1.0 : Quality(item.substr(separator + 1));
+
+            // Una mención explícita de gzip manda sobre "*"
+            if (EqualsIgnoreCase(coding, "gzip")) return q > 0;
+            if (coding == "*") wildcard = q > 0;
+
+            if (end == std::string_view::npos) break;
+            acceptEncoding.remove_prefix(end + 1);
+        }
+        return wildcard;
+    }
+
+    std::string Gzip(std::string_view body, int level) {
+        z_stream stream{};
+        // 15 + 16: ventana máxima con cabecera gzip en lugar de zlib
+        if (deflateInit2(&stream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("deflateInit2 failed");
+        }
+
+        std::string out;
+        out.resize(deflateBound(&stream, static_cast<uLong>(body.size())));
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(body.data()));
+        stream.avail_in = static_cast<uInt>(body.size());
+        stream.next_out = reinterpret_cast<Bytef*>(out.data());
+        stream.avail_out = static_cast<uInt>(out.size());
+
+        const int result = deflate(&stream, Z_FINISH);
+        deflateEnd(&stream);
+        if (result != Z_STREAM_END) {
+            throw std::runtime_error("deflate failed");
+        }
+        out.resize(stream.total_out);
+        return out;
+    }
+
+    void ResponseCompressor::Apply(const crow::request& request, crow::response& response) {
+        if (!options.enabled || response.body.size() < options.minBytes) return;
+        if (!response.get_header_value("Content-Encoding").empty()) return;
+
+        // Las cachés intermedias deben distinguir ambas variantes
+        response.add_header("Vary", "Accept-Encoding");
+        if (!AcceptsGzip(request.get_header_value("Accept-Encoding"))) return;
+
+        auto compressed = Compress(response.body);
+        if (compressed.size() >= response.body.size()) return;
+
+        response.body = std::move(compressed);
+        response.set_header("Content-Encoding", "gzip");
+    }
+
+    std::string ResponseCompressor::Compress(const std::string& body) {
+        const auto hash = std::hash<std::string_view>{}(body);
+        if (options.cacheBytes > 0) {
+            std::lock_guard lock(mutex);
+            if (const auto found = index.find(hash); found != index.end() && found->second->body == body) {
+                entries.splice(entries.begin(), entries, found->second);
+                hits.fetch_add(1, std::memory_order_relaxed);
+                return found->second->compressed;
+            }
+        }
+
+        // Fuera del lock: comprimir es lo caro
+        misses.fetch_add(1, std::memory_order_relaxed);
+        auto compressed = Gzip(body, options.level);
+        if (options.cacheBytes > 0) {
+            Remember(hash, body, compressed);
+        }
+        return compressed;
+    }
+
+    void ResponseCompressor::Remember(std::size_t hash, const std::string& body, const std::string& compressed) {
+        const auto size = body.size() + compressed.size();
+        if (size > options.cacheBytes) return;
+
+        std::lock_guard lock(mutex);
+        // Otro hilo pudo haberlo guardado mientras comprimíamos, o es una
+        // colisión de hash: en ambos casos gana el más reciente.
+        if (const auto found = index.find(hash); found != index.end()) {
+            cachedBytes -= found->second->body.size() + found->second->compressed.size();
+            entries.erase(found->second);
+            index.erase(found);
+        }
+        entries.push_front(Entry{hash, body, compressed});
+        index.emplace(hash, entries.begin());
+        cachedBytes += size;
+
+        while (cachedBytes > options.cacheBytes) {
+            auto& oldest = entries.back();
+            cachedBytes -= oldest.body.size() + oldest.compressed.size();
+            index.erase(oldest.hash);
+            entries.pop_back();
+        }
+    }
+}
@@ -1,4 +1,3 @@
-#include <regex>
 #include <nlohmann/json.hpp>
 #include <crow.h>
 
@@ -7,29 +6,28 @@
 #include "delegate/IGroupDelegate.hpp"
 #include "domain/Group.hpp"
 #include "domain/Team.hpp"
+#include "dto/RequestDecoders.hpp"
+#include "serialization/ResponseSerializers.hpp"
 
 using nlohmann::json;
 
-namespace {
-    // Ajusta el patrón si tus IDs usan otro formato.
-    const std::regex ID_VALUE{R"(^[A-Za-z0-9-]+$)"};
-}
-
 GroupController::GroupController(const std::shared_ptr<IGroupDelegate>& delegate)
     : groupDelegate(delegate) {}
 
 // GET /tournaments/{tid}/groups
-crow::response GroupController::GetGroups(const std::string& tournamentId) {
-    if (!std::regex_match(tournamentId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
-    }
-
+crow::response GroupController::GetGroups(const util::Uuid& tournamentId) {
     std::vector<std::shared_ptr<domain::Group>> groups;
-    if (auto err = groupDelegate->GetGroups(tournamentId, groups)) {
+    if (auto err = groupDelegate->GetGroups(tournamentId.ToString(), groups)) {
         if (*err == "tournament_not_found") return crow::response{crow::NOT_FOUND, *err};
         return crow::response{422, *err};
     }
 
+    if (fastJson) {
+        crow::response res{crow::OK, serialization::GroupsToJson(groups)};
+        res.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+        return res;
+    }
+
     json body = json::array();
     for (auto& g : groups) body.push_back(json(*g));
 
@@ -39,44 +37,36 @@ crow::response GroupController::GetGroups(const std::string& tournamentId) {
 }
 
 // GET /tournaments/{tid}/groups/{gid}
-crow::response GroupController::GetGroup(const std::string& tournamentId, const std::string& groupId) {
-    if (!std::regex_match(tournamentId, ID_VALUE) || !std::regex_match(groupId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
-    }
-
+crow::response GroupController::GetGroup(const util::Uuid& tournamentId, const util::Uuid& groupId) {
     std::shared_ptr<domain::Group> group;
-    if (auto err = groupDelegate->GetGroup(tournamentId, groupId, group)) {
+    if (auto err = groupDelegate->GetGroup(tournamentId.ToString(), groupId.ToString(), group)) {
         if (*err == "tournament_not_found" || *err == "group_not_found") {
             return crow::response{crow::NOT_FOUND, *err};
         }
         return crow::response{422, *err};
     }
 
-    json body = *group;
-    crow::response res{crow::OK, body.dump()};
+    crow::response res{crow::OK, fastJson ? serialization::GroupToJson(*group) : json(*group).dump()};
     res.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
     return res;
 }
 
 // POST /tournaments/{tid}/groups
-crow::response GroupController::CreateGroup(const crow::request& request, const std::string& tournamentId) {
-    if (!std::regex_match(tournamentId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
-    }
-    if (!json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST};
+crow::response GroupController::CreateGroup(const crow::request& request, const util::Uuid& tournamentId) {
+    auto decoded = dto::DecodeGroup(request.body);
+    if (!decoded) {
+        return crow::response{crow::BAD_REQUEST, decoded.error().message};
     }
 
     try {
-        const auto body = json::parse(request.body);
-        domain::Group group = body; // requiere adl_serializer<domain::Group>
-        
+        domain::Group group = std::move(*decoded);
+
         // Asignar el tournamentId desde la URL, no desde el JSON
-        group.TournamentId() = tournamentId;
+        group.TournamentId() = tournamentId.ToString();
         
         std::string newGroupId;
 
-        if (auto err = groupDelegate->CreateGroup(tournamentId, group, newGroupId)) {
+        if (auto err = groupDelegate->CreateGroup(group.TournamentId(), group, newGroupId)) {
             if (*err == "duplicate_group_name" || *err == "group_limit_reached") {
                 return crow::response{crow::CONFLICT, *err};
             }
@@ -97,30 +87,20 @@ crow::response GroupController::CreateGroup(const crow::request& request, const
 
 // PATCH /tournaments/{tid}/groups/{gid}
 crow::response GroupController::UpdateGroup(const crow::request& request,
-                                            const std::string& tournamentId,
-                                            const std::string& groupId) {
-    if (!std::regex_match(tournamentId, ID_VALUE) || !std::regex_match(groupId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
-    }
-    if (!json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST};
-    }
-
-    // Parseo defensivo: sólo extrae lo que necesitas.
-    json body = json::parse(request.body);
-    if (!body.is_object()) {
-        return crow::response{crow::BAD_REQUEST};
+                                            const util::Uuid& tournamentId,
+                                            const util::Uuid& groupId) {
+    auto decoded = dto::DecodeGroup(request.body);
+    if (!decoded) {
+        return crow::response{crow::BAD_REQUEST, decoded.error().message};
     }
 
+    // Sólo el nombre viene del cuerpo; los ids salen de la URL
     domain::Group group{};
-    group.Id() = groupId;
-    group.TournamentId() = tournamentId;
-
-    if (auto it = body.find("name"); it != body.end() && it->is_string()) {
-        group.Name() = it->get<std::string>();
-    }
+    group.Id() = groupId.ToString();
+    group.TournamentId() = tournamentId.ToString();
+    group.Name() = std::move(decoded->Name());
 
-    if (auto err = groupDelegate->UpdateGroup(tournamentId, group)) {
+    if (auto err = groupDelegate->UpdateGroup(group.TournamentId(), group)) {
         if (*err == "group_not_found" || *err == "tournament_not_found") {
             return crow::response{crow::NOT_FOUND, *err};
         }
@@ -132,17 +112,15 @@ crow::response GroupController::UpdateGroup(const crow::request& request,
 
 // PATCH /tournaments/{tid}/groups/{gid}/teams (reemplazo/actualización por lote)
 crow::response GroupController::UpdateTeams(const crow::request& request,
-                                            const std::string& tournamentId,
-                                            const std::string& groupId) {
-    if (!std::regex_match(tournamentId, ID_VALUE) || !std::regex_match(groupId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
-    }
-    if (!json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST};
+                                            const util::Uuid& tournamentId,
+                                            const util::Uuid& groupId) {
+    auto decoded = dto::DecodeTeams(request.body);
+    if (!decoded) {
+        return crow::response{crow::BAD_REQUEST, decoded.error().message};
     }
 
-    const std::vector<domain::Team> teams = json::parse(request.body);
-    if (auto err = groupDelegate->UpdateTeams(tournamentId, groupId, teams)) {
+    const std::vector<domain::Team>& teams = *decoded;
+    if (auto err = groupDelegate->UpdateTeams(tournamentId.ToString(), groupId.ToString(), teams)) {
         if (*err == "tournament_not_found" || *err == "group_not_found") {
             return crow::response{crow::NOT_FOUND, *err};
         }
@@ -157,19 +135,19 @@ crow::response GroupController::UpdateTeams(const crow::request& request,
 
 // POST /tournaments/{tid}/groups/{gid} (agregar un equipo individual)
 crow::response GroupController::AddTeam(const crow::request& request,
-                                        const std::string& tournamentId,
-                                        const std::string& groupId) {
-    if (!std::regex_match(tournamentId, ID_VALUE) || !std::regex_match(groupId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+                                        const util::Uuid& tournamentId,
+                                        const util::Uuid& groupId) {
+    auto decoded = dto::DecodeTeam(request.body);
+    if (!decoded) {
+        return crow::response{crow::BAD_REQUEST, decoded.error().message};
     }
-    if (!json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST};
+    if (decoded->Name.empty()) {
+        return crow::response{crow::BAD_REQUEST, "name: required"};
     }
 
-    const domain::Team team = json::parse(request.body);
-    const std::vector<domain::Team> teams{team};
+    const std::vector<domain::Team> teams{std::move(*decoded)};
 
-    if (auto err = groupDelegate->UpdateTeams(tournamentId, groupId, teams)) {
+    if (auto err = groupDelegate->UpdateTeams(tournamentId.ToString(), groupId.ToString(), teams)) {
         if (*err == "tournament_not_found" || *err == "group_not_found") {
             return crow::response{crow::NOT_FOUND, *err};
         }
@@ -1,6 +1,59 @@
 #include "controller/MatchController.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <unordered_set>
+
+#include "dto/RequestDecoders.hpp"
+#include "serialization/ResponseSerializers.hpp"
+
+namespace {
+    std::string CanonicalId(std::string id) {
+        std::ranges::transform(id, id.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return id;
+    }
+
+    // Un id repetido en el lote se aplica una sola vez (gana el último): se
+    // cuentan partidos, no entradas
+    std::size_t CountUpdated(const std::vector<ScoreUpdate>& updates, const std::vector<std::string>& notFound) {
+        std::unordered_set<std::string> updated;
+        for (const auto& update : updates) updated.insert(CanonicalId(update.matchId));
+        for (const auto& id : notFound) updated.erase(CanonicalId(id));
+        return updated.size();
+    }
+
+    std::string ETag(int version) {
+        return "\"" + std::to_string(version) + "\"";
+    }
+
+    // If-Match: "7" (o 7 sin comillas). Ausente o "*" => sin control de versión.
+    // false si no es una versión nuestra: no puede coincidir => 412.
+    bool ParseIfMatch(std::string_view header, std::optional<int>& version) {
+        if (header.empty() || header == "*") {
+            version.reset();
+            return true;
+        }
+        if (header.size() >= 2 && header.front() == '"' && header.back() == '"') {
+            header = header.substr(1, header.size() - 2);
+        }
+        int parsed = 0;
+        const auto [end, ec] = std::from_chars(header.data(), header.data() + header.size(), parsed);
+        if (ec != std::errc{} || end != header.data() + header.size()) {
+            return false;
+        }
+        version = parsed;
+        return true;
+    }
+
+    crow::response PreconditionFailed() {
+        crow::response response(412);  // Precondition Failed
+        response.set_header("content-type", "application/json");
+        response.body = R"({"error": "Match was modified by another request"})";
+        return response;
+    }
+}
 
 MatchController::MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate)
     : matchDelegate(matchDelegate) {
@@ -30,14 +83,18 @@ crow::response MatchController::GetMatches(const crow::request& request,
         return crow::response(crow::INTERNAL_SERVER_ERROR);
     }
     
+    crow::response response(crow::OK);
+    response.set_header("content-type", "application/json");
+    if (fastJson) {
+        response.body = serialization::MatchesToJson(matches);
+        return response;
+    }
+
     // Convert to JSON array
     nlohmann::json jsonArray = nlohmann::json::array();
     for (const auto& match : matches) {
         jsonArray.push_back(match.ToJson());
     }
-    
-    crow::response response(crow::OK);
-    response.set_header("content-type", "application/json");
     response.body = jsonArray.dump();
     return response;
 }
@@ -56,40 +113,50 @@ crow::response MatchController::GetMatch(const std::string& tournamentId,
     
     crow::response response(crow::OK);
     response.set_header("content-type", "application/json");
-    response.body = match.ToJson().dump();
+    response.set_header("etag", ETag(match.version));
+    response.body = fastJson ? serialization::MatchToJson(match) : match.ToJson().dump();
     return response;
 }
 
 crow::response MatchController::UpdateMatchScore(const crow::request& request,
                                                 const std::string& tournamentId,
                                                 const std::string& matchId) const {
-    // Parse request body
-    try {
-        auto json = nlohmann::json::parse(request.body);
-        
-        if (!json.contains("score") || !json["score"].is_object()) {
-            crow::response response(422);  // Unprocessable Entity
-            response.set_header("content-type", "application/json");
-            response.body = R"({"error": "Missing or invalid score object"})";
-            return response;
+    // Decodifica el cuerpo en un solo recorrido
+    auto decoded = dto::DecodeScoreUpdate(request.body);
+    if (!decoded) {
+        const auto& decodeError = decoded.error();
+        std::string message = decodeError.message;
+        if (decodeError.field == "score") {
+            message = "Missing or invalid score object";
+        } else if (decodeError.kind == dto::DecodeError::Kind::MissingField) {
+            message = "Missing home or visitor score";
+        } else if (decodeError.kind == dto::DecodeError::Kind::Syntax) {
+            message = "Invalid JSON";
         }
-        
-        auto scoreObj = json["score"];
-        if (!scoreObj.contains("home") || !scoreObj.contains("visitor")) {
-            crow::response response(422);  // Unprocessable Entity
-            response.set_header("content-type", "application/json");
-            response.body = R"({"error": "Missing home or visitor score"})";
-            return response;
-        }
-        
-        int homeScore = scoreObj["home"].get<int>();
-        int awayScore = scoreObj["visitor"].get<int>();
-        
-        auto error = matchDelegate->UpdateScore(tournamentId, matchId, homeScore, awayScore);
+        crow::response response(422);  // Unprocessable Entity
+        response.set_header("content-type", "application/json");
+        response.body = nlohmann::json{{"error", message}}.dump();
+        return response;
+    }
+
+    std::optional<int> expectedVersion;
+    if (!ParseIfMatch(request.get_header_value("if-match"), expectedVersion)) {
+        return PreconditionFailed();
+    }
+
+    try {
+        const int homeScore = decoded->home;
+        const int awayScore = decoded->visitor;
+
+        int version = 0;
+        auto error = matchDelegate->UpdateScore(tournamentId, matchId, homeScore, awayScore,
+                                                expectedVersion, version);
         
         if (error.has_value()) {
             if (*error == "match_not_found") {
                 return crow::response(crow::NOT_FOUND);
+            } else if (*error == "version_conflict") {
+                return PreconditionFailed();
             } else if (*error == "invalid_score") {
                 crow::response response(422);  // Unprocessable Entity
                 response.set_header("content-type", "application/json");
@@ -104,16 +171,57 @@ crow::response MatchController::UpdateMatchScore(const crow::request& request,
             return crow::response(crow::INTERNAL_SERVER_ERROR);
         }
         
-        return crow::response(crow::NO_CONTENT);
+        crow::response response(crow::NO_CONTENT);
+        response.set_header("etag", ETag(version));
+        return response;
         
-    } catch (const nlohmann::json::exception& e) {
+    } catch (const std::exception& e) {
+        return crow::response(crow::INTERNAL_SERVER_ERROR);
+    }
+}
+
+crow::response MatchController::UpdateMatchScores(const crow::request& request,
+                                                 const std::string& tournamentId) const {
+    auto decoded = dto::DecodeScoreBatch(request.body);
+    if (!decoded) {
         crow::response response(422);  // Unprocessable Entity
         response.set_header("content-type", "application/json");
-        response.body = nlohmann::json{{"error", "Invalid JSON"}}.dump();
+        response.body = nlohmann::json{{"error", decoded.error().message}}.dump();
         return response;
-    } catch (const std::exception& e) {
+    }
+    if (decoded->size() > MaxScoreBatch) {
+        crow::response response(413);  // Payload Too Large
+        response.set_header("content-type", "application/json");
+        response.body = nlohmann::json{{"error", "At most " + std::to_string(MaxScoreBatch) + " updates per batch"}}.dump();
+        return response;
+    }
+
+    std::vector<std::string> notFound;
+    auto error = matchDelegate->UpdateScores(tournamentId, *decoded, notFound);
+    if (error.has_value()) {
+        if (*error == "tournament_not_found") {
+            return crow::response(crow::NOT_FOUND);
+        } else if (*error == "invalid_score") {
+            crow::response response(422);  // Unprocessable Entity
+            response.set_header("content-type", "application/json");
+            response.body = R"({"error": "Invalid score: scores must be non-negative"})";
+            return response;
+        } else if (*error == "database_error") {
+            crow::response response(crow::INTERNAL_SERVER_ERROR);
+            response.set_header("content-type", "application/json");
+            response.body = R"({"error": "Database error"})";
+            return response;
+        }
         return crow::response(crow::INTERNAL_SERVER_ERROR);
     }
+
+    crow::response response(crow::OK);
+    response.set_header("content-type", "application/json");
+    response.body = nlohmann::json{
+        {"updated", CountUpdated(*decoded, notFound)},
+        {"notFound", notFound}
+    }.dump();
+    return response;
 }
 
 // Register routes
@@ -122,5 +230,6 @@ crow::response MatchController::UpdateMatchScore(const crow::request& request,
 REGISTER_ROUTE(MatchController, GetMatches, "/tournaments/<string>/matches", "GET"_method)
 REGISTER_ROUTE(MatchController, GetMatch, "/tournaments/<string>/matches/<string>", "GET"_method)
 REGISTER_ROUTE(MatchController, UpdateMatchScore, "/tournaments/<string>/matches/<string>", "PATCH"_method)
+REGISTER_ROUTE(MatchController, UpdateMatchScores, "/tournaments/<string>/matches:batchScore", "POST"_method)
 
 
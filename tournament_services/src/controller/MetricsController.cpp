@@ -0,0 +1,14 @@
+#include "controller/MetricsController.hpp"
+
+#include "configuration/RouteDefinition.hpp"
+
+MetricsController::MetricsController(const std::shared_ptr<metrics::MetricsRegistry>& registry)
+    : registry(registry) {}
+
+crow::response MetricsController::Scrape() const {
+    crow::response res{crow::OK, registry->Render()};
+    res.add_header("content-type", "text/plain; version=0.0.4");
+    return res;
+}
+
+REGISTER_ROUTE(MetricsController, Scrape, "/metrics", "GET"_method)
@@ -2,12 +2,16 @@
 
 #include "controller/TeamController.hpp"
 
+#include <algorithm>
 #include <optional>
 #include <pqxx/except>   // pqxx::unique_violation
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "domain/Team.hpp"
+#include "dto/RequestDecoders.hpp"
+#include "serialization/ResponseSerializers.hpp"
 #include "configuration/RouteDefinition.hpp"
 
 
@@ -15,24 +19,24 @@ TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegat
     : teamDelegate(teamDelegate) {}
 
 // GET /teams/<id>
-crow::response TeamController::getTeam(const std::string& teamId) const {
-    if (!std::regex_match(teamId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST};
-    }
-
-    auto t = teamDelegate->GetTeam(teamId);
+crow::response TeamController::getTeam(const util::Uuid& teamId) const {
+    auto t = teamDelegate->GetTeam(teamId.ToString());
     if (!t) {
         return crow::response{crow::NOT_FOUND};
     }
 
+    crow::response res;
+    res.code = crow::OK;
+    res.add_header("content-type", "application/json");
+    if (fastJson) {
+        res.body = serialization::TeamToJson(*t);
+        return res;
+    }
+
     nlohmann::json body{
         {"id",   t->Id},
         {"name", t->Name}
     };
-
-    crow::response res;
-    res.code = crow::OK;
-    res.add_header("content-type", "application/json");
     res.body = body.dump();
     return res;
 }
@@ -46,6 +50,14 @@ crow::response TeamController::GetTeams(const crow::request& /*request*/) const
 crow::response TeamController::getAllTeams() const {
     const auto teams = teamDelegate->GetAllTeams();
 
+    if (fastJson) {
+        crow::response res;
+        res.code = crow::OK;
+        res.add_header("content-type", "application/json");
+        res.body = serialization::TeamsToJson(teams);
+        return res;
+    }
+
     nlohmann::json arr = nlohmann::json::array();
     for (const auto& t : teams) {
         if (!t) continue;
@@ -65,20 +77,12 @@ crow::response TeamController::getAllTeams() const {
 
 // POST /teams
 crow::response TeamController::SaveTeam(const crow::request& request) const {
-    if (!nlohmann::json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST};
-    }
-
-    const auto body = nlohmann::json::parse(request.body);
-
-    domain::Team team;
     // 'id' es opcional
-    if (body.contains("id") && body["id"].is_string()) {
-        team.Id = body["id"].get<std::string>();
-    }
-    if (body.contains("name") && body["name"].is_string()) {
-        team.Name = body["name"].get<std::string>();
+    auto decoded = dto::DecodeTeam(request.body);
+    if (!decoded) {
+        return crow::response{crow::BAD_REQUEST, decoded.error().message};
     }
+    const domain::Team& team = *decoded;
 
     try {
         std::string createdId = teamDelegate->SaveTeam(team);
@@ -102,24 +106,50 @@ crow::response TeamController::SaveTeam(const crow::request& request) const {
     }
 }
 
-// PATCH /teams/<id>
-crow::response TeamController::UpdateTeam(const crow::request& request,
-                                          const std::string& teamId) const {
-    if (!std::regex_match(teamId, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+// POST /teams:batch
+crow::response TeamController::SaveTeams(const crow::request& request) const {
+    auto decoded = dto::DecodeTeams(request.body);
+    if (!decoded) {
+        return crow::response{crow::BAD_REQUEST, decoded.error().message};
+    }
+    if (decoded->empty()) {
+        return crow::response{422, "at least one team is required"};
     }
-    if (!nlohmann::json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST};
+    if (decoded->size() > MaxTeamBatch) {
+        return crow::response{413, "at most " + std::to_string(MaxTeamBatch) + " teams per batch"};
     }
 
-    const auto body = nlohmann::json::parse(request.body);
+    try {
+        std::vector<std::string> ids;
+        auto err = teamDelegate->SaveTeams(*decoded, ids);
+        if (err.has_value()) {
+            return crow::response{422, *err};
+        }
+
+        // 201 si se crearon todos; 207 si algún elemento chocó por nombre
+        const bool allCreated = std::ranges::none_of(ids, [](const std::string& id) { return id.empty(); });
+        crow::response res;
+        res.code = allCreated && ids.size() == decoded->size() ? crow::CREATED : 207;
+        res.add_header("content-type", "application/json");
+        res.body = serialization::TeamBatchToJson(*decoded, ids);
+        return res;
+    }
+    catch (...) {
+        return crow::response{crow::INTERNAL_SERVER_ERROR};
+    }
+}
 
-    domain::Team team;
-    team.Id = teamId;
-    if (body.contains("name") && body["name"].is_string()) {
-        team.Name = body["name"].get<std::string>();
+// PATCH /teams/<id>
+crow::response TeamController::UpdateTeam(const crow::request& request,
+                                          const util::Uuid& teamId) const {
+    auto decoded = dto::DecodeTeam(request.body);
+    if (!decoded) {
+        return crow::response{crow::BAD_REQUEST, decoded.error().message};
     }
 
+    domain::Team team = std::move(*decoded);
+    team.Id = teamId.ToString();
+
     // nullopt => OK; string => mensaje de error
     auto err = teamDelegate->UpdateTeam(team);
     if (err.has_value()) {
@@ -136,4 +166,5 @@ crow::response TeamController::UpdateTeam(const crow::request& request,
 REGISTER_ROUTE(TeamController, GetTeams,   "/teams",            "GET"_method)
 REGISTER_ROUTE(TeamController, getTeam,    "/teams/<string>",   "GET"_method)
 REGISTER_ROUTE(TeamController, SaveTeam,   "/teams",            "POST"_method)
+REGISTER_ROUTE(TeamController, SaveTeams,  "/teams:batch",      "POST"_method)
 REGISTER_ROUTE(TeamController, UpdateTeam, "/teams/<string>",   "PATCH"_method)
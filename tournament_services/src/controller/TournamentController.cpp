@@ -8,16 +8,14 @@
 #include "configuration/RouteDefinition.hpp"
 #include "controller/TournamentController.hpp"
 
-#include <regex>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <algorithm>
 #include <nlohmann/json.hpp>
 #include "domain/Tournament.hpp"
-
-// Validador local para IDs simple
-static const std::regex ID_VALUE{R"(^[A-Za-z0-9-]+$)"};
+#include "dto/RequestDecoders.hpp"
+#include "serialization/ResponseSerializers.hpp"
 
 namespace {
     // Helpers para respuestas JSON coherentes con los tests
@@ -76,31 +74,16 @@ TournamentController::TournamentController(std::shared_ptr<ITournamentDelegate>
 
 // POST /tournaments
 crow::response TournamentController::CreateTournament(const crow::request &request) const {
-    // Validamos JSON para devolver 400 si está roto.
-    if (!nlohmann::json::accept(request.body)) {
-        return error_json(crow::BAD_REQUEST, "invalid_json");
+    // Un solo recorrido del cuerpo; 400 si está roto o con tipos incorrectos.
+    auto decoded = dto::DecodeTournamentCreate(request.body);
+    if (!decoded) {
+        const auto& error = decoded.error();
+        return error_json(crow::BAD_REQUEST,
+                          error.kind == dto::DecodeError::Kind::Syntax ? "invalid_json" : error.message);
     }
 
     try {
-        auto body = nlohmann::json::parse(request.body);
-        
-        // Parse tournament data from JSON
-        std::string name;
-        int groupsCount = 1;
-        int maxTeamsPerGroup = 16;
-        
-        if (body.contains("name") && body["name"].is_string()) {
-            name = body["name"].get<std::string>();
-        }
-        if (body.contains("groupsCount") && body["groupsCount"].is_number_integer()) {
-            groupsCount = body["groupsCount"].get<int>();
-        }
-        if (body.contains("maxTeamsPerGroup") && body["maxTeamsPerGroup"].is_number_integer()) {
-            maxTeamsPerGroup = body["maxTeamsPerGroup"].get<int>();
-        }
-        
-        auto format = domain::TournamentFormat(groupsCount, maxTeamsPerGroup, domain::TournamentType::ROUND_ROBIN);
-        auto tournament = std::make_shared<domain::Tournament>(name, format);
+        auto tournament = std::make_shared<domain::Tournament>(decoded->name, decoded->format);
 
         auto res = tournamentDelegate->CreateTournament(tournament);
         if (res.has_value()) {
@@ -122,6 +105,14 @@ crow::response TournamentController::CreateTournament(const crow::request &reque
 crow::response TournamentController::ReadAll() const {
     const auto all = tournamentDelegate->ReadAll();
 
+    if (fastJson) {
+        crow::response r;
+        r.code = crow::OK;
+        r.body = serialization::TournamentsToJson(all);
+        r.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+        return r;
+    }
+
     nlohmann::json arr = nlohmann::json::array();
     for (const auto& t : all) {
         arr.push_back({
@@ -138,31 +129,27 @@ crow::response TournamentController::ReadAll() const {
 }
 
 // GET /tournaments/<id>
-crow::response TournamentController::GetById(const crow::request&, const std::string& id) const {
-    if (!std::regex_match(id, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST};
-    }
-
-    auto t = tournamentDelegate->ReadById(id);
+crow::response TournamentController::GetById(const crow::request&, const util::Uuid& id) const {
+    auto t = tournamentDelegate->ReadById(id.ToString());
     if (!t) return crow::response{crow::NOT_FOUND};
 
-    nlohmann::json j{
-        {"id",   t->Id()},
-        {"name", t->Name()}
-    };
-
     crow::response r;
     r.code = crow::OK;
-    r.body = j.dump();
+    if (fastJson) {
+        r.body = serialization::TournamentToJson(*t);
+    } else {
+        nlohmann::json j{
+            {"id",   t->Id()},
+            {"name", t->Name()}
+        };
+        r.body = j.dump();
+    }
     r.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
     return r;
 }
 
 // PATCH /tournaments/<id>
-crow::response TournamentController::UpdateTournament(const crow::request &request, const std::string& id) const {
-    if (!std::regex_match(id, ID_VALUE)) {
-        return crow::response{crow::BAD_REQUEST};
-    }
+crow::response TournamentController::UpdateTournament(const crow::request &request, const util::Uuid& id) const {
     if (!nlohmann::json::accept(request.body)) {
         return error_json(crow::BAD_REQUEST, "invalid_json");
     }
@@ -170,7 +157,7 @@ crow::response TournamentController::UpdateTournament(const crow::request &reque
     // Igual que en Create: no hidratar desde JSON para evitar type_error.302
     auto t = std::make_shared<domain::Tournament>();
 
-    auto res = tournamentDelegate->UpdateTournament(id, t);
+    auto res = tournamentDelegate->UpdateTournament(id.ToString(), t);
     if (res.has_value()) {
         return crow::response{crow::NO_CONTENT};
     }
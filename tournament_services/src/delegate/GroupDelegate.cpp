@@ -1,5 +1,6 @@
 #include "delegate/GroupDelegate.hpp"
 #include <nlohmann/json.hpp>
+#include "messaging/DomainEvents.hpp"
 #include "messaging/Topics.hpp"
 
 using std::string;
@@ -59,20 +60,12 @@ GroupDelegate::CreateGroup(std::string_view tournamentId, const domain::Group& g
     }
 
     // Evento: grupo creado
-    publish_if(eventBus, topics::GroupCreated, json{
-        {"tournamentId", std::string(tournamentId)},
-        {"groupId", outGroupId},
-        {"name", group.Name()}
-    });
+    publish_if(eventBus, topics::GroupCreated, payloads::GroupCreated(tournamentId, outGroupId, group.Name()));
 
     // Si vienen equipos en el create, agrégalos y publica evento por cada uno
     for (const auto& t : group.Teams()) {
         groupRepo->UpdateGroupAddTeam(outGroupId, std::make_shared<domain::Team>(t));
-        publish_if(eventBus, topics::GroupTeamAdded, json{
-            {"tournamentId", std::string(tournamentId)},
-            {"groupId", outGroupId},
-            {"team", {{"id", t.Id}, {"name", t.Name}}}
-        });
+        publish_if(eventBus, topics::GroupTeamAdded, payloads::GroupTeamAdded(tournamentId, outGroupId, t));
     }
 
     return std::nullopt;
@@ -120,33 +113,22 @@ GroupDelegate::UpdateTeams(std::string_view tournamentId,
     }
     if (!g) return std::make_optional<std::string>("group_not_found");
 
-    // Validar límite contra conteo actual + nuevos
-    if (fmt.MaxTeamsPerGroup() > 0) {
-        int current = 0;
-        if (groupRepo) {
-            current = groupRepo->CountTeamsInGroup(groupId);
-        }
-        if (current + static_cast<int>(teams.size()) > fmt.MaxTeamsPerGroup()) {
-            return std::make_optional<std::string>("group_full");
-        }
+    // Existencia, cupo e inserción en una sola sentencia del repositorio:
+    // el límite se respeta aunque lleguen altas concurrentes al mismo grupo.
+    std::vector<std::string> teamIds;
+    teamIds.reserve(teams.size());
+    for (const auto& t : teams) {
+        teamIds.push_back(t.Id);
     }
 
-    // Validar que cada team existe cuando tenemos teamRepo
-    for (const auto& t : teams) {
-        if (teamRepo) {
-            auto tr = teamRepo->ReadById(t.Id);
-            if (!tr) return std::make_optional<std::string>("team_not_found");
-        }
+    std::vector<domain::Team> added;
+    if (auto e = groupRepo->AddTeams(groupId, teamIds, fmt.MaxTeamsPerGroup(), added); e.has_value()) {
+        return e; // group_full / team_not_found
     }
 
-    // Persistir y publicar evento por cada team agregado
-    for (const auto& t : teams) {
-        groupRepo->UpdateGroupAddTeam(groupId, std::make_shared<domain::Team>(t));
-        publish_if(eventBus, topics::GroupTeamAdded, json{
-            {"tournamentId", std::string(tournamentId)},
-            {"groupId", std::string(groupId)},
-            {"team", {{"id", t.Id}, {"name", t.Name}}}
-        });
+    // Un solo evento por lote (los que ya estaban en el grupo no se repiten)
+    if (!added.empty()) {
+        publish_if(eventBus, topics::GroupTeamsAdded, payloads::GroupTeamsAdded(tournamentId, groupId, added));
     }
 
     return std::nullopt;
@@ -2,10 +2,15 @@
 #include "domain/Match.hpp"
 #include "domain/Team.hpp"
 #include "domain/Tournament.hpp"
+#include "messaging/DomainEvents.hpp"
+#include "messaging/Topics.hpp"
+#include <algorithm>
+#include <cctype>
+#include <unordered_set>
 #include <nlohmann/json.hpp>
 
 MatchDelegate::MatchDelegate(std::shared_ptr<IMatchRepository> matchRepo,
-                             std::shared_ptr<IRepository<domain::Team, std::string_view>> teamRepo,
+                             std::shared_ptr<ITeamRepository> teamRepo,
                              std::shared_ptr<ITournamentRepository> tournamentRepo,
                              std::shared_ptr<IEventBus> eventBus)
     : matchRepo(std::move(matchRepo)),
@@ -19,6 +24,7 @@ std::optional<MatchDTO> MatchDelegate::ConvertToDTO(const domain::Match& match)
     dto.matchId = match.Id;
     dto.tournamentId = match.TournamentId;
     dto.groupId = match.GroupId;
+    dto.version = match.Version;
     
     // Fetch team names
     auto homeTeam = teamRepo->ReadById(match.HomeTeamId);
@@ -110,40 +116,88 @@ std::optional<std::string>
 MatchDelegate::UpdateScore(std::string_view tournamentId,
                           std::string_view matchId,
                           int homeScore,
-                          int awayScore) {
+                          int awayScore,
+                          std::optional<int> expectedVersion,
+                          int& outVersion) {
     // Validate scores (non-negative)
     if (homeScore < 0 || awayScore < 0) {
         return "invalid_score";
     }
     
-    // Check if match exists
-    auto match = matchRepo->FindByTournamentIdAndMatchId(tournamentId, matchId);
-    if (!match) {
-        return "match_not_found";
-    }
-    
-    // Update score
-    bool success = matchRepo->UpdateScore(matchId, homeScore, awayScore);
-    if (!success) {
+    // Un solo UPDATE acotado al torneo que devuelve lo que necesita el evento:
+    // sin la lectura previa del partido ni una segunda transacción
+    ScoreUpdateOutcome updated;
+    try {
+        updated = matchRepo->UpdateScoreReturning(
+            tournamentId, ScoreUpdate{std::string(matchId), homeScore, awayScore, expectedVersion});
+    } catch (const std::exception& e) {
         return "database_error";
     }
     
-    // Publish event
-    if (eventBus) {
-        nlohmann::json payload = {
-            {"event", "match_score_updated"},
-            {"tournamentId", std::string(tournamentId)},
-            {"matchId", std::string(matchId)},
-            {"groupId", match->GroupId},
-            {"homeTeamId", match->HomeTeamId},
-            {"awayTeamId", match->AwayTeamId},
-            {"homeScore", homeScore},
-            {"awayScore", awayScore}
-        };
-        eventBus->Publish("match.score_updated", payload);
+    if (!updated) {
+        return updated.error() == ScoreUpdateError::VersionConflict ? "version_conflict" : "match_not_found";
+    }
+    if (!*updated) {
+        return "database_error";  // fila actualizada pero ilegible
     }
     
+    outVersion = (*updated)->Version;
+    PublishScoreUpdated(tournamentId, matchId, **updated, homeScore, awayScore);
+    
     return std::nullopt;  // Success
 }
 
+std::optional<std::string>
+MatchDelegate::UpdateScores(std::string_view tournamentId,
+                            const std::vector<ScoreUpdate>& updates,
+                            std::vector<std::string>& outNotFound) {
+    // Todo o nada: un marcador inválido rechaza el lote completo
+    for (const auto& update : updates) {
+        if (update.homeScore < 0 || update.awayScore < 0) {
+            return "invalid_score";
+        }
+    }
+
+    auto tournament = tournamentRepo->ReadById(std::string(tournamentId));
+    if (!tournament) {
+        return "tournament_not_found";
+    }
+
+    // Un solo UPDATE ... FROM (VALUES ...) con RETURNING: no hace falta leer
+    // cada partido antes de actualizarlo ni después para publicar el evento.
+    std::vector<std::shared_ptr<domain::Match>> updated;
+    try {
+        updated = matchRepo->UpdateScores(tournamentId, updates);
+    } catch (const std::exception& e) {
+        return "database_error";
+    }
+
+    auto canonical = [](std::string id) {
+        std::ranges::transform(id, id.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return id;
+    };
+
+    std::unordered_set<std::string> found;
+    found.reserve(updated.size());
+    for (const auto& match : updated) {
+        found.insert(canonical(match->Id));
+        PublishScoreUpdated(tournamentId, match->Id, *match, match->HomeScore.value_or(0), match->AwayScore.value_or(0));
+    }
+
+    outNotFound.clear();
+    for (const auto& update : updates) {
+        if (!found.contains(canonical(update.matchId))) {
+            outNotFound.push_back(update.matchId);
+        }
+    }
+    return std::nullopt;  // Success
+}
 
+void MatchDelegate::PublishScoreUpdated(std::string_view tournamentId, std::string_view matchId,
+                                        const domain::Match& match, int homeScore, int awayScore) {
+    if (!eventBus) {
+        return;
+    }
+    eventBus->Publish(topics::MatchScoreUpdated,
+                      payloads::MatchScoreUpdated(tournamentId, matchId, match, homeScore, awayScore));
+}
@@ -1,7 +1,5 @@
 #include "delegate/TeamAddedConsumer.hpp"
-#include <regex>
-
-namespace { const std::regex ID_VALUE{R"(^[A-Za-z0-9-]+$)"}; }
+#include "util/Uuid.hpp"
 
 void TeamAddedConsumer::Handle(const nlohmann::json& eventJson) {
     HandleTeamAdded(TeamAddedEvent::FromJson(eventJson));
@@ -16,8 +14,8 @@ void TeamAddedConsumer::HandleTeamAdded(const std::string& tournamentId, const s
 
 void TeamAddedConsumer::HandleTeamAdded(const TeamAddedEvent& e) {
     if (e.tournamentId.empty() || e.groupId.empty()) return;
-    if (!std::regex_match(e.tournamentId, ID_VALUE) ||
-        !std::regex_match(e.groupId, ID_VALUE)) return;
+    if (!util::IsValidId(e.tournamentId) ||
+        !util::IsValidId(e.groupId)) return;
 
     const int currentCount = groupRepo->CountTeamsInGroup(e.groupId);
 
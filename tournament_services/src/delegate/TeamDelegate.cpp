@@ -5,12 +5,20 @@
 #include "delegate/TeamDelegate.hpp"
 #include <utility>
 #include <string>
-#include <string_view>
 
 std::string TeamDelegate::SaveTeam(const domain::Team& team) {
-    // Si el repo devuelve std::string_view (clave), conviértelo explícitamente a std::string (C++17).
-    auto id_sv = teamRepository->Create(team);
-    return std::string{id_sv};
+    return teamRepository->Create(team);
+}
+
+std::optional<std::string> TeamDelegate::SaveTeams(const std::vector<domain::Team>& teams,
+                                                   std::vector<std::string>& outIds) {
+    // Todo o nada en la validación: un nombre vacío rechaza el lote completo
+    for (const auto& team : teams) {
+        if (team.Name.empty()) return std::make_optional<std::string>("invalid_team_name");
+    }
+
+    outIds = teamRepository->CreateMany(teams);
+    return std::nullopt;
 }
 
 std::optional<std::string> TeamDelegate::UpdateTeam(const domain::Team& team) const {
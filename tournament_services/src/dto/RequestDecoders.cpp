@@ -0,0 +1,429 @@
+#include "dto/RequestDecoders.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "domain/Utilities.hpp"
+
+namespace dto {
+namespace {
+    using json = nlohmann::json;
+
+    // Base SAX que mantiene la ruta del valor actual ("score.home", "teams[].id")
+    // y reparte los eventos a los decodificadores concretos.
+    class PathSax : public nlohmann::json_sax<json> {
+    public:
+        enum class Root { Object, Array };
+
+        explicit PathSax(Root root) : root(root) {}
+
+        std::optional<DecodeError> error;
+
+        bool null() override { return Value(&PathSax::OnOther, "null"); }
+        bool boolean(bool) override { return Value(&PathSax::OnOther, "boolean"); }
+        bool number_float(number_float_t, const string_t&) override { return Value(&PathSax::OnOther, "number"); }
+
+        bool number_integer(number_integer_t value) override {
+            if (!EnterValue()) return false;
+            return OnInteger(path, value);
+        }
+
+        bool number_unsigned(number_unsigned_t value) override {
+            if (!EnterValue()) return false;
+            if (value > static_cast<number_unsigned_t>(std::numeric_limits<std::int64_t>::max())) {
+                return OnOther(path, "number");
+            }
+            return OnInteger(path, static_cast<std::int64_t>(value));
+        }
+
+        bool string(string_t& value) override {
+            if (!EnterValue()) return false;
+            return OnString(path, value);
+        }
+
+        bool binary(binary_t&) override { return Value(&PathSax::OnOther, "binary"); }
+
+        bool start_object(std::size_t) override {
+            if (!EnterContainer(Root::Object)) return false;
+            containers.push_back({true, path.size()});
+            return OnStartObject(path);
+        }
+
+        bool end_object() override {
+            path.resize(containers.back().mark);
+            containers.pop_back();
+            return OnEndObject(path);
+        }
+
+        bool start_array(std::size_t) override {
+            if (!EnterContainer(Root::Array)) return false;
+            containers.push_back({false, path.size()});
+            return OnStartArray(path);
+        }
+
+        bool end_array() override {
+            path.resize(containers.back().mark);
+            containers.pop_back();
+            return true;
+        }
+
+        bool key(string_t& name) override {
+            path.resize(containers.back().mark);
+            if (!path.empty()) path += '.';
+            path += name;
+            return true;
+        }
+
+        bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override {
+            if (!error) {
+                error = DecodeError{DecodeError::Kind::Syntax, path, position, ex.what()};
+            }
+            return false;
+        }
+
+    protected:
+        virtual bool OnString(const std::string&, std::string&) { return true; }
+        virtual bool OnInteger(const std::string& field, std::int64_t) { return OnOther(field, "number"); }
+        virtual bool OnOther(const std::string&, std::string_view) { return true; }
+        virtual bool OnStartObject(const std::string& field) { return OnOther(field, "object"); }
+        virtual bool OnEndObject(const std::string&) { return true; }
+        virtual bool OnStartArray(const std::string& field) { return OnOther(field, "array"); }
+
+        bool Fail(DecodeError::Kind kind, const std::string& field, std::string message) {
+            error = DecodeError{kind, field, 0, std::move(message)};
+            return false;
+        }
+
+        bool TypeError(const std::string& field, std::string_view expected) {
+            return Fail(DecodeError::Kind::InvalidType, field,
+                        (field.empty() ? std::string("body") : field) + ": expected " + std::string(expected));
+        }
+
+        static bool ToInt(std::int64_t value, int& out) {
+            if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max()) return false;
+            out = static_cast<int>(value);
+            return true;
+        }
+
+    private:
+        struct Container {
+            bool isObject;
+            std::size_t mark; // largo de la ruta del contenedor
+        };
+
+        Root root;
+        std::string path;
+        std::vector<Container> containers;
+
+        // Deja en `path` la ruta del valor que está por llegar
+        bool EnterValue() {
+            if (containers.empty()) {
+                return TypeError("", root == Root::Object ? "object" : "array");
+            }
+            if (!containers.back().isObject) {
+                path.resize(containers.back().mark);
+                path += "[]";
+            }
+            return true;
+        }
+
+        bool EnterContainer(Root kind) {
+            if (containers.empty()) {
+                return kind == root || TypeError("", root == Root::Object ? "object" : "array");
+            }
+            return EnterValue();
+        }
+
+        bool Value(bool (PathSax::*handler)(const std::string&, std::string_view), std::string_view kind) {
+            if (!EnterValue()) return false;
+            return (this->*handler)(path, kind);
+        }
+    };
+
+    // `field` ya sin prefijo ("teams[].name" -> "name")
+    void AssignTeamField(std::string_view field, std::string& value, domain::Team& team) {
+        if (field == "id") team.Id = std::move(value);
+        else if (field == "name") team.Name = std::move(value);
+    }
+
+    bool IsTeamField(std::string_view field) {
+        return field == "id" || field == "name";
+    }
+
+    class TeamSax final : public PathSax {
+    public:
+        domain::Team team;
+        TeamSax() : PathSax(Root::Object) {}
+
+    protected:
+        bool OnString(const std::string& field, std::string& value) override {
+            AssignTeamField(field, value, team);
+            return true;
+        }
+        bool OnOther(const std::string& field, std::string_view) override {
+            return !IsTeamField(field) || TypeError(field, "string");
+        }
+    };
+
+    class TeamListSax final : public PathSax {
+    public:
+        std::vector<domain::Team> teams;
+        TeamListSax() : PathSax(Root::Array) {}
+
+    protected:
+        bool OnStartObject(const std::string& field) override {
+            if (field != "[]") return OnOther(field, "object");
+            teams.emplace_back();
+            return true;
+        }
+        bool OnString(const std::string& field, std::string& value) override {
+            if (field.starts_with("[].") && !teams.empty()) {
+                AssignTeamField(std::string_view(field).substr(3), value, teams.back());
+                return true;
+            }
+            return OnOther(field, "string");
+        }
+        bool OnOther(const std::string& field, std::string_view) override {
+            if (field == "[]") return TypeError(field, "object");
+            if (field.starts_with("[].") && IsTeamField(std::string_view(field).substr(3))) {
+                return TypeError(field, "string");
+            }
+            return true;
+        }
+        bool OnStartArray(const std::string& field) override {
+            return field.empty() || OnOther(field, "array");
+        }
+    };
+
+    class GroupSax final : public PathSax {
+    public:
+        domain::Group group;
+        GroupSax() : PathSax(Root::Object) {}
+
+    protected:
+        bool OnStartObject(const std::string& field) override {
+            if (field != "teams[]") return OnOther(field, "object");
+            group.Teams().emplace_back();
+            return true;
+        }
+        bool OnStartArray(const std::string& field) override {
+            if (field != "teams") return OnOther(field, "array");
+            group.Teams().clear();
+            return true;
+        }
+        bool OnString(const std::string& field, std::string& value) override {
+            if (field == "id") group.Id() = std::move(value);
+            else if (field == "name") group.Name() = std::move(value);
+            else if (field == "tournamentId") group.TournamentId() = std::move(value);
+            else if (field.starts_with("teams[].") && !group.Teams().empty()) {
+                AssignTeamField(std::string_view(field).substr(8), value, group.Teams().back());
+            }
+            else return OnOther(field, "string");
+            return true;
+        }
+        bool OnOther(const std::string& field, std::string_view) override {
+            if (field == "id" || field == "name" || field == "tournamentId") return TypeError(field, "string");
+            if (field == "teams") return TypeError(field, "array");
+            if (field == "teams[]") return TypeError(field, "object");
+            if (field.starts_with("teams[].") && IsTeamField(std::string_view(field).substr(8))) {
+                return TypeError(field, "string");
+            }
+            return true;
+        }
+    };
+
+    class TournamentCreateSax final : public PathSax {
+    public:
+        TournamentCreateRequest request;
+        TournamentCreateSax() : PathSax(Root::Object) {}
+
+    protected:
+        bool OnString(const std::string& field, std::string& value) override {
+            if (field == "name") {
+                request.name = std::move(value);
+                return true;
+            }
+            if (field == "format.type") {
+                if (value != "ROUND_ROBIN" && value != "NFL") return TypeError(field, "ROUND_ROBIN or NFL");
+                request.format.Type() = domain::fromString(value);
+                return true;
+            }
+            return OnOther(field, "string");
+        }
+        bool OnInteger(const std::string& field, std::int64_t value) override {
+            int* target = nullptr;
+            if (field == "format.numberOfGroups" || field == "groupsCount") target = &request.format.NumberOfGroups();
+            else if (field == "format.maxTeamsPerGroup" || field == "maxTeamsPerGroup") target = &request.format.MaxTeamsPerGroup();
+            else return OnOther(field, "number");
+
+            return ToInt(value, *target) || TypeError(field, "integer");
+        }
+        bool OnOther(const std::string& field, std::string_view) override {
+            if (field == "name" || field == "format.type") return TypeError(field, "string");
+            return !IsIntegerField(field) || TypeError(field, "integer");
+        }
+
+    private:
+        static bool IsIntegerField(std::string_view field) {
+            return field == "format.numberOfGroups" || field == "format.maxTeamsPerGroup" ||
+                   field == "groupsCount" || field == "maxTeamsPerGroup";
+        }
+    };
+
+    class ScoreUpdateSax final : public PathSax {
+    public:
+        ScoreUpdateRequest request;
+        bool hasScore = false;
+        bool hasHome = false;
+        bool hasVisitor = false;
+        ScoreUpdateSax() : PathSax(Root::Object) {}
+
+    protected:
+        bool OnStartObject(const std::string& field) override {
+            if (field != "score") return OnOther(field, "object");
+            hasScore = true;
+            return true;
+        }
+        bool OnString(const std::string& field, std::string&) override {
+            return OnOther(field, "string");
+        }
+        bool OnInteger(const std::string& field, std::int64_t value) override {
+            if (field == "score.home") {
+                hasHome = true;
+                return ToInt(value, request.home) || TypeError(field, "integer");
+            }
+            if (field == "score.visitor") {
+                hasVisitor = true;
+                return ToInt(value, request.visitor) || TypeError(field, "integer");
+            }
+            return OnOther(field, "number");
+        }
+        bool OnOther(const std::string& field, std::string_view) override {
+            if (field == "score") return TypeError(field, "object");
+            if (field == "score.home" || field == "score.visitor") return TypeError(field, "integer");
+            return true;
+        }
+    };
+
+    class ScoreBatchSax final : public PathSax {
+    public:
+        std::vector<ScoreUpdate> updates;
+        ScoreBatchSax() : PathSax(Root::Array) {}
+
+    protected:
+        bool OnStartArray(const std::string& field) override {
+            return field.empty() || OnOther(field, "array");
+        }
+        bool OnStartObject(const std::string& field) override {
+            if (field == "[]") {
+                updates.emplace_back();
+                hasMatchId = hasScore = hasHome = hasVisitor = false;
+                return true;
+            }
+            if (field == "[].score") {
+                hasScore = true;
+                return true;
+            }
+            return OnOther(field, "object");
+        }
+        bool OnEndObject(const std::string& field) override {
+            if (field != "[]") return true;
+            const char* missing = !hasMatchId ? "[].matchId"
+                                : !hasScore ? "[].score"
+                                : !hasHome ? "[].score.home"
+                                : !hasVisitor ? "[].score.visitor"
+                                : nullptr;
+            if (!missing) return true;
+            return Fail(DecodeError::Kind::MissingField, missing,
+                        std::string(missing) + ": required (item " + std::to_string(updates.size() - 1) + ")");
+        }
+        bool OnString(const std::string& field, std::string& value) override {
+            if (field != "[].matchId") return OnOther(field, "string");
+            updates.back().matchId = std::move(value);
+            hasMatchId = true;
+            return true;
+        }
+        bool OnInteger(const std::string& field, std::int64_t value) override {
+            if (field == "[].score.home") {
+                hasHome = true;
+                return ToInt(value, updates.back().homeScore) || TypeError(field, "integer");
+            }
+            if (field == "[].score.visitor") {
+                hasVisitor = true;
+                return ToInt(value, updates.back().awayScore) || TypeError(field, "integer");
+            }
+            return OnOther(field, "number");
+        }
+        bool OnOther(const std::string& field, std::string_view) override {
+            if (field == "[]" || field == "[].score") return TypeError(field, "object");
+            if (field == "[].matchId") return TypeError(field, "string");
+            if (field == "[].score.home" || field == "[].score.visitor") return TypeError(field, "integer");
+            return true;
+        }
+
+    private:
+        bool hasMatchId = false;
+        bool hasScore = false;
+        bool hasHome = false;
+        bool hasVisitor = false;
+    };
+
+    template<typename Sax>
+    std::optional<DecodeError> Run(std::string_view body, Sax& sax) {
+        if (json::sax_parse(body.begin(), body.end(), &sax)) {
+            return std::nullopt;
+        }
+        if (sax.error) {
+            return std::move(sax.error);
+        }
+        return DecodeError{DecodeError::Kind::Syntax, "", 0, "invalid json"};
+    }
+}
+
+std::expected<domain::Team, DecodeError> DecodeTeam(std::string_view body) {
+    TeamSax sax;
+    if (auto error = Run(body, sax)) return std::unexpected(std::move(*error));
+    return std::move(sax.team);
+}
+
+std::expected<std::vector<domain::Team>, DecodeError> DecodeTeams(std::string_view body) {
+    TeamListSax sax;
+    if (auto error = Run(body, sax)) return std::unexpected(std::move(*error));
+    return std::move(sax.teams);
+}
+
+std::expected<domain::Group, DecodeError> DecodeGroup(std::string_view body) {
+    GroupSax sax;
+    if (auto error = Run(body, sax)) return std::unexpected(std::move(*error));
+    return std::move(sax.group);
+}
+
+std::expected<TournamentCreateRequest, DecodeError> DecodeTournamentCreate(std::string_view body) {
+    TournamentCreateSax sax;
+    if (auto error = Run(body, sax)) return std::unexpected(std::move(*error));
+    return std::move(sax.request);
+}
+
+std::expected<ScoreUpdateRequest, DecodeError> DecodeScoreUpdate(std::string_view body) {
+    ScoreUpdateSax sax;
+    if (auto error = Run(body, sax)) return std::unexpected(std::move(*error));
+
+    if (!sax.hasScore) {
+        return std::unexpected(DecodeError{DecodeError::Kind::MissingField, "score", 0, "score: required"});
+    }
+    if (!sax.hasHome || !sax.hasVisitor) {
+        const std::string field = sax.hasHome ? "score.visitor" : "score.home";
+        return std::unexpected(DecodeError{DecodeError::Kind::MissingField, field, 0, field + ": required"});
+    }
+    return sax.request;
+}
+
+std::expected<std::vector<ScoreUpdate>, DecodeError> DecodeScoreBatch(std::string_view body) {
+    ScoreBatchSax sax;
+    if (auto error = Run(body, sax)) return std::unexpected(std::move(*error));
+    return std::move(sax.updates);
+}
+}
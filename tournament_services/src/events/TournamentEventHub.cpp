@@ -0,0 +1,75 @@
+#include "events/TournamentEventHub.hpp"
+
+namespace events {
+
+    // Alta y baja toman el lock del hub y luego el del canal (mismo orden
+    // siempre); así un canal vacío se borra sin perder un alta concurrente.
+    void TournamentEventHub::Subscribe(const std::string& tournamentId, crow::websocket::connection& connection) {
+        std::lock_guard lock(mutex);
+        auto& channel = channels[tournamentId];
+        if (!channel) {
+            channel = std::make_shared<Channel>();
+            channel->tournamentId = tournamentId;
+        }
+        memberships[&connection] = channel;
+
+        std::lock_guard channelLock(channel->mutex);
+        channel->positions.emplace(&connection, channel->subscribers.size());
+        channel->subscribers.push_back(&connection);
+    }
+
+    void TournamentEventHub::Unsubscribe(crow::websocket::connection& connection) {
+        std::lock_guard lock(mutex);
+        const auto found = memberships.find(&connection);
+        if (found == memberships.end()) return;
+        const auto channel = std::move(found->second);
+        memberships.erase(found);
+
+        std::lock_guard channelLock(channel->mutex);
+        const auto position = channel->positions.find(&connection);
+        if (position != channel->positions.end()) {
+            const auto index = position->second;
+            auto* last = channel->subscribers.back();
+            channel->subscribers[index] = last;
+            channel->positions[last] = index;
+            channel->subscribers.pop_back();
+            channel->positions.erase(&connection);
+        }
+        if (channel->subscribers.empty()) {
+            channels.erase(channel->tournamentId);
+        }
+    }
+
+    std::size_t TournamentEventHub::Broadcast(std::string_view tournamentId, const std::string& frame) {
+        std::shared_ptr<Channel> channel;
+        {
+            std::lock_guard lock(mutex);
+            const auto found = channels.find(std::string(tournamentId));
+            if (found == channels.end()) return 0;
+            channel = found->second;
+        }
+
+        std::lock_guard lock(channel->mutex);
+        for (auto* subscriber : channel->subscribers) {
+            subscriber->send_text(frame);
+        }
+        return channel->subscribers.size();
+    }
+
+    std::size_t TournamentEventHub::Subscribers() const {
+        std::lock_guard lock(mutex);
+        return memberships.size();
+    }
+
+    std::size_t TournamentEventHub::Subscribers(std::string_view tournamentId) const {
+        std::shared_ptr<Channel> channel;
+        {
+            std::lock_guard lock(mutex);
+            const auto found = channels.find(std::string(tournamentId));
+            if (found == channels.end()) return 0;
+            channel = found->second;
+        }
+        std::lock_guard lock(channel->mutex);
+        return channel->subscribers.size();
+    }
+}
@@ -0,0 +1,52 @@
+// GET /tournaments/<id>/events: websocket con los eventos en vivo del torneo.
+// Crow 1.2 no permite respuestas en streaming (SSE), así que va por websocket;
+// los frames son JSON {"type": ..., "data": ...} y el cliente no envía nada.
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <crow.h>
+
+#include "configuration/RouteDefinition.hpp"
+#include "events/TournamentEventHub.hpp"
+#include "util/Uuid.hpp"
+
+namespace {
+    constexpr std::string_view Prefix = "/tournaments/";
+    constexpr std::string_view Suffix = "/events";
+
+    std::optional<std::string> TournamentIdFromUrl(std::string_view url) {
+        if (!url.starts_with(Prefix) || !url.ends_with(Suffix)) return std::nullopt;
+        url.remove_prefix(Prefix.size());
+        url.remove_suffix(Suffix.size());
+        if (!util::IsValidId(url)) return std::nullopt;
+        return std::string(url);
+    }
+
+    struct TournamentEventsRouteRegistrator {
+        TournamentEventsRouteRegistrator() {
+            routeRegistry().push_back({"/tournaments/<string>/events", crow::HTTPMethod::Get,
+                [](crow::SimpleApp& app, const std::shared_ptr<Hypodermic::Container>& container) {
+                    std::shared_ptr<events::TournamentEventHub> hub = container->resolve<events::TournamentEventHub>();
+                    CROW_WEBSOCKET_ROUTE(app, "/tournaments/<string>/events")
+                        .max_payload(1024)
+                        .onaccept([](const crow::request& request, void** userdata) {
+                            auto tournamentId = TournamentIdFromUrl(request.url);
+                            if (!tournamentId) return false;
+                            *userdata = new std::string(std::move(*tournamentId));
+                            return true;
+                        })
+                        .onopen([hub](crow::websocket::connection& connection) {
+                            hub->Subscribe(*static_cast<std::string*>(connection.userdata()), connection);
+                        })
+                        .onclose([hub](crow::websocket::connection& connection, const std::string&, uint16_t) {
+                            hub->Unsubscribe(connection);
+                            delete static_cast<std::string*>(connection.userdata());
+                            connection.userdata(nullptr);
+                        });
+                }});
+        }
+    };
+
+    TournamentEventsRouteRegistrator registrator;
+}
@@ -0,0 +1,218 @@
+#include "messaging/AsyncEventBus.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <random>
+#include <crow/logging.h>
+
+#include "metrics/PrometheusText.hpp"
+
+namespace messaging {
+    namespace {
+        template<typename T, typename Delta>
+        void Bump(std::atomic<T>& counter, Delta delta) {
+            // Un solo hilo escribe (el de envío): load + store sin lock
+            counter.store(counter.load(std::memory_order_relaxed) + static_cast<T>(delta), std::memory_order_relaxed);
+        }
+
+        std::string RandomInstanceId() {
+            std::random_device random;
+            const auto value = (static_cast<std::uint64_t>(random()) << 32) | random();
+            char text[17];
+            std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(value));
+            return text;
+        }
+    }
+
+    AsyncEventBus::AsyncEventBus(std::shared_ptr<IEventBatchSender> sender, AsyncEventBusOptions options)
+        : sender(std::move(sender)), options(options), ring(options.capacity), instanceId(RandomInstanceId()) {
+        drainer = std::thread([this] { DrainLoop(); });
+    }
+
+    AsyncEventBus::~AsyncEventBus() {
+        Stop();
+    }
+
+    void AsyncEventBus::Stop() {
+        stopping.store(true);
+        NotifySpace(); // los Publish bloqueados salen con EventBusFull
+        wakeups.fetch_add(1);
+        wakeups.notify_one();
+        if (drainer.joinable()) {
+            drainer.join();
+        }
+    }
+
+    void AsyncEventBus::Publish(std::string_view topic, const nlohmann::json& payload) {
+        auto eventId = "bus:" + instanceId + ":" + std::to_string(sequence.fetch_add(1, std::memory_order_relaxed));
+        Enqueue(PendingEvent{std::string(topic), EncodeEvent(payload, options.encoding),
+                             std::chrono::steady_clock::now(), options.encoding, std::move(eventId)});
+    }
+
+    void AsyncEventBus::Enqueue(PendingEvent event) {
+        if (stopping.load()) {
+            // Ya nadie lo enviaría
+            rejected.fetch_add(1, std::memory_order_relaxed);
+            throw EventBusFull();
+        }
+        while (!ring.TryPush(event)) {
+            switch (options.backpressure) {
+                case Backpressure::Fail:
+                    rejected.fetch_add(1, std::memory_order_relaxed);
+                    throw EventBusFull();
+                case Backpressure::DropOldest:
+                    if (ring.TryPop()) {
+                        dropped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    break;
+                case Backpressure::Block:
+                    WaitForSpace();
+                    break;
+            }
+        }
+        // Pareja del fence en DrainLoop: o el hilo de envío ve el evento antes
+        // de dormirse, o aquí se ve que está dormido y se le despierta.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Wake();
+    }
+
+    // Espera lugar en el anillo, no al broker: el hilo de envío ya está
+    // sacando (o reintentando) y avisa al sacar. Detenido, nadie va a sacar
+    // más: se rechaza en vez de esperar para siempre.
+    void AsyncEventBus::WaitForSpace() {
+        if (stopping.load()) {
+            rejected.fetch_add(1, std::memory_order_relaxed);
+            throw EventBusFull();
+        }
+        const auto seen = spaceFreed.load();
+        blocked.fetch_add(1);
+        // Pareja del fence en NotifySpace: o el hilo de envío ve que hay
+        // alguien esperando, o aquí se ve el lugar que liberó
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ring.Size() >= ring.Capacity() && !stopping.load()) {
+            Wake();
+            spaceFreed.wait(seen);
+        }
+        blocked.fetch_sub(1);
+    }
+
+    void AsyncEventBus::NotifySpace() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (blocked.load() > 0 || stopping.load()) {
+            spaceFreed.fetch_add(1);
+            spaceFreed.notify_all();
+        }
+    }
+
+    void AsyncEventBus::Wake() {
+        if (idle.load(std::memory_order_relaxed)) {
+            wakeups.fetch_add(1, std::memory_order_relaxed);
+            wakeups.notify_one();
+        }
+    }
+
+    void AsyncEventBus::DrainLoop() {
+        std::vector<PendingEvent> batch;
+        batch.reserve(options.maxBatchSize);
+
+        while (true) {
+            while (batch.size() < options.maxBatchSize) {
+                auto event = ring.TryPop();
+                if (!event) break;
+                batch.push_back(std::move(*event));
+            }
+            if (!batch.empty()) {
+                NotifySpace();
+                Send(batch);
+                batch.clear();
+                continue;
+            }
+
+            if (stopping.load()) return; // ya no queda nada pendiente
+
+            const auto seen = wakeups.load();
+            idle.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (ring.Empty() && !stopping.load()) {
+                wakeups.wait(seen);
+            }
+            idle.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void AsyncEventBus::Send(std::vector<PendingEvent>& batch) {
+        for (int attempt = 1; attempt <= options.maxSendAttempts; ++attempt) {
+            try {
+                sender->SendBatch(batch);
+
+                const auto now = std::chrono::steady_clock::now();
+                for (const auto& event : batch) {
+                    const auto micros = static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::microseconds>(now - event.enqueued).count());
+                    Bump(latencyBuckets[metrics::BucketIndex(micros)], 1);
+                    Bump(latencySumMicros, micros);
+                }
+                Bump(published, batch.size());
+                Bump(batches, 1);
+                return;
+            } catch (const std::exception& e) {
+                CROW_LOG_WARNING << "event batch of " << batch.size() << " not sent (attempt " << attempt
+                                 << "/" << options.maxSendAttempts << "): " << e.what();
+            }
+            if (attempt < options.maxSendAttempts) {
+                std::this_thread::sleep_for(options.retryBackoff * attempt);
+            }
+        }
+        Bump(failed, batch.size());
+    }
+
+    AsyncEventBusStats AsyncEventBus::Stats() const {
+        AsyncEventBusStats stats;
+        stats.published = published.load(std::memory_order_relaxed);
+        stats.dropped = dropped.load(std::memory_order_relaxed);
+        stats.rejected = rejected.load(std::memory_order_relaxed);
+        stats.failed = failed.load(std::memory_order_relaxed);
+        stats.batches = batches.load(std::memory_order_relaxed);
+        stats.queued = ring.Size();
+        stats.capacity = ring.Capacity();
+        for (std::size_t i = 0; i < metrics::kBucketCount; ++i) {
+            const auto count = latencyBuckets[i].load(std::memory_order_relaxed);
+            stats.latency.counts[i] = count;
+            stats.latency.total += count;
+        }
+        stats.latency.sumMicros = latencySumMicros.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void AsyncEventBus::RenderMetrics(std::string& out) const {
+        const auto stats = Stats();
+
+        out += "# HELP tournament_events_published_total Events confirmed by the broker.\n"
+               "# TYPE tournament_events_published_total counter\n"
+               "tournament_events_published_total ";
+        out += std::to_string(stats.published);
+        out += "\n# HELP tournament_events_lost_total Events never sent, by reason.\n"
+               "# TYPE tournament_events_lost_total counter\n"
+               "tournament_events_lost_total{reason=\"dropped\"} ";
+        out += std::to_string(stats.dropped);
+        out += "\ntournament_events_lost_total{reason=\"rejected\"} ";
+        out += std::to_string(stats.rejected);
+        out += "\ntournament_events_lost_total{reason=\"send_failed\"} ";
+        out += std::to_string(stats.failed);
+        out += "\n# HELP tournament_event_batches_total Broker transactions committed.\n"
+               "# TYPE tournament_event_batches_total counter\n"
+               "tournament_event_batches_total ";
+        out += std::to_string(stats.batches);
+        out += "\n# HELP tournament_events_queued Events waiting in the publish ring.\n"
+               "# TYPE tournament_events_queued gauge\n"
+               "tournament_events_queued ";
+        out += std::to_string(stats.queued);
+        out += "\n# HELP tournament_events_queue_capacity Size of the publish ring.\n"
+               "# TYPE tournament_events_queue_capacity gauge\n"
+               "tournament_events_queue_capacity ";
+        out += std::to_string(stats.capacity);
+        out += "\n# HELP tournament_event_publish_duration_seconds Time from Publish() to broker commit.\n"
+               "# TYPE tournament_event_publish_duration_seconds histogram\n";
+        metrics::AppendHistogram(out, "tournament_event_publish_duration_seconds", "", stats.latency);
+    }
+}
@@ -0,0 +1,104 @@
+#include "messaging/OutboxRelay.hpp"
+
+#include <exception>
+#include <vector>
+#include <crow/logging.h>
+
+namespace messaging {
+
+    OutboxRelay::OutboxRelay(std::shared_ptr<IOutboxRepository> outbox,
+                             std::shared_ptr<IEventBatchSender> sender,
+                             OutboxOptions options)
+        : outbox(std::move(outbox)), sender(std::move(sender)), options(options) {}
+
+    OutboxRelay::~OutboxRelay() {
+        Stop();
+    }
+
+    void OutboxRelay::Start() {
+        if (!options.enabled || worker.joinable()) return;
+        {
+            std::lock_guard lock(mutex);
+            stopping = false;
+        }
+        worker = std::thread([this] { Loop(); });
+    }
+
+    void OutboxRelay::Stop() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        stopSignal.notify_all();
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    std::size_t OutboxRelay::RelayOnce() {
+        const auto sent = outbox->PublishPending(options.batchSize, [this](const std::vector<OutboxRecord>& records) {
+            std::vector<PendingEvent> batch;
+            batch.reserve(records.size());
+            const auto now = std::chrono::steady_clock::now();
+            for (const auto& record : records) {
+                batch.push_back(PendingEvent{record.topic, TranscodeJsonEvent(record.payload, options.encoding),
+                                             now, options.encoding, "outbox:" + std::to_string(record.id)});
+            }
+            sender->SendBatch(batch);
+        });
+        if (sent > 0) {
+            relayed.fetch_add(sent, std::memory_order_relaxed);
+            batches.fetch_add(1, std::memory_order_relaxed);
+        }
+        return sent;
+    }
+
+    void OutboxRelay::Loop() {
+        while (true) {
+            {
+                std::lock_guard lock(mutex);
+                if (stopping) return;
+            }
+            try {
+                // Lote lleno => probablemente hay más: seguir sin esperar
+                if (RelayOnce() < options.batchSize) {
+                    Pause(options.pollInterval);
+                }
+            } catch (const std::exception& e) {
+                errors.fetch_add(1, std::memory_order_relaxed);
+                CROW_LOG_WARNING << "outbox relay: batch not published, retrying: " << e.what();
+                Pause(options.retryBackoff);
+            }
+        }
+    }
+
+    void OutboxRelay::Pause(std::chrono::milliseconds interval) {
+        std::unique_lock lock(mutex);
+        stopSignal.wait_for(lock, interval, [this] { return stopping; });
+    }
+
+    OutboxRelayStats OutboxRelay::Stats() const {
+        OutboxRelayStats stats;
+        stats.relayed = relayed.load(std::memory_order_relaxed);
+        stats.batches = batches.load(std::memory_order_relaxed);
+        stats.errors = errors.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void OutboxRelay::RenderMetrics(std::string& out) const {
+        const auto stats = Stats();
+        out += "# HELP tournament_outbox_relayed_total Outbox rows published to the broker.\n"
+               "# TYPE tournament_outbox_relayed_total counter\n"
+               "tournament_outbox_relayed_total ";
+        out += std::to_string(stats.relayed);
+        out += "\n# HELP tournament_outbox_batches_total Outbox batches committed.\n"
+               "# TYPE tournament_outbox_batches_total counter\n"
+               "tournament_outbox_batches_total ";
+        out += std::to_string(stats.batches);
+        out += "\n# HELP tournament_outbox_relay_errors_total Outbox batches that failed and were retried.\n"
+               "# TYPE tournament_outbox_relay_errors_total counter\n"
+               "tournament_outbox_relay_errors_total ";
+        out += std::to_string(stats.errors);
+        out += '\n';
+    }
+}
@@ -0,0 +1,131 @@
+#include "metrics/MetricsRegistry.hpp"
+
+namespace metrics {
+    namespace {
+        constexpr std::array<const char*, 5> kStatusClasses{"1xx", "2xx", "3xx", "4xx", "5xx"};
+
+        constexpr std::array<std::pair<const char*, double>, 4> kQuantiles{{
+            {"0.5", 0.5}, {"0.9", 0.9}, {"0.99", 0.99}, {"0.999", 0.999},
+        }};
+
+        void Labels(std::string& out, const RouteSnapshot& route) {
+            out += "{method=\"";
+            out += route.method;
+            out += "\",route=\"";
+            out += route.path;
+            out += '"';
+        }
+    }
+
+    std::vector<RouteSnapshot> MetricsRegistry::Snapshot() const {
+        std::lock_guard lock(mutex);
+        std::vector<RouteSnapshot> result(routes.size());
+        for (std::size_t id = 0; id < routes.size(); ++id) {
+            result[id].path = routes[id].first;
+            result[id].method = routes[id].second;
+        }
+
+        for (const auto& shard : shards) {
+            for (std::size_t id = 0; id < routes.size(); ++id) {
+                const auto* slot = shard->slots[id].load(std::memory_order_acquire);
+                if (slot == nullptr) continue;
+
+                auto& route = result[id];
+                for (std::size_t b = 0; b < kBucketCount; ++b) {
+                    const auto count = slot->buckets[b].load(std::memory_order_relaxed);
+                    route.latency.counts[b] += count;
+                    route.latency.total += count;
+                }
+                route.latency.sumMicros += slot->sumMicros.load(std::memory_order_relaxed);
+                for (std::size_t s = 0; s < route.statuses.size(); ++s) {
+                    route.statuses[s] += slot->statuses[s].load(std::memory_order_relaxed);
+                }
+                route.inFlight += slot->inFlight.load(std::memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+
+    std::string MetricsRegistry::Render() const {
+        const auto routes = Snapshot();
+        std::string out;
+        out.reserve(routes.size() * 2048);
+
+        out += "# HELP tournament_http_requests_total Requests handled, by route and status class.\n"
+               "# TYPE tournament_http_requests_total counter\n";
+        for (const auto& route : routes) {
+            for (std::size_t s = 0; s < kStatusClasses.size(); ++s) {
+                if (route.statuses[s] == 0) continue;
+                out += "tournament_http_requests_total";
+                Labels(out, route);
+                out += ",status=\"";
+                out += kStatusClasses[s];
+                out += "\"} ";
+                out += std::to_string(route.statuses[s]);
+                out += '\n';
+            }
+        }
+
+        out += "# HELP tournament_http_requests_in_flight Requests currently being handled.\n"
+               "# TYPE tournament_http_requests_in_flight gauge\n";
+        for (const auto& route : routes) {
+            out += "tournament_http_requests_in_flight";
+            Labels(out, route);
+            out += "} ";
+            out += std::to_string(route.inFlight);
+            out += '\n';
+        }
+
+        out += "# HELP tournament_http_request_duration_seconds Time from routing to response, including executor queueing.\n"
+               "# TYPE tournament_http_request_duration_seconds histogram\n";
+        for (const auto& route : routes) {
+            for (const auto& [le, micros] : kLatencyBuckets) {
+                out += "tournament_http_request_duration_seconds_bucket";
+                Labels(out, route);
+                out += ",le=\"";
+                out += le;
+                out += "\"} ";
+                out += std::to_string(route.latency.CountAtOrBelow(micros));
+                out += '\n';
+            }
+            out += "tournament_http_request_duration_seconds_bucket";
+            Labels(out, route);
+            out += ",le=\"+Inf\"} ";
+            out += std::to_string(route.latency.total);
+            out += "\ntournament_http_request_duration_seconds_sum";
+            Labels(out, route);
+            out += "} ";
+            out += Seconds(route.latency.sumMicros);
+            out += "\ntournament_http_request_duration_seconds_count";
+            Labels(out, route);
+            out += "} ";
+            out += std::to_string(route.latency.total);
+            out += '\n';
+        }
+
+        out += "# HELP tournament_http_request_duration_quantile_seconds Latency quantiles since start (bucket upper bound, <=12.5% error).\n"
+               "# TYPE tournament_http_request_duration_quantile_seconds gauge\n";
+        for (const auto& route : routes) {
+            if (route.latency.total == 0) continue;
+            for (const auto& [label, q] : kQuantiles) {
+                out += "tournament_http_request_duration_quantile_seconds";
+                Labels(out, route);
+                out += ",quantile=\"";
+                out += label;
+                out += "\"} ";
+                out += Seconds(route.latency.QuantileMicros(q));
+                out += '\n';
+            }
+        }
+
+        std::vector<std::function<void(std::string&)>> extra;
+        {
+            std::lock_guard lock(mutex);
+            extra = collectors;
+        }
+        for (const auto& collector : extra) {
+            collector(out);
+        }
+        return out;
+    }
+}
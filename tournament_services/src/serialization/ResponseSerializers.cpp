@@ -0,0 +1,178 @@
+#include "serialization/ResponseSerializers.hpp"
+
+#include <string_view>
+
+namespace serialization {
+namespace {
+    // Fragmentos precalculados (orden alfabético de llaves, igual que nlohmann)
+    constexpr std::string_view kId = R"({"id":)";
+    constexpr std::string_view kName = R"(,"name":)";
+    constexpr std::string_view kNameFirst = R"({"name":)";
+    constexpr std::string_view kTeams = R"(,"teams":[)";
+    constexpr std::string_view kTournamentId = R"(],"tournamentId":)";
+    constexpr std::string_view kHome = R"({"home":)";
+    constexpr std::string_view kRound = R"(,"round":)";
+    constexpr std::string_view kScoreHome = R"(,"score":{"home":)";
+    constexpr std::string_view kScoreVisitor = R"(,"visitor":)";
+    constexpr std::string_view kVisitor = R"(,"visitor":)";
+    constexpr std::string_view kDuplicateName = R"({"error":"duplicate team","name":)";
+    constexpr std::string_view kCreated = R"(,"status":201})";
+    constexpr std::string_view kConflict = R"(,"status":409})";
+
+    void WriteTeamInfo(JsonWriter& writer, const MatchDTO::TeamInfo& team) {
+        writer.Raw(kId);
+        writer.String(team.id);
+        writer.Raw(kName);
+        writer.String(team.name);
+        writer.Raw('}');
+    }
+
+    JsonWriter& ThreadWriter() {
+        thread_local JsonWriter writer(4096);
+        writer.Clear();
+        return writer;
+    }
+
+    template<typename Range, typename Write>
+    std::string WriteArray(const Range& items, Write&& write) {
+        JsonWriter& writer = ThreadWriter();
+        writer.Raw('[');
+        bool first = true;
+        for (const auto& item : items) {
+            if (!first) writer.Raw(',');
+            first = false;
+            write(writer, item);
+        }
+        writer.Raw(']');
+        return std::string(writer.View());
+    }
+
+    template<typename Value, typename Write>
+    std::string WriteOne(const Value& value, Write&& write) {
+        JsonWriter& writer = ThreadWriter();
+        write(writer, value);
+        return std::string(writer.View());
+    }
+}
+
+void WriteTeam(JsonWriter& writer, const domain::Team& team) {
+    writer.Raw(kId);
+    writer.String(team.Id);
+    writer.Raw(kName);
+    writer.String(team.Name);
+    writer.Raw('}');
+}
+
+void WriteGroup(JsonWriter& writer, const domain::Group& group) {
+    // El id sólo se incluye si existe (mismo criterio que to_json(Group))
+    if (!group.Id().empty()) {
+        writer.Raw(kId);
+        writer.String(group.Id());
+        writer.Raw(kName);
+    } else {
+        writer.Raw(kNameFirst);
+    }
+    writer.String(group.Name());
+    writer.Raw(kTeams);
+    bool first = true;
+    for (const auto& team : group.Teams()) {
+        if (!first) writer.Raw(',');
+        first = false;
+        WriteTeam(writer, team);
+    }
+    writer.Raw(kTournamentId);
+    writer.String(group.TournamentId());
+    writer.Raw('}');
+}
+
+void WriteMatch(JsonWriter& writer, const MatchDTO& match) {
+    writer.Raw(kHome);
+    WriteTeamInfo(writer, match.home);
+    writer.Raw(kRound);
+    writer.String(match.round);
+    if (match.score.has_value()) {
+        writer.Raw(kScoreHome);
+        writer.Int(match.score->home);
+        writer.Raw(kScoreVisitor);
+        writer.Int(match.score->visitor);
+        writer.Raw('}');
+    }
+    writer.Raw(kVisitor);
+    WriteTeamInfo(writer, match.visitor);
+    writer.Raw('}');
+}
+
+void WriteTournamentSummary(JsonWriter& writer, const domain::Tournament& tournament) {
+    writer.Raw(kId);
+    writer.String(tournament.Id());
+    writer.Raw(kName);
+    writer.String(tournament.Name());
+    writer.Raw('}');
+}
+
+std::string TeamToJson(const domain::Team& team) {
+    return WriteOne(team, WriteTeam);
+}
+
+std::string TeamsToJson(const std::vector<std::shared_ptr<domain::Team>>& teams) {
+    JsonWriter& writer = ThreadWriter();
+    writer.Raw('[');
+    bool first = true;
+    for (const auto& team : teams) {
+        if (!team) continue;
+        if (!first) writer.Raw(',');
+        first = false;
+        WriteTeam(writer, *team);
+    }
+    writer.Raw(']');
+    return std::string(writer.View());
+}
+
+std::string GroupToJson(const domain::Group& group) {
+    return WriteOne(group, WriteGroup);
+}
+
+std::string GroupsToJson(const std::vector<std::shared_ptr<domain::Group>>& groups) {
+    return WriteArray(groups, [](JsonWriter& writer, const std::shared_ptr<domain::Group>& group) {
+        WriteGroup(writer, *group);
+    });
+}
+
+std::string MatchToJson(const MatchDTO& match) {
+    return WriteOne(match, WriteMatch);
+}
+
+std::string MatchesToJson(const std::vector<MatchDTO>& matches) {
+    return WriteArray(matches, WriteMatch);
+}
+
+std::string TournamentToJson(const domain::Tournament& tournament) {
+    return WriteOne(tournament, WriteTournamentSummary);
+}
+
+std::string TournamentsToJson(const std::vector<std::shared_ptr<domain::Tournament>>& tournaments) {
+    return WriteArray(tournaments, [](JsonWriter& writer, const std::shared_ptr<domain::Tournament>& tournament) {
+        WriteTournamentSummary(writer, *tournament);
+    });
+}
+
+std::string TeamBatchToJson(const std::vector<domain::Team>& teams, const std::vector<std::string>& ids) {
+    JsonWriter& writer = ThreadWriter();
+    writer.Raw('[');
+    for (std::size_t i = 0; i < teams.size(); ++i) {
+        if (i > 0) writer.Raw(',');
+        const bool created = i < ids.size() && !ids[i].empty();
+        if (created) {
+            writer.Raw(kId);
+            writer.String(ids[i]);
+            writer.Raw(kName);
+        } else {
+            writer.Raw(kDuplicateName);
+        }
+        writer.String(teams[i].Name);
+        writer.Raw(created ? kCreated : kConflict);
+    }
+    writer.Raw(']');
+    return std::string(writer.View());
+}
+}
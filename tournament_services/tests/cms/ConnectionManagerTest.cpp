@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "cms/ConnectionManager.hpp"
+#include "cms/testing/FakeBroker.hpp"
+
+namespace {
+    std::shared_ptr<ConnectionManager> ManagerFor(const std::shared_ptr<fakecms::Broker>& broker) {
+        auto manager = std::make_shared<ConnectionManager>();
+        manager->initialize(std::make_unique<fakecms::FakeConnectionFactory>(broker));
+        return manager;
+    }
+}
+
+TEST(ConnectionManagerTest, ConnectsOnFirstUse) {
+    const auto broker = std::make_shared<fakecms::Broker>();
+    const auto manager = ManagerFor(broker);
+    EXPECT_EQ(broker->ConnectionsCreated(), 0);
+
+    const auto [connection, generation] = manager->CurrentConnection();
+    EXPECT_NE(connection, nullptr);
+    EXPECT_EQ(generation, 1u);
+    EXPECT_EQ(manager->Connection(), connection);
+    EXPECT_EQ(broker->ConnectionsCreated(), 1);
+}
+
+TEST(ConnectionManagerTest, HealthyConnectionIsNotReopened) {
+    const auto broker = std::make_shared<fakecms::Broker>();
+    const auto manager = ManagerFor(broker);
+    const auto [connection, generation] = manager->CurrentConnection();
+
+    // El error fue de otra cosa (p. ej. un envío rechazado): no hay nada que reintentar
+    EXPECT_FALSE(manager->ReconnectIfFailed(generation));
+    EXPECT_EQ(manager->CurrentConnection().second, generation);
+    EXPECT_EQ(broker->ConnectionsCreated(), 1);
+}
+
+TEST(ConnectionManagerTest, FailedConnectionIsReplacedWithNewGeneration) {
+    const auto broker = std::make_shared<fakecms::Broker>();
+    const auto manager = ManagerFor(broker);
+    const auto [connection, generation] = manager->CurrentConnection();
+
+    broker->DropConnections();
+    EXPECT_TRUE(manager->ReconnectIfFailed(generation));
+
+    const auto [fresh, next] = manager->CurrentConnection();
+    EXPECT_NE(fresh, connection);
+    EXPECT_EQ(next, generation + 1);
+    EXPECT_EQ(broker->ConnectionsCreated(), 2);
+    EXPECT_NO_THROW(std::unique_ptr<cms::Session>(fresh->createSession()));
+}
+
+TEST(ConnectionManagerTest, StaleGenerationDoesNotReconnectAgain) {
+    const auto broker = std::make_shared<fakecms::Broker>();
+    const auto manager = ManagerFor(broker);
+    const auto generation = manager->CurrentConnection().second;
+
+    broker->DropConnections();
+    ASSERT_TRUE(manager->ReconnectIfFailed(generation));
+
+    // Otro hilo notó la misma caída tarde: ya hay una conexión nueva, sólo reintenta
+    EXPECT_TRUE(manager->ReconnectIfFailed(generation));
+    EXPECT_EQ(manager->CurrentConnection().second, generation + 1);
+    EXPECT_EQ(broker->ConnectionsCreated(), 2);
+}
+
+TEST(ConnectionManagerTest, ConcurrentCallersReconnectOnce) {
+    const auto broker = std::make_shared<fakecms::Broker>();
+    const auto manager = ManagerFor(broker);
+    const auto generation = manager->CurrentConnection().second;
+    broker->DropConnections();
+
+    std::vector<std::thread> threads;
+    std::vector<int> retry(8, 0);
+    for (std::size_t i = 0; i < retry.size(); ++i) {
+        threads.emplace_back([&, i] { retry[i] = manager->ReconnectIfFailed(generation) ? 1 : 0; });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (const auto value : retry) EXPECT_EQ(value, 1);
+    EXPECT_EQ(broker->ConnectionsCreated(), 2);
+    EXPECT_EQ(manager->CurrentConnection().second, generation + 1);
+}
+
+TEST(ConnectionManagerTest, UnreachableBrokerIsRetriedOnNextUse) {
+    const auto broker = std::make_shared<fakecms::Broker>();
+    const auto manager = ManagerFor(broker);
+    const auto generation = manager->CurrentConnection().second;
+
+    broker->RefuseConnections(true);
+    broker->DropConnections();
+    EXPECT_FALSE(manager->ReconnectIfFailed(generation));
+    EXPECT_THROW((void)manager->CurrentConnection(), cms::CMSException);
+
+    broker->RefuseConnections(false);
+    const auto [connection, next] = manager->CurrentConnection();
+    EXPECT_NE(connection, nullptr);
+    EXPECT_EQ(next, generation + 1);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cms/QueueMessageProducer.hpp"
+#include "cms/testing/FakeBroker.hpp"
+
+namespace {
+    struct QueueMessageProducerTest : ::testing::Test {
+        std::shared_ptr<fakecms::Broker> broker = std::make_shared<fakecms::Broker>();
+        std::shared_ptr<ConnectionManager> manager = std::make_shared<ConnectionManager>();
+        std::unique_ptr<QueueMessageProducer> producer;
+
+        void SetUp() override {
+            manager->initialize(std::make_unique<fakecms::FakeConnectionFactory>(broker));
+            producer = std::make_unique<QueueMessageProducer>(manager);
+        }
+    };
+}
+
+TEST_F(QueueMessageProducerTest, ReusesChannelBetweenSends) {
+    producer->SendMessage("uno", "tournament.created");
+    producer->SendMessage("dos", "tournament.created");
+    producer->SendMessage("tres", "team.added");
+
+    const auto sent = broker->Sent();
+    ASSERT_EQ(sent.size(), 3u);
+    EXPECT_EQ(sent[0].queue, "tournament.created");
+    EXPECT_EQ(sent[0].text, "uno");
+    EXPECT_EQ(sent[2].queue, "team.added");
+    // Un solo hilo publicando: el canal vuelve al pool y se presta otra vez
+    EXPECT_EQ(broker->SessionsCreated(), 1);
+}
+
+TEST_F(QueueMessageProducerTest, ConcurrentSendersGetTheirOwnChannel) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&, i] {
+            for (int n = 0; n < 25; ++n) producer->SendMessage(std::to_string(i), "q");
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(broker->Sent().size(), 100u);
+    EXPECT_GE(broker->SessionsCreated(), 1);
+    EXPECT_LE(broker->SessionsCreated(), 4);
+}
+
+TEST_F(QueueMessageProducerTest, TransportFailureReconnectsAndRetriesOnce) {
+    producer->SendMessage("antes", "q");
+    const auto generation = manager->CurrentConnection().second;
+
+    broker->DropConnections();
+    producer->SendMessage("despues", "q");
+
+    const auto sent = broker->Sent();
+    ASSERT_EQ(sent.size(), 2u);
+    EXPECT_EQ(sent[1].text, "despues");
+    EXPECT_EQ(manager->CurrentConnection().second, generation + 1);
+    EXPECT_EQ(broker->ConnectionsCreated(), 2);
+}
+
+TEST_F(QueueMessageProducerTest, SendFailureOnHealthyConnectionIsNotRetried) {
+    producer->SendMessage("antes", "q");
+    broker->FailNextSends(1);
+
+    EXPECT_THROW(producer->SendMessage("rechazado", "q"), cms::CMSException);
+    EXPECT_EQ(broker->Sent().size(), 1u);
+    EXPECT_EQ(broker->ConnectionsCreated(), 1);
+
+    // El canal que falló se descartó; el siguiente envío abre otro
+    producer->SendMessage("siguiente", "q");
+    EXPECT_EQ(broker->Sent().size(), 2u);
+    EXPECT_EQ(broker->SessionsCreated(), 2);
+}
+
+TEST_F(QueueMessageProducerTest, UnreachableBrokerFailsAfterOneRetry) {
+    producer->SendMessage("antes", "q");
+    broker->RefuseConnections(true);
+    broker->DropConnections();
+
+    EXPECT_THROW(producer->SendMessage("perdido", "q"), cms::CMSException);
+    EXPECT_EQ(broker->Sent().size(), 1u);
+
+    broker->RefuseConnections(false);
+    producer->SendMessage("recuperado", "q");
+    EXPECT_EQ(broker->Sent().back().text, "recuperado");
+}
+
+TEST_F(QueueMessageProducerTest, ChannelsFromOldGenerationAreEvicted) {
+    producer->SendMessage("antes", "q");
+    ASSERT_EQ(broker->SessionsCreated(), 1);
+
+    // Otro componente (p. ej. el consumidor) reconectó: el canal ocioso quedó
+    // atado a la conexión vieja y no debe volver a prestarse
+    const auto generation = manager->CurrentConnection().second;
+    broker->DropConnections();
+    ASSERT_TRUE(manager->ReconnectIfFailed(generation));
+
+    producer->SendMessage("despues", "q");
+    EXPECT_EQ(broker->Sent().size(), 2u);
+    EXPECT_EQ(broker->SessionsCreated(), 2);
+    EXPECT_EQ(broker->SessionsClosed(), 1);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <zlib.h>
+
+#include "compression/ResponseCompressor.hpp"
+
+using compression::AcceptsGzip;
+using compression::CompressionOptions;
+using compression::ResponseCompressor;
+
+namespace {
+    std::string Gunzip(const std::string& data) {
+        z_stream stream{};
+        inflateInit2(&stream, 15 + 16);
+        std::string out(data.size() * 50, '\0');
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        stream.avail_in = static_cast<uInt>(data.size());
+        stream.next_out = reinterpret_cast<Bytef*>(out.data());
+        stream.avail_out = static_cast<uInt>(out.size());
+        inflate(&stream, Z_FINISH);
+        out.resize(stream.total_out);
+        inflateEnd(&stream);
+        return out;
+    }
+
+    std::string MatchListing(int matches) {
+        std::string body = "[";
+        for (int i = 0; i < matches; ++i) {
+            if (i) body += ',';
+            body += R"({"id":"m)" + std::to_string(i) +
+                    R"(","home":{"id":"t1","name":"Home Team"},"visitor":{"id":"t2","name":"Away Team"},"round":1})";
+        }
+        return body + "]";
+    }
+
+    CompressionOptions Enabled() {
+        CompressionOptions options;
+        options.enabled = true;
+        options.minBytes = 256;
+        return options;
+    }
+
+    crow::request GzipRequest() {
+        crow::request request;
+        request.add_header("Accept-Encoding", "gzip, deflate, br");
+        return request;
+    }
+}
+
+TEST(ResponseCompressor, NegotiatesAcceptEncoding) {
+    EXPECT_TRUE(AcceptsGzip("gzip"));
+    EXPECT_TRUE(AcceptsGzip("deflate, GZIP;q=0.8"));
+    EXPECT_TRUE(AcceptsGzip("*"));
+    EXPECT_FALSE(AcceptsGzip(""));
+    EXPECT_FALSE(AcceptsGzip("br, deflate"));
+    EXPECT_FALSE(AcceptsGzip("gzip;q=0"));
+    EXPECT_FALSE(AcceptsGzip("*, gzip;q=0"));
+}
+
+TEST(ResponseCompressor, CompressesLargeBodiesWhenAccepted) {
+    ResponseCompressor compressor(Enabled());
+    const auto body = MatchListing(200);
+    crow::response response{crow::OK, body};
+
+    compressor.Apply(GzipRequest(), response);
+
+    EXPECT_EQ(response.get_header_value("Content-Encoding"), "gzip");
+    EXPECT_EQ(response.get_header_value("Vary"), "Accept-Encoding");
+    EXPECT_LT(response.body.size(), body.size() / 5);
+    EXPECT_EQ(Gunzip(response.body), body);
+}
+
+TEST(ResponseCompressor, LeavesSmallBodiesAndOtherClientsAlone) {
+    ResponseCompressor compressor(Enabled());
+
+    crow::response small{crow::OK, R"({"id":"t1"})"};
+    compressor.Apply(GzipRequest(), small);
+    EXPECT_TRUE(small.get_header_value("Content-Encoding").empty());
+
+    const auto body = MatchListing(200);
+    crow::response identity{crow::OK, body};
+    compressor.Apply(crow::request{}, identity);
+    EXPECT_EQ(identity.body, body);
+    EXPECT_TRUE(identity.get_header_value("Content-Encoding").empty());
+    EXPECT_EQ(identity.get_header_value("Vary"), "Accept-Encoding");
+}
+
+TEST(ResponseCompressor, DisabledByDefault) {
+    ResponseCompressor compressor(CompressionOptions{});
+    const auto body = MatchListing(200);
+    crow::response response{crow::OK, body};
+
+    compressor.Apply(GzipRequest(), response);
+    EXPECT_EQ(response.body, body);
+}
+
+TEST(ResponseCompressor, ReusesCompressedCopyOfRepeatedBodies) {
+    ResponseCompressor compressor(Enabled());
+    const auto body = MatchListing(200);
+
+    crow::response first{crow::OK, body};
+    compressor.Apply(GzipRequest(), first);
+    crow::response second{crow::OK, body};
+    compressor.Apply(GzipRequest(), second);
+
+    EXPECT_EQ(compressor.CacheMisses(), 1u);
+    EXPECT_EQ(compressor.CacheHits(), 1u);
+    EXPECT_EQ(first.body, second.body);
+
+    crow::response other{crow::OK, MatchListing(201)};
+    compressor.Apply(GzipRequest(), other);
+    EXPECT_EQ(compressor.CacheMisses(), 2u);
+}
+
+TEST(ResponseCompressor, EvictsOldestWhenCacheIsFull) {
+    auto options = Enabled();
+    options.cacheBytes = 20'000;
+    ResponseCompressor compressor(options);
+
+    for (int round = 0; round < 2; ++round) {
+        for (int size : {100, 101, 102}) {
+            crow::response response{crow::OK, MatchListing(size)};
+            compressor.Apply(GzipRequest(), response);
+        }
+    }
+    // Cada listado ocupa ~10 KB: caben menos de dos y el recorrido cíclico
+    // siempre pide el que se acaba de desalojar
+    EXPECT_EQ(compressor.CacheMisses(), 6u);
+    EXPECT_EQ(compressor.CacheHits(), 0u);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "concurrency/BlockingExecutor.hpp"
+
+using concurrency::BlockingExecutor;
+
+TEST(BlockingExecutor, RunsTasksOffTheCallingThread) {
+    BlockingExecutor executor(2, 16);
+    std::promise<std::thread::id> ranOn;
+
+    ASSERT_TRUE(executor.TrySubmit([&ranOn] { ranOn.set_value(std::this_thread::get_id()); }));
+
+    auto future = ranOn.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_NE(future.get(), std::this_thread::get_id());
+}
+
+TEST(BlockingExecutor, DisabledWithoutThreads) {
+    BlockingExecutor executor(0, 16);
+
+    EXPECT_FALSE(executor.Enabled());
+    EXPECT_FALSE(executor.Offloads("/teams"));
+    EXPECT_FALSE(executor.TrySubmit([] {}));
+}
+
+TEST(BlockingExecutor, KeepsInlineRoutesOnIoThreads) {
+    BlockingExecutor executor(1, 16, {"/metrics"});
+
+    EXPECT_TRUE(executor.Offloads("/teams"));
+    EXPECT_FALSE(executor.Offloads("/metrics"));
+}
+
+TEST(BlockingExecutor, RejectsWhenQueueIsFull) {
+    BlockingExecutor executor(1, 1);
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    ASSERT_TRUE(executor.TrySubmit([&started, released] {
+        started.set_value();
+        released.wait();
+    }));
+    started.get_future().wait();
+
+    EXPECT_TRUE(executor.TrySubmit([] {}));  // ocupa el único lugar de la cola
+    EXPECT_FALSE(executor.TrySubmit([] {})); // saturado
+
+    release.set_value();
+}
+
+TEST(BlockingExecutor, DrainsQueuedTasksOnShutdown) {
+    std::atomic<int> completed{0};
+    {
+        BlockingExecutor executor(1, 64);
+        for (int i = 0; i < 32; ++i) {
+            ASSERT_TRUE(executor.TrySubmit([&completed] {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                ++completed;
+            }));
+        }
+    }
+    EXPECT_EQ(completed.load(), 32);
+}
+
+TEST(BlockingExecutor, GrowsOnlyWhenEnabled) {
+    BlockingExecutor enabled(1, 16);
+    enabled.Grow(4);
+    enabled.Grow(2);
+    EXPECT_EQ(enabled.Threads(), 4u);
+
+    BlockingExecutor disabled(0, 16);
+    disabled.Grow(4);
+    EXPECT_FALSE(disabled.Enabled());
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "configuration/ConcurrencySizing.hpp"
+
+using namespace config;
+
+TEST(ConcurrencySizing, ParsesCgroupV2Quota) {
+    EXPECT_DOUBLE_EQ(*ParseCpuMax("150000 100000\n"), 1.5);
+    EXPECT_FALSE(ParseCpuMax("max 100000\n").has_value());
+    EXPECT_FALSE(ParseCpuMax("").has_value());
+}
+
+TEST(ConcurrencySizing, ParsesCgroupV1Quota) {
+    EXPECT_DOUBLE_EQ(*ParseCfsQuota("200000\n", "100000\n"), 2.0);
+    EXPECT_FALSE(ParseCfsQuota("-1\n", "100000\n").has_value());
+}
+
+TEST(ConcurrencySizing, QuotaCapsHardwareThreads) {
+    EXPECT_EQ(EffectiveCpus(16, 1.5), 2u);
+    EXPECT_EQ(EffectiveCpus(4, 8.0), 4u);
+    EXPECT_EQ(EffectiveCpus(8, std::nullopt), 8u);
+    EXPECT_EQ(EffectiveCpus(0, std::nullopt), 1u);
+    EXPECT_EQ(EffectiveCpus(8, 0.2), 1u);
+}
+
+TEST(ConcurrencySizing, AcceptsAutoOrExplicitSizes) {
+    EXPECT_EQ(SizeOrAuto(nlohmann::json("auto")), 0u);
+    EXPECT_EQ(SizeOrAuto(nlohmann::json(6)), 6u);
+}
+
+TEST(ConcurrencySizing, SizesPoolWithLittlesLaw) {
+    AutoSizingOptions options;
+    options.minPoolSize = 2;
+    options.maxPoolSize = 32;
+    options.headroom = 1.5;
+
+    // 400 req/s * 20 ms = 8 conexiones ocupadas, * 1.5 = 12
+    EXPECT_EQ(LittlesLawPoolSize(400, 0.020, options), 12u);
+    EXPECT_EQ(LittlesLawPoolSize(1, 0.001, options), 2u);
+    EXPECT_EQ(LittlesLawPoolSize(10000, 0.050, options), 32u);
+}
+
+TEST(ConcurrencySizing, GrowsFromTelemetryButNeverShrinks) {
+    AutoSizingOptions options;
+    PoolTelemetry telemetry;
+    const auto before = telemetry.Read();
+    for (int i = 0; i < 1000; ++i) {
+        telemetry.Acquired(std::chrono::nanoseconds{0});
+        telemetry.Released(std::chrono::milliseconds{40});
+    }
+    const auto delta = telemetry.Read() - before;
+
+    // 100 adquisiciones/s * 40 ms * 1.5 = 6
+    EXPECT_EQ(NextPoolSize(delta, 10.0, 4, options), 6u);
+    EXPECT_EQ(NextPoolSize(delta, 10.0, 8, options), 8u);
+    EXPECT_EQ(NextPoolSize(PoolTelemetry::Snapshot{}, 10.0, 4, options), 4u);
+}
+
+TEST(ConcurrencySizing, TracksConnectionsInUse) {
+    PoolTelemetry telemetry;
+    telemetry.Acquired(std::chrono::nanoseconds{5});
+    telemetry.Acquired(std::chrono::nanoseconds{5});
+    telemetry.Released(std::chrono::nanoseconds{1});
+
+    const auto snapshot = telemetry.Read();
+    EXPECT_EQ(snapshot.acquisitions, 2u);
+    EXPECT_EQ(snapshot.waitNanos, 10u);
+    EXPECT_EQ(snapshot.inUse, 1u);
+    EXPECT_EQ(snapshot.peakInUse, 2u);
+}
+
+TEST(ConcurrencySizing, PeakInUseIsPerInterval) {
+    PoolTelemetry telemetry;
+    telemetry.Acquired(std::chrono::nanoseconds{0});
+    telemetry.Acquired(std::chrono::nanoseconds{0});
+    telemetry.Acquired(std::chrono::nanoseconds{0});
+    telemetry.Released(std::chrono::nanoseconds{0});
+    telemetry.Released(std::chrono::nanoseconds{0});
+
+    EXPECT_EQ(telemetry.ReadInterval().peakInUse, 3u);
+    // El pico siguiente parte de la conexión que sigue en uso
+    EXPECT_EQ(telemetry.ReadInterval().peakInUse, 1u);
+    telemetry.Acquired(std::chrono::nanoseconds{0});
+    EXPECT_EQ(telemetry.ReadInterval().peakInUse, 2u);
+}
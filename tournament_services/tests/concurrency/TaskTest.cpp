@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "concurrency/Task.hpp"
+
+using concurrency::Spawn;
+using concurrency::Task;
+
+namespace {
+    // Simula el socket de la base: la corrutina queda suspendida hasta Complete()
+    struct PendingIo {
+        std::vector<std::coroutine_handle<>> waiting;
+
+        auto Wait() {
+            struct Awaiter {
+                PendingIo& io;
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> handle) { io.waiting.push_back(handle); }
+                void await_resume() const noexcept {}
+            };
+            return Awaiter{*this};
+        }
+
+        void CompleteAll() {
+            auto ready = std::move(waiting);
+            waiting.clear();
+            for (auto handle : ready) handle.resume();
+        }
+    };
+
+    Task<int> Value(int value) {
+        co_return value;
+    }
+
+    Task<int> Sum(int a, int b) {
+        co_return co_await Value(a) + co_await Value(b);
+    }
+
+    Task<std::string> Query(PendingIo& io, std::string id) {
+        co_await io.Wait();
+        co_return "row-" + id;
+    }
+
+    Task<int> Fails() {
+        throw std::runtime_error("boom");
+        co_return 0;
+    }
+
+    Task<int> Chain(int depth) {
+        int total = 0;
+        for (int i = 0; i < depth; ++i) {
+            total += co_await Value(1);
+        }
+        co_return total;
+    }
+
+    template<typename T>
+    std::optional<T> RunNow(Task<T> task) {
+        std::optional<T> value;
+        Spawn(std::move(task), [&value](auto outcome) {
+            if (outcome) value = std::move(*outcome);
+        });
+        return value;
+    }
+}
+
+TEST(Task, ComposesAwaitedValues) {
+    EXPECT_EQ(RunNow(Sum(2, 3)), 5);
+}
+
+TEST(Task, IsLazyUntilStarted) {
+    PendingIo io;
+    auto task = Query(io, "t1");
+    EXPECT_TRUE(io.waiting.empty());
+
+    std::optional<std::string> row;
+    Spawn(std::move(task), [&row](auto outcome) { row = *outcome; });
+    ASSERT_EQ(io.waiting.size(), 1u);
+    EXPECT_FALSE(row.has_value());
+
+    io.CompleteAll();
+    EXPECT_EQ(row, "row-t1");
+}
+
+TEST(Task, KeepsManyOperationsInFlightOnOneThread) {
+    PendingIo io;
+    std::vector<std::string> rows;
+    for (int i = 0; i < 100; ++i) {
+        Spawn(Query(io, std::to_string(i)), [&rows](auto outcome) { rows.push_back(*outcome); });
+    }
+    EXPECT_EQ(io.waiting.size(), 100u);
+    EXPECT_TRUE(rows.empty());
+
+    io.CompleteAll();
+    ASSERT_EQ(rows.size(), 100u);
+    EXPECT_EQ(rows.front(), "row-0");
+    EXPECT_EQ(rows.back(), "row-99");
+}
+
+TEST(Task, PropagatesExceptionsToSpawnCallback) {
+    std::exception_ptr error;
+    Spawn(Fails(), [&error](auto outcome) {
+        if (!outcome) error = outcome.error();
+    });
+    ASSERT_TRUE(error);
+    EXPECT_THROW(std::rethrow_exception(error), std::runtime_error);
+}
+
+TEST(Task, PropagatesExceptionsThroughAwait) {
+    auto wrapper = []() -> Task<std::string> {
+        try {
+            co_await Fails();
+        } catch (const std::runtime_error& e) {
+            co_return e.what();
+        }
+        co_return "";
+    };
+    EXPECT_EQ(RunNow(wrapper()), "boom");
+}
+
+TEST(Task, VoidTasksReportCompletion) {
+    int counter = 0;
+    auto increment = [](int& value) -> Task<void> {
+        ++value;
+        co_return;
+    };
+    bool done = false;
+    Spawn(increment(counter), [&done](auto outcome) { done = outcome.has_value(); });
+    EXPECT_TRUE(done);
+    EXPECT_EQ(counter, 1);
+}
+
+TEST(Task, LongSynchronousChainsDoNotGrowTheStack) {
+    EXPECT_EQ(RunNow(Chain(1'000'000)), 1'000'000);
+}
+
+TEST(Task, DestroyingAnUnstartedTaskReleasesItsFrame) {
+    auto owned = std::make_shared<int>(7);
+    std::weak_ptr<int> watch = owned;
+    {
+        auto task = [](std::shared_ptr<int> value) -> Task<int> { co_return *value; }(std::move(owned));
+    }
+    EXPECT_TRUE(watch.expired());
+}
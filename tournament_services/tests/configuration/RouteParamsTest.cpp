@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <crow.h>
+
+#include "configuration/RouteDefinition.hpp"
+#include "util/Uuid.hpp"
+
+namespace {
+    struct TypedRouteController {
+        crow::response ById(const crow::request&, const std::string& first, const std::string& second) const {
+            return crow::response{crow::OK, first + "/" + second};
+        }
+
+        crow::response ByUuid(const util::Uuid& id) const {
+            return crow::response{crow::OK, id.ToString()};
+        }
+    };
+}
+
+TEST(RouteParams, StringIdsAreValidatedBeforeHandler) {
+    TypedRouteController controller;
+    crow::request request;
+
+    auto ok = dispatchRoute(&controller, &TypedRouteController::ById, request,
+                            std::string("tourn-1"), std::string("g1"));
+    EXPECT_EQ(ok.code, crow::OK);
+    EXPECT_EQ(ok.body, "tourn-1/g1");
+
+    auto bad = dispatchRoute(&controller, &TypedRouteController::ById, request,
+                             std::string("tourn-1"), std::string("g 1"));
+    EXPECT_EQ(bad.code, crow::BAD_REQUEST);
+}
+
+TEST(RouteParams, UuidIdsAreParsedBeforeHandler) {
+    TypedRouteController controller;
+    crow::request request;
+
+    auto ok = dispatchRoute(&controller, &TypedRouteController::ByUuid, request,
+                            std::string("AAAAAAAA-aaaa-aaaa-aaaa-aaaaaaaaaaaa"));
+    EXPECT_EQ(ok.code, crow::OK);
+    EXPECT_EQ(ok.body, "aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+
+    // Id válido para RouteParam<std::string>, pero no es un uuid
+    auto bad = dispatchRoute(&controller, &TypedRouteController::ByUuid, request, std::string("tourn-1"));
+    EXPECT_EQ(bad.code, crow::BAD_REQUEST);
+}
+
+TEST(RouteParams, AsyncResultKeepsHeadersAlreadyOnTheResponse) {
+    crow::response response;
+    response.set_header("connection", "Keep-Alive");
+    response.set_header("x-request-id", "from-middleware");
+
+    crow::response result{crow::CREATED, "created"};
+    result.set_header("content-type", "application/json");
+    result.set_header("X-Request-Id", "from-handler");
+
+    applyRouteResult(response, std::move(result));
+
+    EXPECT_EQ(response.code, crow::CREATED);
+    EXPECT_EQ(response.body, "created");
+    EXPECT_EQ(response.get_header_value("connection"), "Keep-Alive");
+    EXPECT_EQ(response.get_header_value("content-type"), "application/json");
+    EXPECT_EQ(response.headers.count("x-request-id"), 1u);
+    EXPECT_EQ(response.get_header_value("x-request-id"), "from-handler");
+}
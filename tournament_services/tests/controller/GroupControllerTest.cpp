@@ -8,6 +8,7 @@
 #include "delegate/IGroupDelegate.hpp"
 #include "domain/Group.hpp"
 #include "domain/Team.hpp"
+#include "util/Uuid.hpp"
 
 using ::testing::_;
 using ::testing::Return;
@@ -15,6 +16,13 @@ using ::testing::DoAll;
 using ::testing::SetArgReferee;
 using nlohmann::json;
 
+namespace {
+    // Los ids llegan al controlador ya validados por RouteParam<util::Uuid>
+    const util::Uuid TournamentId = *util::Uuid::Parse("aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    const util::Uuid GroupId = *util::Uuid::Parse("bbbbbbbb-bbbb-bbbb-bbbb-bbbbbbbbbbbb");
+    const util::Uuid MissingGroupId = *util::Uuid::Parse("cccccccc-cccc-cccc-cccc-cccccccccccc");
+}
+
 class GroupDelegateMock : public IGroupDelegate {
 public:
     MOCK_METHOD(std::optional<std::string>, CreateGroup,
@@ -59,7 +67,7 @@ TEST(GroupController, ListGroups_200) {
     EXPECT_CALL(*mock, GetGroups(_, _))
         .WillOnce(Return(std::nullopt));
 
-    auto res = ctrl.GetGroups("aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    auto res = ctrl.GetGroups(TournamentId);
 
     EXPECT_EQ(res.code, crow::status::OK);
     EXPECT_EQ(res.get_header_value("content-type"), "application/json");
@@ -80,7 +88,7 @@ TEST(GroupController, CreateGroup_201_and_409) {
             Return(std::nullopt)
         ));
 
-    auto ok = ctrl.CreateGroup(okReq, "aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    auto ok = ctrl.CreateGroup(okReq, TournamentId);
     EXPECT_EQ(ok.code, crow::status::CREATED);
 
     // --- Caso 409 (grupo duplicado) ---
@@ -90,7 +98,7 @@ TEST(GroupController, CreateGroup_201_and_409) {
     EXPECT_CALL(*mock, CreateGroup(_, _, _))
         .WillOnce(Return(std::make_optional<std::string>("duplicate_group_name")));
 
-    auto dup = ctrl.CreateGroup(dupReq, "aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    auto dup = ctrl.CreateGroup(dupReq, TournamentId);
     EXPECT_EQ(dup.code, crow::status::CONFLICT);
 }
 
@@ -100,25 +108,25 @@ TEST(GroupController, GetGroup_200_and_404) {
 
     // --- 200 ---
     auto g = std::make_shared<domain::Group>();
-    g->Id() = "g1";
-    g->TournamentId() = "t1";
+    g->Id() = GroupId.ToString();
+    g->TournamentId() = TournamentId.ToString();
     g->Name() = "Group A";
 
-    EXPECT_CALL(*mock, GetGroup("t1", "g1", _))
+    EXPECT_CALL(*mock, GetGroup(TournamentId.ToString(), GroupId.ToString(), _))
         .WillOnce(DoAll(
             SetArgReferee<2>(g),
             Return(std::nullopt)
         ));
 
-    auto ok = controller.GetGroup("t1", "g1");
+    auto ok = controller.GetGroup(TournamentId, GroupId);
     EXPECT_EQ(ok.code, crow::status::OK);
     EXPECT_EQ(ok.get_header_value("content-type"), "application/json");
 
     // --- 404 ---
-    EXPECT_CALL(*mock, GetGroup("t1", "not-found", _))
+    EXPECT_CALL(*mock, GetGroup(TournamentId.ToString(), MissingGroupId.ToString(), _))
         .WillOnce(Return(std::make_optional<std::string>("group_not_found")));
 
-    auto nf = controller.GetGroup("t1", "not-found");
+    auto nf = controller.GetGroup(TournamentId, MissingGroupId);
     EXPECT_EQ(nf.code, crow::status::NOT_FOUND);
 }
 
@@ -127,19 +135,19 @@ TEST(GroupController, UpdateGroup_204_and_404) {
     GroupController controller{mock};
 
     // --- 204 ---
-    EXPECT_CALL(*mock, UpdateGroup("t1", _))
+    EXPECT_CALL(*mock, UpdateGroup(TournamentId.ToString(), _))
         .WillOnce(Return(std::nullopt));
 
     crow::request req;
     req.body = R"({"name":"Group X"})";
-    auto ok = controller.UpdateGroup(req, "t1", "g1");
+    auto ok = controller.UpdateGroup(req, TournamentId, GroupId);
     EXPECT_EQ(ok.code, crow::status::NO_CONTENT);
 
     // --- 404 ---
-    EXPECT_CALL(*mock, UpdateGroup("t1", _))
+    EXPECT_CALL(*mock, UpdateGroup(TournamentId.ToString(), _))
         .WillOnce(Return(std::make_optional<std::string>("group_not_found")));
 
-    auto nf = controller.UpdateGroup(req, "t1", "nope");
+    auto nf = controller.UpdateGroup(req, TournamentId, MissingGroupId);
     EXPECT_EQ(nf.code, crow::status::NOT_FOUND);
 }
 
@@ -148,24 +156,24 @@ TEST(GroupController, AddTeam_201_and_422_cases) {
     GroupController controller{mock};
 
     // --- 201 (éxito) ---
-    EXPECT_CALL(*mock, UpdateTeams("t1", "g1", _))
+    EXPECT_CALL(*mock, UpdateTeams(TournamentId.ToString(), GroupId.ToString(), _))
         .WillOnce(Return(std::nullopt));
 
     crow::request req;
     req.body = R"({"id":"team-1","name":"Team 1"})";
-    auto created = controller.AddTeam(req, "t1", "g1");
+    auto created = controller.AddTeam(req, TournamentId, GroupId);
     EXPECT_EQ(created.code, crow::status::CREATED);
 
     // --- 422: team_not_found ---
-    EXPECT_CALL(*mock, UpdateTeams("t1", "g1", _))
+    EXPECT_CALL(*mock, UpdateTeams(TournamentId.ToString(), GroupId.ToString(), _))
         .WillOnce(Return(std::make_optional<std::string>("team_not_found")));
-    auto tnf = controller.AddTeam(req, "t1", "g1");
+    auto tnf = controller.AddTeam(req, TournamentId, GroupId);
     EXPECT_EQ(tnf.code, 422);
 
     // --- 422: group_full ---
-    EXPECT_CALL(*mock, UpdateTeams("t1", "g1", _))
+    EXPECT_CALL(*mock, UpdateTeams(TournamentId.ToString(), GroupId.ToString(), _))
         .WillOnce(Return(std::make_optional<std::string>("group_full")));
-    auto full = controller.AddTeam(req, "t1", "g1");
+    auto full = controller.AddTeam(req, TournamentId, GroupId);
     EXPECT_EQ(full.code, 422);
 }
 // GET /tournaments/<tid>/groups -> 404 si tournament_not_found
@@ -176,7 +184,7 @@ TEST(GroupController, ListGroups_404_TournamentNotFound) {
     EXPECT_CALL(*mock, GetGroups(::testing::_, ::testing::_))
         .WillOnce(::testing::Return(std::make_optional<std::string>("tournament_not_found")));
 
-    auto res = ctrl.GetGroups("aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    auto res = ctrl.GetGroups(TournamentId);
     EXPECT_EQ(res.code, crow::status::NOT_FOUND);
 }
 
@@ -191,7 +199,7 @@ TEST(GroupController, CreateGroup_404_TournamentNotFound) {
     EXPECT_CALL(*mock, CreateGroup(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(std::make_optional<std::string>("tournament_not_found")));
 
-    auto res = ctrl.CreateGroup(req, "aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    auto res = ctrl.CreateGroup(req, TournamentId);
     EXPECT_EQ(res.code, crow::status::NOT_FOUND);
 }
 
@@ -204,16 +212,16 @@ TEST(GroupController, AddTeam_404_TournamentOrGroupNotFound) {
     req.body = R"({"id":"team-1","name":"Team 1"})";
 
     // tournament_not_found
-    EXPECT_CALL(*mock, UpdateTeams("t1","g1", ::testing::_))
+    EXPECT_CALL(*mock, UpdateTeams(TournamentId.ToString(), GroupId.ToString(), ::testing::_))
         .WillOnce(::testing::Return(std::make_optional<std::string>("tournament_not_found")));
 
-    auto tnf = controller.AddTeam(req, "t1", "g1");
+    auto tnf = controller.AddTeam(req, TournamentId, GroupId);
     EXPECT_EQ(tnf.code, crow::NOT_FOUND);
 
     // group_not_found
-    EXPECT_CALL(*mock, UpdateTeams("t1","g1", ::testing::_))
+    EXPECT_CALL(*mock, UpdateTeams(TournamentId.ToString(), GroupId.ToString(), ::testing::_))
         .WillOnce(::testing::Return(std::make_optional<std::string>("group_not_found")));
 
-    auto gnf = controller.AddTeam(req, "t1", "g1");
+    auto gnf = controller.AddTeam(req, TournamentId, GroupId);
     EXPECT_EQ(gnf.code, crow::NOT_FOUND);
 }
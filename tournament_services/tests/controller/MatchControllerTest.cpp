@@ -20,7 +20,13 @@ public:
     
     MOCK_METHOD(std::optional<std::string>,
                 UpdateScore,
-                (std::string_view tournamentId, std::string_view matchId, int homeScore, int awayScore),
+                (std::string_view tournamentId, std::string_view matchId, int homeScore, int awayScore,
+                 std::optional<int> expectedVersion, int& outVersion),
+                (override));
+
+    MOCK_METHOD(std::optional<std::string>,
+                UpdateScores,
+                (std::string_view tournamentId, const std::vector<ScoreUpdate>& updates, std::vector<std::string>& outNotFound),
                 (override));
 };
 
@@ -177,6 +183,7 @@ TEST_F(MatchControllerTest, GetMatch_Success_Returns200) {
             outMatch.round = "regular";
             MatchDTO::ScoreInfo score{1, 2};
             outMatch.score = score;
+            outMatch.version = 3;
             return std::nullopt;
         }));
     
@@ -184,6 +191,7 @@ TEST_F(MatchControllerTest, GetMatch_Success_Returns200) {
     
     EXPECT_EQ(response.code, crow::OK);
     EXPECT_EQ(response.get_header_value("content-type"), "application/json");
+    EXPECT_EQ(response.get_header_value("etag"), "\"3\"");
     
     auto jsonResponse = nlohmann::json::parse(response.body);
     EXPECT_EQ(jsonResponse["home"]["id"], "team-1");
@@ -213,7 +221,7 @@ TEST_F(MatchControllerTest, UpdateScore_Success_Returns204) {
     crow::request request;
     request.body = body.dump();
     
-    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 3, 1))
+    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 3, 1, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(std::nullopt));
     
     auto response = matchController->UpdateMatchScore(request, "tourn-1", "match-1");
@@ -233,7 +241,7 @@ TEST_F(MatchControllerTest, UpdateScore_NotFound_Returns404) {
     crow::request request;
     request.body = body.dump();
     
-    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 2, 0))
+    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 2, 0, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(std::optional<std::string>("match_not_found")));
     
     auto response = matchController->UpdateMatchScore(request, "tourn-1", "invalid-match");
@@ -253,7 +261,7 @@ TEST_F(MatchControllerTest, UpdateScore_NegativeScore_Returns422) {
     crow::request request;
     request.body = body.dump();
     
-    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, -1, 2))
+    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, -1, 2, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(std::optional<std::string>("invalid_score")));
     
     auto response = matchController->UpdateMatchScore(request, "tourn-1", "match-1");
@@ -299,7 +307,7 @@ TEST_F(MatchControllerTest, UpdateScore_DatabaseError_Returns500) {
     crow::request request;
     request.body = body.dump();
     
-    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 1, 1))
+    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 1, 1, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(std::optional<std::string>("database_error")));
     
     auto response = matchController->UpdateMatchScore(request, "tourn-1", "match-1");
@@ -307,4 +315,126 @@ TEST_F(MatchControllerTest, UpdateScore_DatabaseError_Returns500) {
     EXPECT_EQ(response.code, crow::INTERNAL_SERVER_ERROR);
 }
 
+// Test: PATCH /matches/<id> - If-Match is forwarded and the new version returned as ETag
+TEST_F(MatchControllerTest, UpdateScore_IfMatch_ReturnsNewETag) {
+    crow::request request;
+    request.body = R"({"score":{"home":2,"visitor":2}})";
+    request.add_header("If-Match", "\"4\"");
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 2, 2, std::optional<int>(4), ::testing::_))
+        .WillOnce(::testing::DoAll(::testing::SetArgReferee<5>(5), ::testing::Return(std::nullopt)));
+
+    auto response = matchController->UpdateMatchScore(request, "tourn-1", "match-1");
+
+    EXPECT_EQ(response.code, crow::NO_CONTENT);
+    EXPECT_EQ(response.get_header_value("etag"), "\"5\"");
+}
+
+// Test: PATCH /matches/<id> - Stale version - HTTP 412
+TEST_F(MatchControllerTest, UpdateScore_VersionConflict_Returns412) {
+    crow::request request;
+    request.body = R"({"score":{"home":2,"visitor":2}})";
+    request.add_header("If-Match", "\"3\"");
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, 2, 2, std::optional<int>(3), ::testing::_))
+        .WillOnce(::testing::Return(std::optional<std::string>("version_conflict")));
+
+    auto response = matchController->UpdateMatchScore(request, "tourn-1", "match-1");
+
+    EXPECT_EQ(response.code, 412);
+}
+
+// Test: PATCH /matches/<id> - If-Match that is not one of our ETags - HTTP 412
+TEST_F(MatchControllerTest, UpdateScore_ForeignIfMatch_Returns412) {
+    crow::request request;
+    request.body = R"({"score":{"home":2,"visitor":2}})";
+    request.add_header("If-Match", "W/\"abc\"");
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScore(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
+
+    auto response = matchController->UpdateMatchScore(request, "tourn-1", "match-1");
+
+    EXPECT_EQ(response.code, 412);
+}
+
+// Test: POST /matches:batchScore - Success - HTTP 200 with unknown ids
+TEST_F(MatchControllerTest, UpdateScores_Success_ReturnsCounts) {
+    crow::request request;
+    request.body = R"([{"matchId":"m1","score":{"home":3,"visitor":1}},{"matchId":"m2","score":{"home":0,"visitor":0}}])";
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScores(std::string_view("tourn-1"), ::testing::SizeIs(2), ::testing::_))
+        .WillOnce([](std::string_view, const std::vector<ScoreUpdate>& updates, std::vector<std::string>& notFound) {
+            EXPECT_EQ(updates[0].matchId, "m1");
+            EXPECT_EQ(updates[0].homeScore, 3);
+            notFound = {"m2"};
+            return std::nullopt;
+        });
+
+    auto response = matchController->UpdateMatchScores(request, "tourn-1");
 
+    EXPECT_EQ(response.code, crow::OK);
+    auto jsonResponse = nlohmann::json::parse(response.body);
+    EXPECT_EQ(jsonResponse["updated"], 1);
+    EXPECT_EQ(jsonResponse["notFound"], nlohmann::json::array({"m2"}));
+}
+
+// Test: POST /matches:batchScore - Repeated ids count once
+TEST_F(MatchControllerTest, UpdateScores_RepeatedIds_CountDistinctMatches) {
+    crow::request request;
+    request.body = R"([{"matchId":"m1","score":{"home":1,"visitor":0}},{"matchId":"M1","score":{"home":2,"visitor":0}},)"
+                   R"({"matchId":"m2","score":{"home":0,"visitor":0}},{"matchId":"m2","score":{"home":0,"visitor":1}}])";
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScores(std::string_view("tourn-1"), ::testing::SizeIs(4), ::testing::_))
+        .WillOnce([](std::string_view, const std::vector<ScoreUpdate>&, std::vector<std::string>& notFound) {
+            notFound = {"m2", "m2"};
+            return std::nullopt;
+        });
+
+    auto response = matchController->UpdateMatchScores(request, "tourn-1");
+
+    EXPECT_EQ(response.code, crow::OK);
+    auto jsonResponse = nlohmann::json::parse(response.body);
+    EXPECT_EQ(jsonResponse["updated"], 1);
+}
+
+// Test: POST /matches:batchScore - Malformed item - HTTP 422
+TEST_F(MatchControllerTest, UpdateScores_MissingScore_Returns422) {
+    crow::request request;
+    request.body = R"([{"matchId":"m1"}])";
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScores(::testing::_, ::testing::_, ::testing::_)).Times(0);
+
+    auto response = matchController->UpdateMatchScores(request, "tourn-1");
+
+    EXPECT_EQ(response.code, 422);
+}
+
+// Test: POST /matches:batchScore - Too many updates - HTTP 413
+TEST_F(MatchControllerTest, UpdateScores_TooLarge_Returns413) {
+    nlohmann::json body = nlohmann::json::array();
+    for (std::size_t i = 0; i <= MatchController::MaxScoreBatch; ++i) {
+        body.push_back({{"matchId", "m" + std::to_string(i)}, {"score", {{"home", 1}, {"visitor", 0}}}});
+    }
+    crow::request request;
+    request.body = body.dump();
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScores(::testing::_, ::testing::_, ::testing::_)).Times(0);
+
+    auto response = matchController->UpdateMatchScores(request, "tourn-1");
+
+    EXPECT_EQ(response.code, 413);
+}
+
+// Test: POST /matches:batchScore - Unknown tournament - HTTP 404
+TEST_F(MatchControllerTest, UpdateScores_TournamentNotFound_Returns404) {
+    crow::request request;
+    request.body = R"([{"matchId":"m1","score":{"home":1,"visitor":1}}])";
+
+    EXPECT_CALL(*matchDelegateMock, UpdateScores(::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(std::optional<std::string>("tournament_not_found")));
+
+    auto response = matchController->UpdateMatchScores(request, "missing");
+
+    EXPECT_EQ(response.code, crow::NOT_FOUND);
+}
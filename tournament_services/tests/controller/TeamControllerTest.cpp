@@ -8,16 +8,24 @@
 #include "domain/Team.hpp"
 #include "delegate/ITeamDelegate.hpp"
 #include "controller/TeamController.hpp"
+#include "configuration/RouteDefinition.hpp"
+#include "util/Uuid.hpp"
 
 using ::testing::_;
 using ::testing::Eq;
 using ::testing::Return;
 
+namespace {
+    const util::Uuid TeamId = *util::Uuid::Parse("aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+}
+
 class TeamDelegateMock : public ITeamDelegate {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Team>, GetTeam, (const std::string& id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, GetAllTeams, (), (override));
     MOCK_METHOD(std::string, SaveTeam, (const domain::Team&), (override));
+    MOCK_METHOD(std::optional<std::string>, SaveTeams,
+                (const std::vector<domain::Team>&, std::vector<std::string>&), (override));
     MOCK_METHOD(std::optional<std::string>, UpdateTeam, (const domain::Team&), (const, override));
 };
 
@@ -32,21 +40,24 @@ protected:
     }
 };
 
+// El formato lo valida la ruta (RouteParam<util::Uuid>) antes de llegar al controlador
 TEST_F(TeamControllerTest, GetTeamById_ErrorFormat) {
-    crow::response badRequest = teamController->getTeam("");
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
+    EXPECT_CALL(*teamDelegateMock, GetTeam(_)).Times(0);
+    crow::request request;
 
-    badRequest = teamController->getTeam("mfasd#*");
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
+    for (const std::string id : {"", "mfasd#*", "my-id"}) {
+        crow::response badRequest = dispatchRoute(teamController.get(), &TeamController::getTeam, request, id);
+        EXPECT_EQ(badRequest.code, crow::BAD_REQUEST) << id;
+    }
 }
 
 TEST_F(TeamControllerTest, GetTeamById) {
-    auto expectedTeam = std::make_shared<domain::Team>(domain::Team{"my-id", "Team Name"});
+    auto expectedTeam = std::make_shared<domain::Team>(domain::Team{TeamId.ToString(), "Team Name"});
 
-    EXPECT_CALL(*teamDelegateMock, GetTeam(Eq(std::string("my-id"))))
+    EXPECT_CALL(*teamDelegateMock, GetTeam(Eq(TeamId.ToString())))
         .WillOnce(Return(expectedTeam));
 
-    crow::response response = teamController->getTeam("my-id");
+    crow::response response = teamController->getTeam(TeamId);
     auto jsonResponse = nlohmann::json::parse(response.body);
 
     EXPECT_EQ(crow::OK, response.code);
@@ -55,10 +66,10 @@ TEST_F(TeamControllerTest, GetTeamById) {
 }
 
 TEST_F(TeamControllerTest, GetTeamNotFound) {
-    EXPECT_CALL(*teamDelegateMock, GetTeam(Eq(std::string("my-id"))))
+    EXPECT_CALL(*teamDelegateMock, GetTeam(Eq(TeamId.ToString())))
         .WillOnce(Return(nullptr));
 
-    crow::response response = teamController->getTeam("my-id");
+    crow::response response = teamController->getTeam(TeamId);
     EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
 
@@ -132,6 +143,71 @@ TEST_F(TeamControllerTest, GetAllTeams_200_Empty) {
     EXPECT_TRUE(j.empty());
 }
 
+TEST_F(TeamControllerTest, SaveTeams_201_IdsInRequestOrder) {
+    std::vector<domain::Team> captured;
+    EXPECT_CALL(*teamDelegateMock, SaveTeams(_, _))
+        .WillOnce(::testing::DoAll(
+            ::testing::SaveArg<0>(&captured),
+            ::testing::SetArgReferee<1>(std::vector<std::string>{"id-a", "id-b"}),
+            Return(std::nullopt)));
+
+    crow::request req;
+    req.body = R"([{"name":"A"},{"name":"B"}])";
+    auto resp = teamController->SaveTeams(req);
+
+    EXPECT_EQ(resp.code, crow::CREATED);
+    ASSERT_EQ(captured.size(), 2u);
+    EXPECT_EQ(captured[1].Name, "B");
+    EXPECT_EQ(resp.body, nlohmann::json::parse(
+        R"([{"id":"id-a","name":"A","status":201},{"id":"id-b","name":"B","status":201}])").dump());
+}
+
+TEST_F(TeamControllerTest, SaveTeams_207_ReportsDuplicatesPerItem) {
+    EXPECT_CALL(*teamDelegateMock, SaveTeams(_, _))
+        .WillOnce(::testing::DoAll(
+            ::testing::SetArgReferee<1>(std::vector<std::string>{"id-a", ""}),
+            Return(std::nullopt)));
+
+    crow::request req;
+    req.body = R"([{"name":"A"},{"name":"A"}])";
+    auto resp = teamController->SaveTeams(req);
+
+    EXPECT_EQ(resp.code, 207);
+    auto j = nlohmann::json::parse(resp.body);
+    ASSERT_EQ(j.size(), 2u);
+    EXPECT_EQ(j[0].at("id"), "id-a");
+    EXPECT_EQ(j[1].at("status"), 409);
+    EXPECT_EQ(j[1].at("error"), "duplicate team");
+    EXPECT_FALSE(j[1].contains("id"));
+}
+
+TEST_F(TeamControllerTest, SaveTeams_RejectsMalformedEmptyAndOversizedBodies) {
+    EXPECT_CALL(*teamDelegateMock, SaveTeams(_, _)).Times(0);
+
+    crow::request malformed;
+    malformed.body = R"({"name":"A"})";
+    EXPECT_EQ(teamController->SaveTeams(malformed).code, crow::BAD_REQUEST);
+
+    crow::request empty;
+    empty.body = "[]";
+    EXPECT_EQ(teamController->SaveTeams(empty).code, 422);
+
+    nlohmann::json many = nlohmann::json::array();
+    for (int i = 0; i < 257; ++i) many.push_back({{"name", "team-" + std::to_string(i)}});
+    crow::request oversized;
+    oversized.body = many.dump();
+    EXPECT_EQ(teamController->SaveTeams(oversized).code, 413);
+}
+
+TEST_F(TeamControllerTest, SaveTeams_InvalidName_422) {
+    EXPECT_CALL(*teamDelegateMock, SaveTeams(_, _))
+        .WillOnce(Return(std::make_optional<std::string>("invalid_team_name")));
+
+    crow::request req;
+    req.body = R"([{"name":""}])";
+    EXPECT_EQ(teamController->SaveTeams(req).code, 422);
+}
+
 // Suite separada para PATCH (puede ser TEST normal porque es OTRO test suite)
 TEST(TeamControllerPatchTest, UpdateTeam_204_and_404) {
     auto mock = std::make_shared<TeamDelegateMock>();
@@ -142,12 +218,12 @@ TEST(TeamControllerPatchTest, UpdateTeam_204_and_404) {
 
     EXPECT_CALL(*mock, UpdateTeam(::testing::_))
         .WillOnce(Return(std::nullopt));
-    auto ok = ctrl.UpdateTeam(req204, "aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    auto ok = ctrl.UpdateTeam(req204, TeamId);
     EXPECT_EQ(crow::NO_CONTENT, ok.code);
 
     crow::request req404; req404.body = body.dump();
     EXPECT_CALL(*mock, UpdateTeam(::testing::_))
         .WillOnce(Return(std::make_optional<std::string>("team_not_found")));
-    auto nf = ctrl.UpdateTeam(req404, "aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    auto nf = ctrl.UpdateTeam(req404, TeamId);
     EXPECT_EQ(crow::NOT_FOUND, nf.code);
 }
@@ -8,6 +8,12 @@
 #include "domain/Utilities.hpp"
 #include "delegate/ITournamentDelegate.hpp"
 #include "controller/TournamentController.hpp"
+#include "util/Uuid.hpp"
+
+namespace {
+    const util::Uuid TournamentId = *util::Uuid::Parse("aaaaaaaa-aaaa-aaaa-aaaa-aaaaaaaaaaaa");
+    const util::Uuid MissingTournamentId = *util::Uuid::Parse("bbbbbbbb-bbbb-bbbb-bbbb-bbbbbbbbbbbb");
+}
 
 class TournamentDelegateMock : public ITournamentDelegate {
 public:
@@ -47,7 +53,7 @@ TEST_F(TournamentControllerTest, CreateTournament_Success_Returns201) {
     crow::request request;
     request.body = tournamentJson.dump();
     EXPECT_CALL(*tournamentDelegateMock, CreateTournament(testing::_))
-        .WillOnce(testing::Return(std::expected<std::string, std::string>{"tourn-id-1"}));
+        .WillOnce(testing::Return(std::expected<std::string, std::string>{TournamentId.ToString()}));
     auto response = tournamentController->CreateTournament(request);
     EXPECT_EQ(response.code, crow::CREATED);
 }
@@ -103,19 +109,19 @@ TEST_F(TournamentControllerTest, CreateTournament_Duplicate_Returns409) {
 // Test: Successful GetById Tournament - HTTP 200
 TEST_F(TournamentControllerTest, GetTournamentById_200) {
     auto tournament = std::make_shared<domain::Tournament>("Copa Mundial 2026", domain::TournamentFormat(4, 8));
-    EXPECT_CALL(*tournamentDelegateMock, ReadById("tourn-id-1"))
+    EXPECT_CALL(*tournamentDelegateMock, ReadById(TournamentId.ToString()))
         .WillOnce(testing::Return(tournament));
     crow::request request; // request vacío
-    auto response = tournamentController->GetById(request, "tourn-id-1");
+    auto response = tournamentController->GetById(request, TournamentId);
     EXPECT_EQ(response.code, crow::OK);
 }
 
 // Test: GetById Tournament not found - HTTP 404
 TEST_F(TournamentControllerTest, GetTournamentById_404) {
-    EXPECT_CALL(*tournamentDelegateMock, ReadById("not-found"))
+    EXPECT_CALL(*tournamentDelegateMock, ReadById(MissingTournamentId.ToString()))
         .WillOnce(testing::Return(nullptr));
     crow::request request;
-    auto response = tournamentController->GetById(request, "not-found");
+    auto response = tournamentController->GetById(request, MissingTournamentId);
     EXPECT_EQ(response.code, crow::NOT_FOUND);
 }
 
@@ -143,9 +149,9 @@ TEST_F(TournamentControllerTest, UpdateTournament_204) {
     };
     crow::request request;
     request.body = tournamentJson.dump();
-    EXPECT_CALL(*tournamentDelegateMock, UpdateTournament("tourn-id-1", testing::_))
-        .WillOnce(testing::Return(std::expected<std::string, std::string>{"tourn-id-1"}));
-    auto response = tournamentController->UpdateTournament(request, "tourn-id-1");
+    EXPECT_CALL(*tournamentDelegateMock, UpdateTournament(TournamentId.ToString(), testing::_))
+        .WillOnce(testing::Return(std::expected<std::string, std::string>{TournamentId.ToString()}));
+    auto response = tournamentController->UpdateTournament(request, TournamentId);
     EXPECT_EQ(response.code, crow::NO_CONTENT);
 }
 
@@ -161,8 +167,8 @@ TEST_F(TournamentControllerTest, UpdateTournament_404) {
     };
     crow::request request;
     request.body = tournamentJson.dump();
-    EXPECT_CALL(*tournamentDelegateMock, UpdateTournament("not-found", testing::_))
+    EXPECT_CALL(*tournamentDelegateMock, UpdateTournament(MissingTournamentId.ToString(), testing::_))
         .WillOnce(testing::Return(std::unexpected("Tournament not found")));
-    auto response = tournamentController->UpdateTournament(request, "not-found");
+    auto response = tournamentController->UpdateTournament(request, MissingTournamentId);
     EXPECT_EQ(response.code, crow::NOT_FOUND);
 }
@@ -16,6 +16,10 @@ using ::testing::Return;
 using ::testing::DoAll;
 using ::testing::Invoke;
 
+// En un namespace anónimo: otros tests del mismo runner definen mocks con
+// estos nombres y firmas distintas
+namespace {
+
 class EventBusMock : public IEventBus {
 public:
     MOCK_METHOD(void, Publish, (std::string_view, const nlohmann::json&), (override));
@@ -32,11 +36,15 @@ public:
     MOCK_METHOD(std::optional<std::string>, GetGroups, (std::string_view, std::vector<std::shared_ptr<domain::Group>>&), (override));
     MOCK_METHOD(std::optional<std::string>, GetGroup, (std::string_view, std::string_view, std::shared_ptr<domain::Group>&), (override));
 
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, FindByTournamentId, (const std::string_view&), (override));
-    MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndGroupId, (const std::string_view&, const std::string_view&), (override));
-    MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndTeamId, (const std::string_view&, const std::string_view&), (override));
-    MOCK_METHOD(void, UpdateGroupAddTeam, (const std::string_view&, const std::shared_ptr<domain::Team>&), (override));
-    MOCK_METHOD(int, CountTeamsInGroup, (const std::string_view&), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, FindByTournamentId, (std::string_view), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndGroupId, (std::string_view, std::string_view), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndTeamId, (std::string_view, std::string_view), (override));
+    MOCK_METHOD(void, UpdateGroupAddTeam, (std::string_view, const std::shared_ptr<domain::Team>&), (override));
+    MOCK_METHOD(std::optional<std::string>, AddTeams, (std::string_view, const std::vector<std::string>&, int, std::vector<domain::Team>&), (override));
+    MOCK_METHOD(bool, ExistsGroupForTournament, (std::string_view), (override));
+    MOCK_METHOD(int, GroupsCountForTournament, (std::string_view), (override));
+    MOCK_METHOD(int, CountTeamsInGroup, (std::string_view), (override));
+    MOCK_METHOD(std::vector<domain::Team>, GetTeamsOfGroup, (std::string_view), (override));
 };
 
 class TournamentRepoMock : public ITournamentRepository {
@@ -52,11 +60,14 @@ class TeamRepoMock : public ITeamRepository {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string), (override));
     MOCK_METHOD(std::string, Create, (const domain::Team&), (override));
-    MOCK_METHOD<std::string, Update, (const domain::Team&), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Team&), (override));
     MOCK_METHOD(void, Delete, (std::string), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Team>&), (override));
 };
 
+}
+
 TEST(GroupDelegateEventsAndLimitsTest, CreateGroup_Publishes_Event) {
     auto gRepo = std::make_shared<GroupRepoMock>();
     auto tRepo = std::make_shared<TournamentRepoMock>();
@@ -108,10 +119,11 @@ TEST(GroupDelegateEventsAndLimitsTest, AddTeam_Publishes_Event_And_Respects_Limi
             }),
             Return(std::optional<std::string>{})
         ));
-    EXPECT_CALL(*gRepo, CountTeamsInGroup("g1")).WillOnce(Return(1)); // ya hay 1
-    EXPECT_CALL(*teamRepo, ReadById("team-1")).WillOnce(Return(std::make_shared<domain::Team>(domain::Team{"team-1","Team 1"})));
-    EXPECT_CALL(*gRepo, UpdateGroupAddTeam("g1", ::testing::_)).Times(1);
-    EXPECT_CALL(*bus, Publish(::testing::StrEq("group.team_added"), _)).Times(1);
+    // existencia y cupo (1 + 1 <= 2) los resuelve el repositorio en una sentencia
+    EXPECT_CALL(*gRepo, AddTeams("g1", std::vector<std::string>{"team-1"}, 2, _))
+        .WillOnce(DoAll(::testing::SetArgReferee<3>(std::vector<domain::Team>{{"team-1","Team 1"}}),
+                        Return(std::optional<std::string>{})));
+    EXPECT_CALL(*bus, Publish(::testing::StrEq("group.teams_added"), _)).Times(1);
 
     GroupDelegate delegate(gRepo, tRepo, teamRepo, bus);
 
@@ -143,7 +155,8 @@ TEST(GroupDelegateEventsAndLimitsTest, AddTeam_GroupFull) {
             }),
             Return(std::optional<std::string>{})
         ));
-    EXPECT_CALL(*gRepo, CountTeamsInGroup("g1")).WillOnce(Return(1)); // ya lleno
+    EXPECT_CALL(*gRepo, AddTeams("g1", _, 1, _)) // ya lleno
+        .WillOnce(Return(std::make_optional<std::string>("group_full")));
 
     GroupDelegate delegate(gRepo, tRepo, teamRepo, bus);
 
@@ -176,8 +189,8 @@ TEST(GroupDelegateEventsAndLimitsTest, AddTeam_TeamNotFound) {
             }),
             Return(std::optional<std::string>{})
         ));
-    EXPECT_CALL(*gRepo, CountTeamsInGroup("g1")).WillOnce(Return(0));
-    EXPECT_CALL(*teamRepo, ReadById("nope")).WillOnce(Return(nullptr));
+    EXPECT_CALL(*gRepo, AddTeams("g1", std::vector<std::string>{"nope"}, 3, _))
+        .WillOnce(Return(std::make_optional<std::string>("team_not_found")));
 
     GroupDelegate delegate(gRepo, tRepo, teamRepo, bus);
 
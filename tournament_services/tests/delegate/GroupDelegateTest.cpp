@@ -5,7 +5,10 @@
 #include <memory>
 #include <vector>
 
+#include "delegate/GroupDelegate.hpp"
 #include "delegate/IGroupDelegate.hpp"
+#include "messaging/IEventBus.hpp"
+#include "persistence/repository/IGroupRepository.hpp"
 #include "domain/Group.hpp"
 #include "domain/Team.hpp"
 
@@ -178,3 +181,81 @@ TEST(GroupDelegate, UpdateGroup_Fails) {
     EXPECT_TRUE(result.has_value());
     EXPECT_EQ(result.value(), "group_not_found");
 }
+
+// --- GroupDelegate real: altas por lote contra el repositorio ---
+
+class GroupRepoMock : public IGroupRepository {
+public:
+    MOCK_METHOD(std::string, Create, (const domain::Group&), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Group>, ReadById, (std::string), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, ReadAll, (), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Group&), (override));
+    MOCK_METHOD(void, Delete, (std::string), (override));
+    MOCK_METHOD(std::optional<std::string>, GetGroups, (std::string_view, std::vector<std::shared_ptr<domain::Group>>&), (override));
+    MOCK_METHOD(std::optional<std::string>, GetGroup, (std::string_view, std::string_view, std::shared_ptr<domain::Group>&), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, FindByTournamentId, (std::string_view), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndGroupId, (std::string_view, std::string_view), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndTeamId, (std::string_view, std::string_view), (override));
+    MOCK_METHOD(void, UpdateGroupAddTeam, (std::string_view, const std::shared_ptr<domain::Team>&), (override));
+    MOCK_METHOD(std::optional<std::string>, AddTeams, (std::string_view, const std::vector<std::string>&, int, std::vector<domain::Team>&), (override));
+    MOCK_METHOD(bool, ExistsGroupForTournament, (std::string_view), (override));
+    MOCK_METHOD(int, GroupsCountForTournament, (std::string_view), (override));
+    MOCK_METHOD(int, CountTeamsInGroup, (std::string_view), (override));
+    MOCK_METHOD(std::vector<domain::Team>, GetTeamsOfGroup, (std::string_view), (override));
+};
+
+class EventBusMock : public IEventBus {
+public:
+    MOCK_METHOD(void, Publish, (std::string_view, const nlohmann::json&), (override));
+};
+
+class GroupDelegateUpdateTeamsTest : public ::testing::Test {
+protected:
+    std::shared_ptr<GroupRepoMock> repo = std::make_shared<GroupRepoMock>();
+    std::shared_ptr<EventBusMock> bus = std::make_shared<EventBusMock>();
+    GroupDelegate delegate{repo, nullptr, nullptr, bus};
+
+    void SetUp() override {
+        ON_CALL(*repo, GetGroup("t-1", "g-1", _))
+            .WillByDefault(DoAll(SetArgReferee<2>(std::make_shared<domain::Group>("g-1", "Group 1")),
+                                 Return(std::nullopt)));
+        EXPECT_CALL(*repo, GetGroup("t-1", "g-1", _)).Times(::testing::AtMost(1));
+    }
+};
+
+TEST_F(GroupDelegateUpdateTeamsTest, AddsWholeBatchInOneCallAndPublishesOneEvent) {
+    std::vector<domain::Team> teams{{"id-1", "Team 1"}, {"id-2", "Team 2"}, {"id-3", "Team 3"}};
+
+    EXPECT_CALL(*repo, CountTeamsInGroup(_)).Times(0);
+    EXPECT_CALL(*repo, UpdateGroupAddTeam(_, _)).Times(0);
+    EXPECT_CALL(*repo, AddTeams("g-1", std::vector<std::string>{"id-1", "id-2", "id-3"}, 16, _))
+        .WillOnce(DoAll(SetArgReferee<3>(std::vector<domain::Team>{{"id-1", "Team 1"}, {"id-3", "Team 3"}}),
+                        Return(std::nullopt)));
+
+    nlohmann::json published;
+    EXPECT_CALL(*bus, Publish(std::string_view("group.teams_added"), _))
+        .WillOnce(::testing::SaveArg<1>(&published));
+
+    EXPECT_FALSE(delegate.UpdateTeams("t-1", "g-1", teams).has_value());
+    EXPECT_EQ(published.at("groupId"), "g-1");
+    ASSERT_EQ(published.at("teams").size(), 2u);
+    EXPECT_EQ(published.at("teams")[1].at("id"), "id-3");
+}
+
+TEST_F(GroupDelegateUpdateTeamsTest, RepositoryRejection_NoEvent) {
+    EXPECT_CALL(*repo, AddTeams("g-1", _, _, _))
+        .WillOnce(Return(std::make_optional<std::string>("group_full")));
+    EXPECT_CALL(*bus, Publish(_, _)).Times(0);
+
+    auto err = delegate.UpdateTeams("t-1", "g-1", {{"id-1", "Team 1"}});
+    ASSERT_TRUE(err.has_value());
+    EXPECT_EQ(*err, "group_full");
+}
+
+TEST_F(GroupDelegateUpdateTeamsTest, AlreadyMembers_NoEvent) {
+    EXPECT_CALL(*repo, AddTeams("g-1", _, _, _))
+        .WillOnce(DoAll(SetArgReferee<3>(std::vector<domain::Team>{}), Return(std::nullopt)));
+    EXPECT_CALL(*bus, Publish(_, _)).Times(0);
+
+    EXPECT_FALSE(delegate.UpdateTeams("t-1", "g-1", {{"id-1", "Team 1"}}).has_value());
+}
@@ -5,7 +5,7 @@
 
 #include "delegate/MatchDelegate.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 #include "persistence/repository/ITournamentRepository.hpp"
 #include "messaging/IEventBus.hpp"
 #include "domain/Match.hpp"
@@ -29,18 +29,28 @@ public:
                 (std::string_view tournamentId, std::string_view matchId), 
                 (override));
     MOCK_METHOD(bool, UpdateScore, (std::string_view matchId, int homeScore, int awayScore), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, UpdateScores,
+                (std::string_view tournamentId, const std::vector<ScoreUpdate>& updates), (override));
+    MOCK_METHOD(ScoreUpdateOutcome, UpdateScoreReturning,
+                (std::string_view tournamentId, const ScoreUpdate& update), (override));
+    MOCK_METHOD(bool, CreateFixtures,
+                (std::string_view tournamentId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(bool, ApplyScoreEffects,
+                (std::string_view consumer, std::string_view eventId, std::string_view tournamentId,
+                 const ScoreEffects& effects), (override));
     MOCK_METHOD(int, CountCompletedMatchesByTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(int, CountTotalMatchesByTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByGroupId, (std::string_view groupId), (override));
 };
 
-class MockTeamRepository : public IRepository<domain::Team, std::string_view> {
+class MockTeamRepository : public ITeamRepository {
 public:
-    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string_view id), (override));
-    MOCK_METHOD(std::string_view, Create, (const domain::Team& entity), (override));
-    MOCK_METHOD(std::string_view, Update, (const domain::Team& entity), (override));
-    MOCK_METHOD(void, Delete, (std::string_view id), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string id), (override));
+    MOCK_METHOD(std::string, Create, (const domain::Team& entity), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Team& entity), (override));
+    MOCK_METHOD(void, Delete, (std::string id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Team>& entities), (override));
 };
 
 class MockTournamentRepository : public ITournamentRepository {
@@ -57,6 +67,10 @@ public:
     MOCK_METHOD(void, Publish, (std::string_view topic, const nlohmann::json& payload), (override));
 };
 
+MATCHER_P3(ScoreIs, matchId, homeScore, awayScore, "") {
+    return arg.matchId == matchId && arg.homeScore == homeScore && arg.awayScore == awayScore;
+}
+
 class MatchDelegateTest : public ::testing::Test {
 protected:
     std::shared_ptr<MockMatchRepository> mockMatchRepo;
@@ -228,6 +242,7 @@ TEST_F(MatchDelegateTest, GetMatch_NotFound_ReturnsError) {
 
 // Test: UpdateScore - Success with valid scores
 TEST_F(MatchDelegateTest, UpdateScore_ValidScores_Success) {
+    int version = 0;
     auto match = std::make_shared<domain::Match>();
     match->Id = "match-1";
     match->TournamentId = "tourn-1";
@@ -235,23 +250,21 @@ TEST_F(MatchDelegateTest, UpdateScore_ValidScores_Success) {
     match->HomeTeamId = "team-1";
     match->AwayTeamId = "team-2";
     
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "match-1"))
-        .WillOnce(::testing::Return(match));
-    
-    EXPECT_CALL(*mockMatchRepo, UpdateScore("match-1", 3, 2))
-        .WillOnce(::testing::Return(true));
+    EXPECT_CALL(*mockMatchRepo, UpdateScoreReturning("tourn-1", ScoreIs("match-1", 3, 2)))
+        .WillOnce(::testing::Return(ScoreUpdateOutcome(match)));
     
     EXPECT_CALL(*mockEventBus, Publish("match.score_updated", ::testing::_))
         .Times(1);
     
-    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 3, 2);
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 3, 2, std::nullopt, version);
     
     EXPECT_FALSE(error.has_value());
 }
 
 // Test: UpdateScore - Reject negative home score
 TEST_F(MatchDelegateTest, UpdateScore_NegativeHomeScore_ReturnsError) {
-    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", -1, 2);
+    int version = 0;
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", -1, 2, std::nullopt, version);
     
     EXPECT_TRUE(error.has_value());
     EXPECT_EQ(*error, "invalid_score");
@@ -259,7 +272,8 @@ TEST_F(MatchDelegateTest, UpdateScore_NegativeHomeScore_ReturnsError) {
 
 // Test: UpdateScore - Reject negative away score
 TEST_F(MatchDelegateTest, UpdateScore_NegativeAwayScore_ReturnsError) {
-    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 2, -1);
+    int version = 0;
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 2, -1, std::nullopt, version);
     
     EXPECT_TRUE(error.has_value());
     EXPECT_EQ(*error, "invalid_score");
@@ -267,32 +281,31 @@ TEST_F(MatchDelegateTest, UpdateScore_NegativeAwayScore_ReturnsError) {
 
 // Test: UpdateScore - Accept zero scores
 TEST_F(MatchDelegateTest, UpdateScore_ZeroScores_Success) {
+    int version = 0;
     auto match = std::make_shared<domain::Match>();
     match->Id = "match-1";
     match->GroupId = "group-1";
     match->HomeTeamId = "team-1";
     match->AwayTeamId = "team-2";
     
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "match-1"))
-        .WillOnce(::testing::Return(match));
-    
-    EXPECT_CALL(*mockMatchRepo, UpdateScore("match-1", 0, 0))
-        .WillOnce(::testing::Return(true));
+    EXPECT_CALL(*mockMatchRepo, UpdateScoreReturning("tourn-1", ScoreIs("match-1", 0, 0)))
+        .WillOnce(::testing::Return(ScoreUpdateOutcome(match)));
     
     EXPECT_CALL(*mockEventBus, Publish(::testing::_, ::testing::_))
         .Times(1);
     
-    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 0, 0);
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 0, 0, std::nullopt, version);
     
     EXPECT_FALSE(error.has_value());
 }
 
 // Test: UpdateScore - Match not found
 TEST_F(MatchDelegateTest, UpdateScore_MatchNotFound_ReturnsError) {
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "invalid-match"))
-        .WillOnce(::testing::Return(nullptr));
+    int version = 0;
+    EXPECT_CALL(*mockMatchRepo, UpdateScoreReturning("tourn-1", ScoreIs("invalid-match", 1, 1)))
+        .WillOnce(::testing::Return(ScoreUpdateOutcome(std::unexpected(ScoreUpdateError::NotFound))));
     
-    auto error = matchDelegate->UpdateScore("tourn-1", "invalid-match", 1, 1);
+    auto error = matchDelegate->UpdateScore("tourn-1", "invalid-match", 1, 1, std::nullopt, version);
     
     EXPECT_TRUE(error.has_value());
     EXPECT_EQ(*error, "match_not_found");
@@ -300,19 +313,11 @@ TEST_F(MatchDelegateTest, UpdateScore_MatchNotFound_ReturnsError) {
 
 // Test: UpdateScore - Database error
 TEST_F(MatchDelegateTest, UpdateScore_DatabaseError_ReturnsError) {
-    auto match = std::make_shared<domain::Match>();
-    match->Id = "match-1";
-    match->GroupId = "group-1";
-    match->HomeTeamId = "team-1";
-    match->AwayTeamId = "team-2";
+    int version = 0;
+    EXPECT_CALL(*mockMatchRepo, UpdateScoreReturning("tourn-1", ScoreIs("match-1", 1, 1)))
+        .WillOnce(::testing::Throw(std::runtime_error("connection lost")));
     
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "match-1"))
-        .WillOnce(::testing::Return(match));
-    
-    EXPECT_CALL(*mockMatchRepo, UpdateScore("match-1", 1, 1))
-        .WillOnce(::testing::Return(false));
-    
-    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 1, 1);
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 1, 1, std::nullopt, version);
     
     EXPECT_TRUE(error.has_value());
     EXPECT_EQ(*error, "database_error");
@@ -320,6 +325,7 @@ TEST_F(MatchDelegateTest, UpdateScore_DatabaseError_ReturnsError) {
 
 // Test: UpdateScore - Event published with correct data
 TEST_F(MatchDelegateTest, UpdateScore_PublishesEventWithCorrectData) {
+    int version = 0;
     auto match = std::make_shared<domain::Match>();
     match->Id = "match-1";
     match->TournamentId = "tourn-1";
@@ -327,11 +333,8 @@ TEST_F(MatchDelegateTest, UpdateScore_PublishesEventWithCorrectData) {
     match->HomeTeamId = "team-1";
     match->AwayTeamId = "team-2";
     
-    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId("tourn-1", "match-1"))
-        .WillOnce(::testing::Return(match));
-    
-    EXPECT_CALL(*mockMatchRepo, UpdateScore("match-1", 2, 3))
-        .WillOnce(::testing::Return(true));
+    EXPECT_CALL(*mockMatchRepo, UpdateScoreReturning("tourn-1", ScoreIs("match-1", 2, 3)))
+        .WillOnce(::testing::Return(ScoreUpdateOutcome(match)));
     
     EXPECT_CALL(*mockEventBus, Publish("match.score_updated", ::testing::_))
         .WillOnce(::testing::Invoke([](std::string_view topic, const nlohmann::json& payload) {
@@ -345,9 +348,101 @@ TEST_F(MatchDelegateTest, UpdateScore_PublishesEventWithCorrectData) {
             EXPECT_EQ(payload["awayScore"], 3);
         }));
     
-    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 2, 3);
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 2, 3, std::nullopt, version);
     
     EXPECT_FALSE(error.has_value());
 }
 
+// Test: UpdateScore - Stale If-Match version is reported, nothing published
+TEST_F(MatchDelegateTest, UpdateScore_VersionConflict_ReturnsError) {
+    int version = 0;
+    EXPECT_CALL(*mockMatchRepo, UpdateScoreReturning("tourn-1", ::testing::AllOf(
+            ScoreIs("match-1", 1, 0), ::testing::Field(&ScoreUpdate::expectedVersion, std::optional<int>(4)))))
+        .WillOnce(::testing::Return(ScoreUpdateOutcome(std::unexpected(ScoreUpdateError::VersionConflict))));
+    EXPECT_CALL(*mockEventBus, Publish(::testing::_, ::testing::_)).Times(0);
+
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 1, 0, 4, version);
+
+    ASSERT_TRUE(error.has_value());
+    EXPECT_EQ(*error, "version_conflict");
+}
+
+// Test: UpdateScore - New version from RETURNING is handed back for the ETag
+TEST_F(MatchDelegateTest, UpdateScore_ReturnsNewVersion) {
+    auto match = std::make_shared<domain::Match>();
+    match->Id = "match-1";
+    match->Version = 5;
+    int version = 0;
+
+    EXPECT_CALL(*mockMatchRepo, UpdateScoreReturning("tourn-1", ScoreIs("match-1", 2, 2)))
+        .WillOnce(::testing::Return(ScoreUpdateOutcome(match)));
+    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*mockEventBus, Publish(::testing::_, ::testing::_)).Times(1);
+
+    auto error = matchDelegate->UpdateScore("tourn-1", "match-1", 2, 2, 4, version);
+
+    EXPECT_FALSE(error.has_value());
+    EXPECT_EQ(version, 5);
+}
+
+// Test: UpdateScores - One repository call, events from RETURNING rows, unknown ids reported
+TEST_F(MatchDelegateTest, UpdateScores_AppliesBatchAndReportsUnknownIds) {
+    auto tournament = std::make_shared<domain::Tournament>("Tournament 1");
+    tournament->Id() = "tourn-1";
+
+    auto updated = std::make_shared<domain::Match>();
+    updated->Id = "match-1";
+    updated->TournamentId = "tourn-1";
+    updated->GroupId = "group-1";
+    updated->HomeTeamId = "team-1";
+    updated->AwayTeamId = "team-2";
+    updated->SetScore(4, 2);
+
+    std::vector<ScoreUpdate> updates = {{"MATCH-1", 4, 2, std::nullopt}, {"match-9", 1, 1, std::nullopt}};
+
+    EXPECT_CALL(*mockTournamentRepo, ReadById("tourn-1"))
+        .WillOnce(::testing::Return(tournament));
+    EXPECT_CALL(*mockMatchRepo, UpdateScores(std::string_view("tourn-1"), ::testing::SizeIs(2)))
+        .WillOnce(::testing::Return(std::vector<std::shared_ptr<domain::Match>>{updated}));
+    EXPECT_CALL(*mockMatchRepo, FindByTournamentIdAndMatchId(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*mockEventBus, Publish("match.score_updated", ::testing::_))
+        .WillOnce(::testing::Invoke([](std::string_view, const nlohmann::json& payload) {
+            EXPECT_EQ(payload["matchId"], "match-1");
+            EXPECT_EQ(payload["groupId"], "group-1");
+            EXPECT_EQ(payload["homeScore"], 4);
+            EXPECT_EQ(payload["awayScore"], 2);
+        }));
+
+    std::vector<std::string> notFound;
+    auto error = matchDelegate->UpdateScores("tourn-1", updates, notFound);
 
+    EXPECT_FALSE(error.has_value());
+    EXPECT_EQ(notFound, std::vector<std::string>{"match-9"});
+}
+
+// Test: UpdateScores - A negative score rejects the whole batch
+TEST_F(MatchDelegateTest, UpdateScores_NegativeScore_RejectsBatch) {
+    std::vector<ScoreUpdate> updates = {{"match-1", 1, 0, std::nullopt}, {"match-2", -1, 0, std::nullopt}};
+    EXPECT_CALL(*mockMatchRepo, UpdateScores(::testing::_, ::testing::_)).Times(0);
+
+    std::vector<std::string> notFound;
+    auto error = matchDelegate->UpdateScores("tourn-1", updates, notFound);
+
+    ASSERT_TRUE(error.has_value());
+    EXPECT_EQ(*error, "invalid_score");
+}
+
+// Test: UpdateScores - Repository failure maps to database_error
+TEST_F(MatchDelegateTest, UpdateScores_DatabaseError_ReturnsError) {
+    auto tournament = std::make_shared<domain::Tournament>("Tournament 1");
+    EXPECT_CALL(*mockTournamentRepo, ReadById("tourn-1"))
+        .WillOnce(::testing::Return(tournament));
+    EXPECT_CALL(*mockMatchRepo, UpdateScores(::testing::_, ::testing::_))
+        .WillOnce(::testing::Throw(std::runtime_error("connection lost")));
+
+    std::vector<std::string> notFound;
+    auto error = matchDelegate->UpdateScores("tourn-1", {{"match-1", 1, 0, std::nullopt}}, notFound);
+
+    ASSERT_TRUE(error.has_value());
+    EXPECT_EQ(*error, "database_error");
+}
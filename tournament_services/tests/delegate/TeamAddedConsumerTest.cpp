@@ -37,6 +37,8 @@ public:
 
     MOCK_METHOD(void, UpdateGroupAddTeam,
                 (std::string_view, const std::shared_ptr<domain::Team>&), (override));
+    MOCK_METHOD(std::optional<std::string>, AddTeams,
+                (std::string_view, const std::vector<std::string>&, int, std::vector<domain::Team>&), (override));
 
     MOCK_METHOD(bool, ExistsGroupForTournament, (std::string_view), (override));
     MOCK_METHOD(int, GroupsCountForTournament, (std::string_view), (override));
@@ -1,15 +1,16 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "delegate/TeamDelegate.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 
-class TeamRepoMock : public IRepository<domain::Team, std::string_view> {
+class TeamRepoMock : public ITeamRepository {
 public:
-    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string_view), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
-    MOCK_METHOD(std::string_view, Create, (const domain::Team&), (override));
-    MOCK_METHOD(std::string_view, Update, (const domain::Team&), (override));
-    MOCK_METHOD(void, Delete, (std::string_view), (override));
+    MOCK_METHOD(std::string, Create, (const domain::Team&), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Team&), (override));
+    MOCK_METHOD(void, Delete, (std::string), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateMany, (const std::vector<domain::Team>&), (override));
 };
 
 TEST(TeamDelegate, SaveTeam_CallsRepoCreate) {
@@ -105,3 +106,30 @@ TEST(TeamDelegate, UpdateTeam_Success) {
     auto r = sut.UpdateTeam(t);
     EXPECT_FALSE(r.has_value());
 }
+
+TEST(TeamDelegate, SaveTeams_InsertsWholeBatchOnce) {
+    auto repo = std::make_shared<TeamRepoMock>();
+    EXPECT_CALL(*repo, Create(::testing::_)).Times(0);
+    EXPECT_CALL(*repo, CreateMany(::testing::SizeIs(3)))
+        .WillOnce(::testing::Return(std::vector<std::string>{"id-a", "", "id-c"}));
+    TeamDelegate sut(repo);
+
+    std::vector<std::string> ids;
+    auto err = sut.SaveTeams({{"", "A"}, {"", "B"}, {"", "C"}}, ids);
+
+    EXPECT_FALSE(err.has_value());
+    EXPECT_EQ(ids, (std::vector<std::string>{"id-a", "", "id-c"}));
+}
+
+TEST(TeamDelegate, SaveTeams_EmptyName_RejectsBatch) {
+    auto repo = std::make_shared<TeamRepoMock>();
+    EXPECT_CALL(*repo, CreateMany(::testing::_)).Times(0);
+    TeamDelegate sut(repo);
+
+    std::vector<std::string> ids;
+    auto err = sut.SaveTeams({{"", "A"}, {"", ""}}, ids);
+
+    ASSERT_TRUE(err.has_value());
+    EXPECT_EQ(*err, "invalid_team_name");
+    EXPECT_TRUE(ids.empty());
+}
@@ -33,6 +33,7 @@ public:
     MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndGroupId, (std::string_view tournamentId, std::string_view groupId), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndTeamId, (std::string_view tournamentId, std::string_view teamId), (override));
     MOCK_METHOD(void, UpdateGroupAddTeam, (std::string_view groupId, const std::shared_ptr<domain::Team>& team), (override));
+    MOCK_METHOD(std::optional<std::string>, AddTeams, (std::string_view groupId, const std::vector<std::string>& teamIds, int maxTeams, std::vector<domain::Team>& outAdded), (override));
     MOCK_METHOD(bool, ExistsGroupForTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(int, GroupsCountForTournament, (std::string_view tournamentId), (override));
     MOCK_METHOD(int, CountTeamsInGroup, (std::string_view groupId), (override));
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "dto/RequestDecoders.hpp"
+
+using dto::DecodeError;
+
+TEST(RequestDecoders, TeamReadsIdAndNameAndIgnoresUnknownFields) {
+    auto team = dto::DecodeTeam(R"({"id":"t1","name":"Tigres","extra":{"name":1}})");
+    ASSERT_TRUE(team.has_value());
+    EXPECT_EQ(team->Id, "t1");
+    EXPECT_EQ(team->Name, "Tigres");
+}
+
+TEST(RequestDecoders, TeamReportsSyntaxPosition) {
+    auto team = dto::DecodeTeam(R"({"name":"Tigres",})");
+    ASSERT_FALSE(team.has_value());
+    EXPECT_EQ(team.error().kind, DecodeError::Kind::Syntax);
+    EXPECT_GT(team.error().position, 0u);
+}
+
+TEST(RequestDecoders, TeamRejectsWrongTypes) {
+    auto team = dto::DecodeTeam(R"({"name":42})");
+    ASSERT_FALSE(team.has_value());
+    EXPECT_EQ(team.error().kind, DecodeError::Kind::InvalidType);
+    EXPECT_EQ(team.error().field, "name");
+
+    auto notObject = dto::DecodeTeam(R"(["name"])");
+    ASSERT_FALSE(notObject.has_value());
+    EXPECT_EQ(notObject.error().kind, DecodeError::Kind::InvalidType);
+}
+
+TEST(RequestDecoders, TeamListDecodesEveryElement) {
+    auto teams = dto::DecodeTeams(R"([{"id":"a","name":"A"},{"name":"B"}])");
+    ASSERT_TRUE(teams.has_value());
+    ASSERT_EQ(teams->size(), 2u);
+    EXPECT_EQ((*teams)[0].Id, "a");
+    EXPECT_EQ((*teams)[1].Name, "B");
+
+    auto bad = dto::DecodeTeams(R"([{"id":"a"}, "b"])");
+    ASSERT_FALSE(bad.has_value());
+    EXPECT_EQ(bad.error().field, "[]");
+}
+
+TEST(RequestDecoders, GroupDecodesNestedTeams) {
+    auto group = dto::DecodeGroup(R"({"name":"G1","tournamentId":"x","teams":[{"id":"t1","name":"T1"}]})");
+    ASSERT_TRUE(group.has_value());
+    EXPECT_EQ(group->Name(), "G1");
+    EXPECT_EQ(group->TournamentId(), "x");
+    ASSERT_EQ(group->Teams().size(), 1u);
+    EXPECT_EQ(group->Teams()[0].Id, "t1");
+
+    auto bad = dto::DecodeGroup(R"({"name":"G1","teams":[{"id":7}]})");
+    ASSERT_FALSE(bad.has_value());
+    EXPECT_EQ(bad.error().field, "teams[].id");
+}
+
+TEST(RequestDecoders, TournamentCreateReadsFormat) {
+    auto request = dto::DecodeTournamentCreate(
+        R"({"name":"Copa","format":{"maxTeamsPerGroup":4,"numberOfGroups":8,"type":"NFL"}})");
+    ASSERT_TRUE(request.has_value());
+    EXPECT_EQ(request->name, "Copa");
+    EXPECT_EQ(request->format.NumberOfGroups(), 8);
+    EXPECT_EQ(request->format.MaxTeamsPerGroup(), 4);
+    EXPECT_EQ(request->format.Type(), domain::TournamentType::NFL);
+
+    auto legacy = dto::DecodeTournamentCreate(R"({"name":"Copa","groupsCount":2,"maxTeamsPerGroup":5})");
+    ASSERT_TRUE(legacy.has_value());
+    EXPECT_EQ(legacy->format.NumberOfGroups(), 2);
+    EXPECT_EQ(legacy->format.MaxTeamsPerGroup(), 5);
+
+    auto bad = dto::DecodeTournamentCreate(R"({"name":"Copa","format":{"numberOfGroups":"8"}})");
+    ASSERT_FALSE(bad.has_value());
+    EXPECT_EQ(bad.error().field, "format.numberOfGroups");
+}
+
+TEST(RequestDecoders, ScoreUpdateRequiresBothScores) {
+    auto score = dto::DecodeScoreUpdate(R"({"score":{"home":3,"visitor":1}})");
+    ASSERT_TRUE(score.has_value());
+    EXPECT_EQ(score->home, 3);
+    EXPECT_EQ(score->visitor, 1);
+
+    auto missingScore = dto::DecodeScoreUpdate(R"({"other_field":"value"})");
+    ASSERT_FALSE(missingScore.has_value());
+    EXPECT_EQ(missingScore.error().kind, DecodeError::Kind::MissingField);
+    EXPECT_EQ(missingScore.error().field, "score");
+
+    auto missingVisitor = dto::DecodeScoreUpdate(R"({"score":{"home":3}})");
+    ASSERT_FALSE(missingVisitor.has_value());
+    EXPECT_EQ(missingVisitor.error().field, "score.visitor");
+
+    auto overflow = dto::DecodeScoreUpdate(R"({"score":{"home":99999999999,"visitor":1}})");
+    ASSERT_FALSE(overflow.has_value());
+    EXPECT_EQ(overflow.error().kind, DecodeError::Kind::InvalidType);
+}
+
+TEST(RequestDecoders, ScoreBatchDecodesEveryItem) {
+    auto batch = dto::DecodeScoreBatch(
+        R"([{"matchId":"m1","score":{"home":3,"visitor":1}},{"score":{"visitor":0,"home":2},"matchId":"m2"}])");
+    ASSERT_TRUE(batch.has_value());
+    ASSERT_EQ(batch->size(), 2u);
+    EXPECT_EQ((*batch)[0].matchId, "m1");
+    EXPECT_EQ((*batch)[0].homeScore, 3);
+    EXPECT_EQ((*batch)[0].awayScore, 1);
+    EXPECT_EQ((*batch)[1].matchId, "m2");
+    EXPECT_EQ((*batch)[1].homeScore, 2);
+    EXPECT_EQ((*batch)[1].awayScore, 0);
+
+    auto missingVisitor = dto::DecodeScoreBatch(R"([{"matchId":"m1","score":{"home":3,"visitor":1}},{"matchId":"m2","score":{"home":3}}])");
+    ASSERT_FALSE(missingVisitor.has_value());
+    EXPECT_EQ(missingVisitor.error().kind, DecodeError::Kind::MissingField);
+    EXPECT_EQ(missingVisitor.error().field, "[].score.visitor");
+
+    auto badId = dto::DecodeScoreBatch(R"([{"matchId":7,"score":{"home":3,"visitor":1}}])");
+    ASSERT_FALSE(badId.has_value());
+    EXPECT_EQ(badId.error().field, "[].matchId");
+
+    auto notArray = dto::DecodeScoreBatch(R"({"matchId":"m1"})");
+    ASSERT_FALSE(notArray.has_value());
+    EXPECT_EQ(notArray.error().kind, DecodeError::Kind::InvalidType);
+}
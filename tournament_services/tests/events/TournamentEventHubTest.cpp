@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "events/TournamentEventHub.hpp"
+
+using events::TournamentEventHub;
+
+namespace {
+    struct FakeConnection : crow::websocket::connection {
+        std::vector<std::string> sent;
+
+        void send_binary(std::string) override {}
+        void send_text(std::string msg) override { sent.push_back(std::move(msg)); }
+        void send_ping(std::string) override {}
+        void send_pong(std::string) override {}
+        void close(std::string const&, uint16_t) override {}
+        std::string get_remote_ip() override { return "127.0.0.1"; }
+        std::string get_subprotocol() const override { return ""; }
+    };
+}
+
+TEST(TournamentEventHub, DeliversOnlyToSubscribersOfTheTournament) {
+    TournamentEventHub hub;
+    FakeConnection a, b, other;
+    hub.Subscribe("t1", a);
+    hub.Subscribe("t1", b);
+    hub.Subscribe("t2", other);
+
+    EXPECT_EQ(hub.Broadcast("t1", R"({"type":"match.score_updated"})"), 2u);
+
+    ASSERT_EQ(a.sent.size(), 1u);
+    EXPECT_EQ(a.sent[0], R"({"type":"match.score_updated"})");
+    EXPECT_EQ(b.sent.size(), 1u);
+    EXPECT_TRUE(other.sent.empty());
+    EXPECT_EQ(hub.Broadcast("t3", "{}"), 0u);
+}
+
+TEST(TournamentEventHub, UnsubscribeStopsDeliveryAndDropsEmptyChannels) {
+    TournamentEventHub hub;
+    FakeConnection a, b, c;
+    hub.Subscribe("t1", a);
+    hub.Subscribe("t1", b);
+    hub.Subscribe("t1", c);
+
+    hub.Unsubscribe(a);
+    hub.Unsubscribe(a);  // onclose puede llegar dos veces
+    hub.Broadcast("t1", "x");
+    EXPECT_TRUE(a.sent.empty());
+    EXPECT_EQ(b.sent.size(), 1u);
+    EXPECT_EQ(c.sent.size(), 1u);
+
+    hub.Unsubscribe(c);
+    hub.Unsubscribe(b);
+    EXPECT_EQ(hub.Subscribers(), 0u);
+    EXPECT_EQ(hub.Subscribers("t1"), 0u);
+    EXPECT_EQ(hub.Broadcast("t1", "x"), 0u);
+}
+
+TEST(TournamentEventHub, HandlesManySubscribersAndChurn) {
+    TournamentEventHub hub;
+    std::vector<std::unique_ptr<FakeConnection>> connections;
+    for (int i = 0; i < 20'000; ++i) {
+        connections.push_back(std::make_unique<FakeConnection>());
+        hub.Subscribe("t1", *connections.back());
+    }
+    for (int i = 0; i < 20'000; i += 2) {
+        hub.Unsubscribe(*connections[i]);
+    }
+
+    EXPECT_EQ(hub.Broadcast("t1", "x"), 10'000u);
+    EXPECT_TRUE(connections[0]->sent.empty());
+    EXPECT_EQ(connections[1]->sent.size(), 1u);
+    EXPECT_EQ(connections[19'999]->sent.size(), 1u);
+}
+
+TEST(TournamentEventHub, SubscribeAndBroadcastConcurrently) {
+    TournamentEventHub hub;
+    std::vector<std::unique_ptr<FakeConnection>> connections;
+    for (int i = 0; i < 64; ++i) connections.push_back(std::make_unique<FakeConnection>());
+
+    std::thread churn([&] {
+        for (int round = 0; round < 50; ++round) {
+            for (auto& connection : connections) hub.Subscribe("t1", *connection);
+            for (auto& connection : connections) hub.Unsubscribe(*connection);
+        }
+    });
+    std::thread publisher([&] {
+        for (int i = 0; i < 2000; ++i) hub.Broadcast("t1", "x");
+    });
+    churn.join();
+    publisher.join();
+
+    EXPECT_EQ(hub.Subscribers(), 0u);
+}
@@ -0,0 +1,330 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "messaging/AsyncEventBus.hpp"
+#include "messaging/BoundedRing.hpp"
+
+using messaging::AsyncEventBus;
+using messaging::AsyncEventBusOptions;
+using messaging::Backpressure;
+using messaging::BoundedRing;
+using messaging::PendingEvent;
+
+namespace {
+    // Registra los lotes; opcionalmente se queda bloqueado en el primero
+    // (broker lento) o falla las primeras N veces (broker caído).
+    class RecordingSender : public messaging::IEventBatchSender {
+    public:
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::vector<std::vector<std::string>> batches;
+        std::vector<std::vector<std::string>> attemptIds; // eventId de cada intento, aun los fallidos
+        bool gate = false;
+        bool inside = false;
+        int failuresLeft = 0;
+
+        void SendBatch(const std::vector<PendingEvent>& batch) override {
+            std::unique_lock lock(mutex);
+            inside = true;
+            changed.notify_all();
+            changed.wait(lock, [this] { return !gate; });
+            inside = false;
+            std::vector<std::string> ids;
+            for (const auto& event : batch) ids.push_back(event.eventId);
+            attemptIds.push_back(std::move(ids));
+            if (failuresLeft > 0) {
+                --failuresLeft;
+                throw std::runtime_error("broker down");
+            }
+            std::vector<std::string> bodies;
+            for (const auto& event : batch) bodies.push_back(event.topic + ":" + event.body);
+            batches.push_back(std::move(bodies));
+        }
+
+        void WaitInside() {
+            std::unique_lock lock(mutex);
+            changed.wait(lock, [this] { return inside; });
+        }
+
+        void Open() {
+            std::lock_guard lock(mutex);
+            gate = false;
+            changed.notify_all();
+        }
+
+        std::vector<std::string> All() {
+            std::lock_guard lock(mutex);
+            std::vector<std::string> all;
+            for (const auto& batch : batches) all.insert(all.end(), batch.begin(), batch.end());
+            return all;
+        }
+    };
+
+    AsyncEventBusOptions Options(std::size_t capacity, Backpressure policy) {
+        AsyncEventBusOptions options;
+        options.enabled = true;
+        options.capacity = capacity;
+        options.maxBatchSize = 4;
+        options.backpressure = policy;
+        options.retryBackoff = std::chrono::milliseconds(1);
+        return options;
+    }
+}
+
+TEST(BoundedRing, KeepsFifoOrderAndReportsFull) {
+    BoundedRing<int> ring(3); // se redondea a 4
+    EXPECT_EQ(ring.Capacity(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        int value = i;
+        EXPECT_TRUE(ring.TryPush(value));
+    }
+    int extra = 99;
+    EXPECT_FALSE(ring.TryPush(extra));
+    EXPECT_EQ(extra, 99);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(ring.TryPop(), i);
+    }
+    EXPECT_FALSE(ring.TryPop().has_value());
+    EXPECT_TRUE(ring.Empty());
+}
+
+TEST(BoundedRing, ManyProducersOneConsumerLoseNothing) {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 5000;
+    BoundedRing<int> ring(256);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                int value = p * kPerProducer + i;
+                while (!ring.TryPush(value)) std::this_thread::yield();
+            }
+        });
+    }
+
+    // Cada productor debe salir en su propio orden
+    std::vector<int> last(kProducers, -1);
+    int received = 0;
+    while (received < kProducers * kPerProducer) {
+        auto value = ring.TryPop();
+        if (!value) { std::this_thread::yield(); continue; }
+        const int producer = *value / kPerProducer;
+        EXPECT_GT(*value, last[producer]);
+        last[producer] = *value;
+        ++received;
+    }
+    for (auto& t : producers) t.join();
+    EXPECT_TRUE(ring.Empty());
+}
+
+TEST(AsyncEventBus, SendsEverythingInOrderAndFlushesOnShutdown) {
+    auto sender = std::make_shared<RecordingSender>();
+    {
+        AsyncEventBus bus(sender, Options(64, Backpressure::Block));
+        for (int i = 0; i < 10; ++i) {
+            bus.Publish("match.score_updated", nlohmann::json{{"n", i}});
+        }
+    }
+
+    const auto all = sender->All();
+    ASSERT_EQ(all.size(), 10u);
+    EXPECT_EQ(all.front(), R"(match.score_updated:{"n":0})");
+    EXPECT_EQ(all.back(), R"(match.score_updated:{"n":9})");
+    for (const auto& batch : sender->batches) {
+        EXPECT_LE(batch.size(), 4u);
+    }
+}
+
+TEST(AsyncEventBus, PublishDoesNotWaitForASlowBroker) {
+    auto sender = std::make_shared<RecordingSender>();
+    sender->gate = true;
+    AsyncEventBus bus(sender, Options(64, Backpressure::Block));
+
+    bus.Publish("t", nlohmann::json{{"n", 0}});
+    sender->WaitInside(); // el hilo de envío quedó atorado en el broker
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 1; i <= 20; ++i) {
+        bus.Publish("t", nlohmann::json{{"n", i}});
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(200));
+    EXPECT_EQ(bus.Stats().queued, 20u);
+
+    sender->Open();
+}
+
+TEST(AsyncEventBus, FailPolicyRejectsWhenFull) {
+    auto sender = std::make_shared<RecordingSender>();
+    sender->gate = true;
+    AsyncEventBus bus(sender, Options(4, Backpressure::Fail));
+
+    bus.Publish("t", nlohmann::json{{"n", 0}});
+    sender->WaitInside();
+    for (int i = 1; i <= 4; ++i) {
+        bus.Publish("t", nlohmann::json{{"n", i}});
+    }
+    EXPECT_THROW(bus.Publish("t", nlohmann::json{{"n", 5}}), messaging::EventBusFull);
+    EXPECT_EQ(bus.Stats().rejected, 1u);
+
+    sender->Open();
+}
+
+TEST(AsyncEventBus, DropOldestKeepsTheNewestEvents) {
+    auto sender = std::make_shared<RecordingSender>();
+    sender->gate = true;
+    std::shared_ptr<RecordingSender> keep = sender;
+    {
+        AsyncEventBus bus(sender, Options(4, Backpressure::DropOldest));
+        bus.Publish("t", nlohmann::json{{"n", 0}});
+        sender->WaitInside();
+        for (int i = 1; i <= 6; ++i) {
+            bus.Publish("t", nlohmann::json{{"n", i}});
+        }
+        EXPECT_EQ(bus.Stats().dropped, 2u);
+        sender->Open();
+    }
+
+    const auto all = keep->All();
+    ASSERT_EQ(all.size(), 5u);
+    EXPECT_EQ(all[0], R"(t:{"n":0})");
+    EXPECT_EQ(all[1], R"(t:{"n":3})");
+    EXPECT_EQ(all[4], R"(t:{"n":6})");
+}
+
+TEST(AsyncEventBus, RetriesAFailedBatchThenCountsItLost) {
+    auto sender = std::make_shared<RecordingSender>();
+    sender->failuresLeft = 1;
+    {
+        AsyncEventBus bus(sender, Options(16, Backpressure::Block));
+        bus.Publish("t", nlohmann::json{{"n", 1}});
+    }
+    EXPECT_EQ(sender->All().size(), 1u);
+
+    auto down = std::make_shared<RecordingSender>();
+    down->failuresLeft = 100;
+    auto options = Options(16, Backpressure::Block);
+    options.maxSendAttempts = 3;
+    std::uint64_t failed = 0;
+    {
+        AsyncEventBus bus(down, options);
+        bus.Publish("t", nlohmann::json{{"n", 1}});
+        while (bus.Stats().failed == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        failed = bus.Stats().failed;
+    }
+    EXPECT_EQ(failed, 1u);
+    EXPECT_EQ(down->failuresLeft, 97);
+}
+
+TEST(AsyncEventBus, RetriedBatchKeepsItsEventIds) {
+    auto sender = std::make_shared<RecordingSender>();
+    sender->failuresLeft = 1;
+    {
+        AsyncEventBus bus(sender, Options(16, Backpressure::Block));
+        bus.Publish("t", nlohmann::json{{"n", 1}});
+    }
+
+    ASSERT_EQ(sender->attemptIds.size(), 2u);
+    ASSERT_EQ(sender->attemptIds[0].size(), 1u);
+    EXPECT_FALSE(sender->attemptIds[0][0].empty());
+    EXPECT_EQ(sender->attemptIds[0], sender->attemptIds[1]);
+}
+
+TEST(AsyncEventBus, EventIdsAreUniquePerEventAndPerBus) {
+    auto sender = std::make_shared<RecordingSender>();
+    {
+        AsyncEventBus bus(sender, Options(16, Backpressure::Block));
+        AsyncEventBus other(sender, Options(16, Backpressure::Block));
+        for (int i = 0; i < 3; ++i) {
+            bus.Publish("t", nlohmann::json{{"n", i}});
+            other.Publish("t", nlohmann::json{{"n", i}});
+        }
+    }
+
+    std::vector<std::string> ids;
+    for (const auto& attempt : sender->attemptIds) ids.insert(ids.end(), attempt.begin(), attempt.end());
+    ASSERT_EQ(ids.size(), 6u);
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+}
+
+TEST(AsyncEventBus, BlockedPublishResumesWhenSpaceFrees) {
+    auto sender = std::make_shared<RecordingSender>();
+    sender->gate = true;
+    AsyncEventBus bus(sender, Options(4, Backpressure::Block));
+    bus.Publish("t", nlohmann::json{{"n", 0}});
+    sender->WaitInside();
+    for (int i = 1; i <= 4; ++i) {
+        bus.Publish("t", nlohmann::json{{"n", i}});
+    }
+
+    std::atomic<bool> done{false};
+    std::thread publisher([&] {
+        bus.Publish("t", nlohmann::json{{"n", 5}});
+        done = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(done.load());
+
+    sender->Open();
+    publisher.join();
+    EXPECT_TRUE(done.load());
+    bus.Stop();
+    EXPECT_EQ(sender->All().size(), 6u);
+}
+
+TEST(AsyncEventBus, StopReleasesBlockedPublishers) {
+    auto sender = std::make_shared<RecordingSender>();
+    sender->gate = true;
+    AsyncEventBus bus(sender, Options(4, Backpressure::Block));
+    bus.Publish("t", nlohmann::json{{"n", 0}});
+    sender->WaitInside();
+    for (int i = 1; i <= 4; ++i) {
+        bus.Publish("t", nlohmann::json{{"n", i}});
+    }
+
+    std::atomic<bool> rejected{false};
+    std::thread publisher([&] {
+        try {
+            bus.Publish("t", nlohmann::json{{"n", 5}});
+        } catch (const messaging::EventBusFull&) {
+            rejected = true;
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // El hilo de envío sigue atorado en el broker: Stop espera a que termine,
+    // pero el Publish bloqueado no tiene que esperarlo
+    std::thread stopper([&] { bus.Stop(); });
+    publisher.join();
+    EXPECT_TRUE(rejected.load());
+
+    sender->Open();
+    stopper.join();
+    EXPECT_EQ(sender->All().size(), 5u);
+    EXPECT_THROW(bus.Publish("t", nlohmann::json{{"n", 6}}), messaging::EventBusFull);
+    EXPECT_EQ(bus.Stats().rejected, 2u);
+}
+
+TEST(AsyncEventBus, RendersPrometheusMetrics) {
+    auto sender = std::make_shared<RecordingSender>();
+    AsyncEventBus bus(sender, Options(16, Backpressure::Block));
+    bus.Publish("t", nlohmann::json::object());
+    while (bus.Stats().published == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    std::string text;
+    bus.RenderMetrics(text);
+    EXPECT_NE(text.find("tournament_events_published_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("tournament_events_lost_total{reason=\"dropped\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("tournament_event_publish_duration_seconds_count{} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("tournament_events_queue_capacity 16\n"), std::string::npos);
+}
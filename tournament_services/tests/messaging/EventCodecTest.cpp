@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "domain/Match.hpp"
+#include "messaging/DomainEvents.hpp"
+#include "messaging/EventCodec.hpp"
+
+using messaging::EventEncoding;
+
+namespace {
+    nlohmann::json ScoreUpdated() {
+        domain::Match match;
+        match.Id = "5f2a7c1e-8b4d-4f7a-9c3e-1a2b3c4d5e6f";
+        match.TournamentId = "0b6c3a52-2f7e-4d1a-8f35-7c9e1d2a4b6f";
+        match.HomeTeamId = "a1b2c3d4-e5f6-4a7b-8c9d-0e1f2a3b4c5d";
+        match.AwayTeamId = "b2c3d4e5-f6a7-4b8c-9d0e-1f2a3b4c5d6e";
+        match.Round = 3;
+        match.HomeScore = 2;
+        match.AwayScore = 1;
+        return payloads::MatchScoreUpdated(match.TournamentId, match.Id, match, 2, 1);
+    }
+}
+
+TEST(EventCodec, JsonAndMessagePackRoundTrip) {
+    const auto payload = ScoreUpdated();
+    for (const auto encoding : {EventEncoding::Json, EventEncoding::MessagePack}) {
+        const auto body = messaging::EncodeEvent(payload, encoding);
+        EXPECT_EQ(messaging::DecodeEvent(body, encoding), payload);
+    }
+}
+
+TEST(EventCodec, JsonBodyIsUnchangedFromBefore) {
+    const auto payload = ScoreUpdated();
+    EXPECT_EQ(messaging::EncodeEvent(payload, EventEncoding::Json), payload.dump());
+}
+
+TEST(EventCodec, MessagePackIsSmallerForScoreUpdated) {
+    const auto payload = ScoreUpdated();
+    const auto json = messaging::EncodeEvent(payload, EventEncoding::Json);
+    const auto msgpack = messaging::EncodeEvent(payload, EventEncoding::MessagePack);
+    EXPECT_LT(msgpack.size(), json.size());
+}
+
+TEST(EventCodec, TranscodesOutboxRows) {
+    const std::string row = R"({"tournamentId":"t-1","groupId":"g-1"})";
+    EXPECT_EQ(messaging::TranscodeJsonEvent(row, EventEncoding::Json), row);
+
+    const auto body = messaging::TranscodeJsonEvent(row, EventEncoding::MessagePack);
+    EXPECT_EQ(messaging::DecodeEvent(body, EventEncoding::MessagePack), nlohmann::json::parse(row));
+}
+
+TEST(EventCodec, ContentTypesAndConfigurationNames) {
+    EXPECT_EQ(messaging::ContentType(EventEncoding::Json), "application/json");
+    EXPECT_EQ(messaging::ContentType(EventEncoding::MessagePack), "application/msgpack");
+    EXPECT_EQ(messaging::EncodingForContentType("application/msgpack"), EventEncoding::MessagePack);
+    EXPECT_EQ(messaging::EncodingForContentType("application/cbor"), std::nullopt);
+
+    EXPECT_EQ(messaging::ParseEventEncoding("msgpack"), EventEncoding::MessagePack);
+    EXPECT_EQ(messaging::ParseEventEncoding("json"), EventEncoding::Json);
+    EXPECT_EQ(messaging::ParseEventEncoding("unknown"), EventEncoding::Json);
+}
+
+TEST(EventCodec, TruncatedMessagePackThrows) {
+    auto body = messaging::EncodeEvent(ScoreUpdated(), EventEncoding::MessagePack);
+    body.resize(body.size() / 2);
+    EXPECT_THROW(messaging::DecodeEvent(body, EventEncoding::MessagePack), nlohmann::json::exception);
+}
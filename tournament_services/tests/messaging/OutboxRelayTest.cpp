@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "messaging/OutboxRelay.hpp"
+
+using messaging::OutboxRelay;
+using messaging::PendingEvent;
+
+namespace {
+    // Tabla outbox en memoria: borra sólo si publish no lanzó
+    class InMemoryOutbox : public IOutboxRepository {
+    public:
+        std::mutex mutex;
+        std::deque<OutboxRecord> rows;
+
+        void Add(std::int64_t id, std::string topic) {
+            std::lock_guard lock(mutex);
+            rows.push_back(OutboxRecord{id, std::move(topic), "{\"n\":" + std::to_string(id) + "}"});
+        }
+
+        std::size_t Size() {
+            std::lock_guard lock(mutex);
+            return rows.size();
+        }
+
+        std::size_t PublishPending(std::size_t limit,
+                                   const std::function<void(const std::vector<OutboxRecord>&)>& publish) override {
+            std::lock_guard lock(mutex);
+            std::vector<OutboxRecord> batch(rows.begin(), rows.begin() + std::min(limit, rows.size()));
+            if (batch.empty()) return 0;
+            publish(batch);
+            rows.erase(rows.begin(), rows.begin() + batch.size());
+            return batch.size();
+        }
+    };
+
+    class RecordingSender : public messaging::IEventBatchSender {
+    public:
+        std::mutex mutex;
+        std::vector<std::vector<std::string>> batches;
+        int failuresLeft = 0;
+
+        void SendBatch(const std::vector<PendingEvent>& batch) override {
+            std::lock_guard lock(mutex);
+            if (failuresLeft > 0) {
+                --failuresLeft;
+                throw std::runtime_error("broker down");
+            }
+            std::vector<std::string> sent;
+            for (const auto& event : batch) sent.push_back(event.topic + ":" + event.body);
+            batches.push_back(std::move(sent));
+        }
+
+        std::size_t Sent() {
+            std::lock_guard lock(mutex);
+            std::size_t total = 0;
+            for (const auto& batch : batches) total += batch.size();
+            return total;
+        }
+    };
+
+    OutboxOptions Options(std::size_t batchSize) {
+        OutboxOptions options;
+        options.enabled = true;
+        options.batchSize = batchSize;
+        options.pollInterval = std::chrono::milliseconds(1);
+        options.retryBackoff = std::chrono::milliseconds(1);
+        return options;
+    }
+}
+
+TEST(OutboxRelay, PublishesInIdOrderAndDeletesSentRows) {
+    auto outbox = std::make_shared<InMemoryOutbox>();
+    auto sender = std::make_shared<RecordingSender>();
+    for (int id = 1; id <= 5; ++id) outbox->Add(id, "match.score_updated");
+
+    OutboxRelay relay(outbox, sender, Options(2));
+    EXPECT_EQ(relay.RelayOnce(), 2u);
+    EXPECT_EQ(relay.RelayOnce(), 2u);
+    EXPECT_EQ(relay.RelayOnce(), 1u);
+    EXPECT_EQ(relay.RelayOnce(), 0u);
+
+    ASSERT_EQ(sender->batches.size(), 3u);
+    EXPECT_EQ(sender->batches[0][0], R"(match.score_updated:{"n":1})");
+    EXPECT_EQ(sender->batches[0][1], R"(match.score_updated:{"n":2})");
+    EXPECT_EQ(sender->batches[2][0], R"(match.score_updated:{"n":5})");
+    EXPECT_EQ(outbox->Size(), 0u);
+    EXPECT_EQ(relay.Stats().relayed, 5u);
+    EXPECT_EQ(relay.Stats().batches, 3u);
+}
+
+TEST(OutboxRelay, TranscodesRowsToTheConfiguredEncoding) {
+    auto outbox = std::make_shared<InMemoryOutbox>();
+    auto sender = std::make_shared<RecordingSender>();
+    outbox->Add(7, "t");
+
+    auto options = Options(8);
+    options.encoding = messaging::EventEncoding::MessagePack;
+    OutboxRelay relay(outbox, sender, options);
+    EXPECT_EQ(relay.RelayOnce(), 1u);
+
+    ASSERT_EQ(sender->batches.size(), 1u);
+    const auto body = sender->batches[0][0].substr(2); // sin "t:"
+    EXPECT_EQ(messaging::DecodeEvent(body, messaging::EventEncoding::MessagePack), nlohmann::json({{"n", 7}}));
+}
+
+TEST(OutboxRelay, BrokerFailureKeepsRowsForTheNextAttempt) {
+    auto outbox = std::make_shared<InMemoryOutbox>();
+    auto sender = std::make_shared<RecordingSender>();
+    sender->failuresLeft = 1;
+    outbox->Add(1, "group.created");
+
+    OutboxRelay relay(outbox, sender, Options(10));
+    EXPECT_THROW(relay.RelayOnce(), std::runtime_error);
+    EXPECT_EQ(outbox->Size(), 1u);
+
+    EXPECT_EQ(relay.RelayOnce(), 1u);
+    EXPECT_EQ(outbox->Size(), 0u);
+}
+
+TEST(OutboxRelay, BackgroundLoopDrainsAndRetries) {
+    auto outbox = std::make_shared<InMemoryOutbox>();
+    auto sender = std::make_shared<RecordingSender>();
+    sender->failuresLeft = 2;
+    for (int id = 1; id <= 7; ++id) outbox->Add(id, "group.teams_added");
+
+    OutboxRelay relay(outbox, sender, Options(3));
+    relay.Start();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (outbox->Size() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    relay.Stop();
+
+    EXPECT_EQ(outbox->Size(), 0u);
+    EXPECT_EQ(sender->Sent(), 7u);
+    EXPECT_EQ(relay.Stats().errors, 2u);
+
+    std::string text;
+    relay.RenderMetrics(text);
+    EXPECT_NE(text.find("tournament_outbox_relayed_total 7\n"), std::string::npos);
+    EXPECT_NE(text.find("tournament_outbox_relay_errors_total 2\n"), std::string::npos);
+}
+
+TEST(OutboxRelay, DisabledRelayDoesNotStart) {
+    auto outbox = std::make_shared<InMemoryOutbox>();
+    auto sender = std::make_shared<RecordingSender>();
+    outbox->Add(1, "group.created");
+
+    auto options = Options(10);
+    options.enabled = false;
+    OutboxRelay relay(outbox, sender, options);
+    relay.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    relay.Stop();
+
+    EXPECT_EQ(outbox->Size(), 1u);
+    EXPECT_EQ(sender->Sent(), 0u);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "metrics/MetricsRegistry.hpp"
+
+using namespace std::chrono_literals;
+using metrics::MetricsRegistry;
+using metrics::RequestTimer;
+
+TEST(LatencyHistogram, BucketsAreLogLinear) {
+    EXPECT_EQ(metrics::BucketIndex(0), 0u);
+    EXPECT_EQ(metrics::BucketIndex(7), 7u);
+    for (std::uint64_t micros : {8ull, 100ull, 1'000ull, 123'456ull, 10'000'000ull}) {
+        const auto index = metrics::BucketIndex(micros);
+        EXPECT_LT(micros, metrics::BucketUpperBound(index)) << micros;
+        EXPECT_LE(metrics::BucketUpperBound(index), micros + micros / 8 + 1) << micros;
+    }
+    EXPECT_EQ(metrics::BucketIndex(~0ull), metrics::kBucketCount - 1);
+}
+
+TEST(MetricsRegistry, ReusesRouteIds) {
+    MetricsRegistry registry;
+    const auto teams = registry.Route("/teams", "GET");
+    EXPECT_NE(registry.Route("/teams", "POST"), teams);
+    EXPECT_EQ(registry.Route("/teams", "GET"), teams);
+}
+
+TEST(MetricsRegistry, MergesCountersFromAllThreads) {
+    MetricsRegistry registry;
+    const auto route = registry.Route("/teams", "GET");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&registry, route] {
+            for (int i = 0; i < 1000; ++i) {
+                registry.Started(route);
+                registry.Finished(route, i % 10 == 0 ? 404 : 200, 2ms);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    const auto snapshot = registry.Snapshot();
+    ASSERT_EQ(snapshot.size(), 1u);
+    EXPECT_EQ(snapshot[0].latency.total, 4000u);
+    EXPECT_EQ(snapshot[0].statuses[1], 3600u);
+    EXPECT_EQ(snapshot[0].statuses[3], 400u);
+    EXPECT_EQ(snapshot[0].inFlight, 0);
+    EXPECT_EQ(snapshot[0].latency.sumMicros, 4000u * 2000u);
+    EXPECT_GE(snapshot[0].latency.QuantileMicros(0.99), 2000u);
+    EXPECT_LE(snapshot[0].latency.QuantileMicros(0.99), 2250u);
+}
+
+TEST(MetricsRegistry, InFlightBalancesAcrossThreads) {
+    MetricsRegistry registry;
+    const auto route = registry.Route("/teams", "POST");
+
+    RequestTimer timer{&registry, route};
+    EXPECT_EQ(registry.Snapshot()[0].inFlight, 1);
+
+    std::thread([&timer] { timer.Finish(201); }).join();
+    EXPECT_EQ(registry.Snapshot()[0].inFlight, 0);
+    EXPECT_EQ(registry.Snapshot()[0].statuses[1], 1u);
+}
+
+TEST(MetricsRegistry, AbandonedTimerCountsConfiguredStatus) {
+    MetricsRegistry registry;
+    const auto route = registry.Route("/teams", "GET");
+    {
+        RequestTimer timer{&registry, route};
+        timer.AbandonedStatus(503);
+    }
+    {
+        RequestTimer timer{&registry, route};
+        RequestTimer moved = std::move(timer);
+    }
+    const auto snapshot = registry.Snapshot();
+    EXPECT_EQ(snapshot[0].statuses[4], 2u);
+    EXPECT_EQ(snapshot[0].latency.total, 2u);
+}
+
+TEST(MetricsRegistry, RendersPrometheusText) {
+    MetricsRegistry registry;
+    const auto route = registry.Route("/teams/<string>", "GET");
+    registry.Route("/teams", "POST");
+    registry.Started(route);
+    registry.Finished(route, 200, 3ms);
+
+    const auto text = registry.Render();
+    EXPECT_NE(text.find("# TYPE tournament_http_request_duration_seconds histogram"), std::string::npos);
+    EXPECT_NE(text.find("tournament_http_requests_total{method=\"GET\",route=\"/teams/<string>\",status=\"2xx\"} 1"),
+              std::string::npos);
+    EXPECT_NE(text.find("tournament_http_request_duration_seconds_bucket{method=\"GET\",route=\"/teams/<string>\",le=\"0.0025\"} 0"),
+              std::string::npos);
+    EXPECT_NE(text.find("tournament_http_request_duration_seconds_bucket{method=\"GET\",route=\"/teams/<string>\",le=\"0.005\"} 1"),
+              std::string::npos);
+    EXPECT_NE(text.find("tournament_http_request_duration_seconds_count{method=\"GET\",route=\"/teams/<string>\"} 1"),
+              std::string::npos);
+    EXPECT_NE(text.find("tournament_http_requests_in_flight{method=\"POST\",route=\"/teams\"} 0"), std::string::npos);
+}
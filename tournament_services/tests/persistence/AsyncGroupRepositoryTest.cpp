@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+
+#include <asio/io_context.hpp>
+
+#include "FakePgServer.hpp"
+#include "domain/Team.hpp"
+#include "persistence/repository/AsyncGroupRepository.hpp"
+
+namespace {
+    using Reply = FakePgServer::Reply;
+
+    constexpr const char* kTournament = "0b6c3a52-2f7e-4d1a-8f35-7c9e1d2a4b6f";
+    constexpr const char* kGroup = "5f2a7c1e-8b4d-4f7a-9c3e-1a2b3c4d5e6f";
+
+    bool Contains(const std::string& sql, const char* text) { return sql.find(text) != std::string::npos; }
+
+    // Responde como la tabla groups con un solo grupo
+    Reply GroupsTable(const FakePgServer::Query& query) {
+        if (Contains(query.sql, "COUNT(*)")) return Reply::Rows({"cnt"}, {{"3"}});
+        if (Contains(query.sql, "SELECT id")) {
+            if (query.params.at(0) != std::optional<std::string>(kGroup)) return Reply::Rows({"id", "name", "tournament_id"}, {});
+            return Reply::Rows({"id", "name", "tournament_id"}, {{kGroup, "Grupo A", kTournament}});
+        }
+        if (Contains(query.sql, "INSERT INTO group_teams")) return Reply::Error("23503", "team does not exist");
+        if (Contains(query.sql, "UPDATE groups")) return Reply::Rows({"id"}, {{query.params.at(0)}});
+        return Reply::Command("SELECT 0");
+    }
+
+    struct AsyncGroupRepositoryTest : ::testing::Test {
+        asio::io_context io;
+
+        // Corre la tarea en este hilo atendiendo el io_context hasta que termina
+        template<typename T>
+        T Run(concurrency::Task<T> task) {
+            std::optional<concurrency::detail::Outcome<T>> outcome;
+            concurrency::Spawn(std::move(task), [&](auto result) { outcome = std::move(result); });
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!outcome && std::chrono::steady_clock::now() < deadline) {
+                io.restart();
+                io.run_for(std::chrono::milliseconds(10));
+            }
+            if (!outcome) throw std::runtime_error("query did not finish");
+            if (!*outcome) std::rethrow_exception(outcome->error());
+            if constexpr (!std::is_void_v<T>) return std::move(**outcome);
+        }
+
+        std::unique_ptr<AsyncGroupRepository> Repository(const FakePgServer& server, std::size_t size = 1) {
+            return std::make_unique<AsyncGroupRepository>(
+                std::make_shared<AsyncPgConnectionPool>(io, server.ConnectionString(), size));
+        }
+    };
+}
+
+TEST_F(AsyncGroupRepositoryTest, ReadsRowsThroughThePool) {
+    FakePgServer server(GroupsTable);
+    const auto repository = Repository(server);
+
+    const auto group = Run(repository->ReadById(kGroup));
+    ASSERT_NE(group, nullptr);
+    EXPECT_EQ(group->Id(), kGroup);
+    EXPECT_EQ(group->Name(), "Grupo A");
+    EXPECT_EQ(group->TournamentId(), kTournament);
+    EXPECT_EQ(Run(repository->ReadById("otro")), nullptr);
+    EXPECT_EQ(Run(repository->GroupsCountForTournament(kTournament)), 3);
+
+    const auto queries = server.Queries();
+    ASSERT_EQ(queries.size(), 3u);
+    EXPECT_EQ(queries[2].params, FakePgServer::Row{std::string(kTournament)});
+    EXPECT_EQ(server.Connections(), 1);
+}
+
+TEST_F(AsyncGroupRepositoryTest, ServerErrorKeepsTheConnectionUsable) {
+    FakePgServer server(GroupsTable);
+    const auto repository = Repository(server);
+    auto team = std::make_shared<domain::Team>();
+    team->Id = "t-1";
+    team->Name = "Equipo";
+
+    try {
+        Run(repository->UpdateGroupAddTeam(kGroup, team));
+        FAIL() << "expected PgError";
+    } catch (const PgError& e) {
+        EXPECT_EQ(e.sqlState, "23503");
+    }
+
+    // Se leyó la respuesta hasta el final: la misma conexión sigue sirviendo
+    EXPECT_NE(Run(repository->ReadById(kGroup)), nullptr);
+    EXPECT_EQ(server.Connections(), 1);
+}
+
+TEST_F(AsyncGroupRepositoryTest, BrokenConnectionIsResetBeforeGoingBackToThePool) {
+    std::atomic<bool> dropNext{false};
+    FakePgServer server([&](const FakePgServer::Query& query) {
+        if (dropNext.exchange(false)) return Reply::Disconnect();
+        return GroupsTable(query);
+    });
+    const auto repository = Repository(server);
+    ASSERT_NE(Run(repository->ReadById(kGroup)), nullptr);
+
+    dropNext = true;
+    EXPECT_ANY_THROW(Run(repository->ReadById(kGroup)));
+
+    // Pool de una sola conexión: si hubiera vuelto caída, esto fallaría
+    EXPECT_NE(Run(repository->ReadById(kGroup)), nullptr);
+    EXPECT_EQ(server.Connections(), 2);
+}
+
+TEST_F(AsyncGroupRepositoryTest, ServerRestartBetweenQueriesIsRecovered) {
+    FakePgServer server(GroupsTable);
+    const auto repository = Repository(server);
+    ASSERT_EQ(Run(repository->GroupsCountForTournament(kTournament)), 3);
+
+    server.DropConnections();
+    // La conexión ociosa no se entera hasta usarla: esa consulta falla y al
+    // devolverla se reabre
+    EXPECT_ANY_THROW(Run(repository->GroupsCountForTournament(kTournament)));
+    EXPECT_EQ(Run(repository->GroupsCountForTournament(kTournament)), 3);
+}
+
+TEST_F(AsyncGroupRepositoryTest, LargeParametersDoNotDeadlockWhenTheServerWritesFirst) {
+    // El servidor escribe más de lo que entra en los buffers del socket antes
+    // de leer el documento; el cliente tiene que leer mientras envía
+    constexpr std::size_t kBig = 16 * 1024 * 1024;
+    FakePgServer server(GroupsTable, [](const std::string& sql) {
+        return Contains(sql, "UPDATE groups") ? kBig : std::size_t{0};
+    });
+    const auto repository = Repository(server);
+
+    domain::Group group(kGroup, std::string(kBig, 'g'));
+    group.TournamentId() = kTournament;
+    EXPECT_EQ(Run(repository->Update(group)), kGroup);
+
+    const auto queries = server.Queries();
+    ASSERT_EQ(queries.size(), 1u);
+    EXPECT_GT(queries[0].params.at(3)->size(), kBig);
+}
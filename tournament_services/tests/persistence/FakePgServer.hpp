@@ -0,0 +1,407 @@
+#ifndef TESTS_FAKE_PG_SERVER_HPP
+#define TESTS_FAKE_PG_SERVER_HPP
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Servidor PostgreSQL de mentira para los tests de AsyncPgConnection y los
+// repositorios asíncronos: habla el protocolo 3.0 de libpq (sin SSL ni
+// contraseña) y responde cada consulta con lo que diga el script del test.
+// Cubre lo que usa el cliente: PQprepare (Parse + Sync) y las consultas con
+// parámetros (Parse/Bind/Describe/Execute/Sync); todas las columnas son texto.
+class FakePgServer {
+public:
+    using Row = std::vector<std::optional<std::string>>;
+
+    struct Query {
+        std::string sql;
+        Row params;
+    };
+
+    struct Reply {
+        std::vector<std::string> columns; // vacío => sin filas (NoData)
+        std::vector<Row> rows;
+        std::string tag = "SELECT 0";
+        std::string errorCode; // no vacío => ErrorResponse con ese SQLSTATE
+        std::string errorMessage;
+        bool disconnect = false; // corta el socket en vez de responder
+
+        static Reply Rows(std::vector<std::string> columns, std::vector<Row> rows) {
+            Reply reply;
+            reply.tag = "SELECT " + std::to_string(rows.size());
+            reply.columns = std::move(columns);
+            reply.rows = std::move(rows);
+            return reply;
+        }
+        static Reply Command(std::string tag) {
+            Reply reply;
+            reply.tag = std::move(tag);
+            return reply;
+        }
+        static Reply Error(std::string code, std::string message) {
+            Reply reply;
+            reply.errorCode = std::move(code);
+            reply.errorMessage = std::move(message);
+            return reply;
+        }
+        static Reply Disconnect() {
+            Reply reply;
+            reply.disconnect = true;
+            return reply;
+        }
+    };
+
+    // Corre en el hilo de la conexión, antes de responder
+    using Script = std::function<Reply(const Query&)>;
+    // Bytes a mandar al recibir el Parse, antes de leer el resto de la
+    // consulta, en mensajes ParameterStatus (libpq los guarda sin avisar):
+    // si el cliente no lee mientras envía, ninguno de los dos avanza
+    using ParseHook = std::function<std::size_t(const std::string& sql)>;
+
+    explicit FakePgServer(Script script, ParseHook floodOnParse = {})
+        : script(std::move(script)), floodOnParse(std::move(floodOnParse)) {
+        listener = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (listener < 0 || ::bind(listener, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+            ::listen(listener, 16) != 0 ||
+            ::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+            throw std::runtime_error("fake pg server: cannot listen");
+        }
+        port = ntohs(address.sin_port);
+        acceptor = std::thread([this] { Accept(); });
+    }
+
+    ~FakePgServer() {
+        stopping = true;
+        ::shutdown(listener, SHUT_RDWR);
+        ::close(listener);
+        acceptor.join();
+        DropConnections();
+        std::vector<std::thread> finished;
+        {
+            std::lock_guard lock(mutex);
+            finished.swap(sessions);
+        }
+        for (auto& session : finished) session.join();
+    }
+
+    FakePgServer(const FakePgServer&) = delete;
+    FakePgServer& operator=(const FakePgServer&) = delete;
+
+    [[nodiscard]] std::string ConnectionString() const {
+        return "host=127.0.0.1 port=" + std::to_string(port) +
+               " dbname=tournaments user=test sslmode=disable gssencmode=disable connect_timeout=5";
+    }
+
+    [[nodiscard]] int Connections() const {
+        std::lock_guard lock(mutex);
+        return connections;
+    }
+
+    [[nodiscard]] std::vector<Query> Queries() const {
+        std::lock_guard lock(mutex);
+        return queries;
+    }
+
+    // Como un reinicio del servidor: corta todas las conexiones abiertas
+    void DropConnections() {
+        std::lock_guard lock(mutex);
+        for (const int client : clients) ::shutdown(client, SHUT_RDWR);
+    }
+
+private:
+    struct Portal {
+        std::string sql;
+        Row params;
+        std::optional<Reply> reply;
+    };
+
+    void Accept() {
+        while (!stopping) {
+            const int client = ::accept(listener, nullptr, nullptr);
+            if (client < 0) return;
+            // Las respuestas van en varios send: sin esto Nagle y el ACK
+            // diferido agregan ~40 ms a cada una
+            const int noDelay = 1;
+            ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+            std::lock_guard lock(mutex);
+            ++connections;
+            clients.push_back(client);
+            sessions.emplace_back([this, client] {
+                Serve(client);
+                std::lock_guard inner(mutex);
+                std::erase(clients, client);
+                ::close(client);
+            });
+        }
+    }
+
+    static bool ReadExact(int client, char* data, std::size_t size) {
+        while (size > 0) {
+            const auto read = ::recv(client, data, size, 0);
+            if (read <= 0) return false;
+            data += read;
+            size -= static_cast<std::size_t>(read);
+        }
+        return true;
+    }
+
+    static bool WriteAll(int client, const std::string& data) {
+        std::size_t sent = 0;
+        while (sent < data.size()) {
+            const auto written = ::send(client, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (written <= 0) return false;
+            sent += static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+    static std::uint32_t ReadInt32(const std::string& data, std::size_t& at) {
+        std::uint32_t value;
+        std::memcpy(&value, data.data() + at, 4);
+        at += 4;
+        return ntohl(value);
+    }
+
+    static std::uint16_t ReadInt16(const std::string& data, std::size_t& at) {
+        std::uint16_t value;
+        std::memcpy(&value, data.data() + at, 2);
+        at += 2;
+        return ntohs(value);
+    }
+
+    static std::string ReadCString(const std::string& data, std::size_t& at) {
+        const auto end = data.find('\0', at);
+        std::string value = data.substr(at, end - at);
+        at = end + 1;
+        return value;
+    }
+
+    // Arma un mensaje: tipo + largo (incluye el propio largo) + cuerpo
+    struct Message {
+        std::string body;
+
+        Message& Int32(std::uint32_t value) {
+            value = htonl(value);
+            body.append(reinterpret_cast<const char*>(&value), 4);
+            return *this;
+        }
+        Message& Int16(std::uint16_t value) {
+            value = htons(value);
+            body.append(reinterpret_cast<const char*>(&value), 2);
+            return *this;
+        }
+        Message& CString(const std::string& value) {
+            body.append(value);
+            body.push_back('\0');
+            return *this;
+        }
+        Message& Byte(char value) {
+            body.push_back(value);
+            return *this;
+        }
+        [[nodiscard]] std::string Frame(char type) const {
+            Message framed;
+            framed.Byte(type).Int32(static_cast<std::uint32_t>(body.size() + 4));
+            return framed.body + body;
+        }
+    };
+
+    static std::string ReadyForQuery() { return Message{}.Byte('I').Frame('Z'); }
+
+    static std::string Describe(const Reply& reply) {
+        if (reply.columns.empty()) return Message{}.Frame('n');
+        Message description;
+        description.Int16(static_cast<std::uint16_t>(reply.columns.size()));
+        for (const auto& column : reply.columns) {
+            // tabla, columna, tipo text (25), largo variable, typmod, formato texto
+            description.CString(column).Int32(0).Int16(0).Int32(25).Int16(0xFFFF).Int32(0xFFFFFFFF).Int16(0);
+        }
+        return description.Frame('T');
+    }
+
+    static std::string Rows(const Reply& reply) {
+        std::string out;
+        for (const auto& row : reply.rows) {
+            Message data;
+            data.Int16(static_cast<std::uint16_t>(row.size()));
+            for (const auto& value : row) {
+                if (!value) {
+                    data.Int32(0xFFFFFFFF);
+                } else {
+                    data.Int32(static_cast<std::uint32_t>(value->size()));
+                    data.body.append(*value);
+                }
+            }
+            out += data.Frame('D');
+        }
+        return out + Message{}.CString(reply.tag).Frame('C');
+    }
+
+    static std::string Error(const Reply& reply) {
+        return Message{}
+            .Byte('S').CString("ERROR")
+            .Byte('V').CString("ERROR")
+            .Byte('C').CString(reply.errorCode)
+            .Byte('M').CString(reply.errorMessage)
+            .Byte('\0')
+            .Frame('E');
+    }
+
+    static bool Flood(int client, std::size_t bytes) {
+        // libpq toma un ParameterStatus de más de 30000 bytes por pérdida de sincronía
+        constexpr std::size_t chunk = 16 * 1024;
+        for (std::size_t sent = 0; sent < bytes; sent += chunk) {
+            if (!WriteAll(client, Message{}.CString("application_name").CString(std::string(chunk, 'x')).Frame('S'))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Startup(int client) {
+        while (true) {
+            char header[4];
+            if (!ReadExact(client, header, 4)) return false;
+            std::size_t at = 0;
+            const auto length = ReadInt32(std::string(header, 4), at);
+            std::string body(length - 4, '\0');
+            if (!ReadExact(client, body.data(), body.size())) return false;
+            at = 0;
+            const auto code = ReadInt32(body, at);
+            if (code == 80877103 || code == 80877104) { // SSLRequest / GSSENCRequest
+                if (!WriteAll(client, "N")) return false;
+                continue;
+            }
+            break;
+        }
+        std::string greeting = Message{}.Int32(0).Frame('R'); // AuthenticationOk
+        for (const auto& [name, value] : std::map<std::string, std::string>{
+                 {"server_version", "15.0"}, {"client_encoding", "UTF8"}, {"server_encoding", "UTF8"},
+                 {"standard_conforming_strings", "on"}, {"integer_datetimes", "on"}, {"DateStyle", "ISO, MDY"}}) {
+            greeting += Message{}.CString(name).CString(value).Frame('S');
+        }
+        greeting += Message{}.Int32(4242).Int32(1).Frame('K');
+        return WriteAll(client, greeting + ReadyForQuery());
+    }
+
+    Reply Run(const std::string& sql, const Row& params) {
+        {
+            std::lock_guard lock(mutex);
+            queries.push_back({sql, params});
+        }
+        return script({sql, params});
+    }
+
+    void Serve(int client) {
+        if (!Startup(client)) return;
+
+        std::map<std::string, std::string> statements; // nombre => sql ("" = sin nombre)
+        Portal portal;
+        bool failed = false; // tras un error se ignora todo hasta el Sync
+
+        while (true) {
+            char header[5];
+            if (!ReadExact(client, header, 5)) return;
+            std::size_t at = 1;
+            const auto length = ReadInt32(std::string(header, 5), at);
+            std::string body(length - 4, '\0');
+            if (!ReadExact(client, body.data(), body.size())) return;
+            at = 0;
+
+            std::string out;
+            switch (header[0]) {
+                case 'P': { // Parse
+                    const auto name = ReadCString(body, at);
+                    const auto sql = ReadCString(body, at);
+                    statements[name] = sql;
+                    if (!failed) out = Message{}.Frame('1');
+                    if (floodOnParse && !Flood(client, floodOnParse(sql))) return;
+                    break;
+                }
+                case 'B': { // Bind
+                    ReadCString(body, at); // portal
+                    const auto statement = ReadCString(body, at);
+                    const auto formats = ReadInt16(body, at);
+                    at += 2u * formats;
+                    portal = Portal{statements[statement], {}, std::nullopt};
+                    const auto count = ReadInt16(body, at);
+                    for (std::uint16_t i = 0; i < count; ++i) {
+                        const auto size = ReadInt32(body, at);
+                        if (size == 0xFFFFFFFF) {
+                            portal.params.emplace_back(std::nullopt);
+                        } else {
+                            portal.params.emplace_back(body.substr(at, size));
+                            at += size;
+                        }
+                    }
+                    if (!failed) out = Message{}.Frame('2');
+                    break;
+                }
+                case 'D': { // Describe del portal: acá se corre el script
+                    if (failed) break;
+                    portal.reply = Run(portal.sql, portal.params);
+                    if (portal.reply->disconnect) return;
+                    if (!portal.reply->errorCode.empty()) {
+                        out = Error(*portal.reply);
+                        failed = true;
+                    } else {
+                        out = Describe(*portal.reply);
+                    }
+                    break;
+                }
+                case 'E': // Execute
+                    if (!failed && portal.reply) out = Rows(*portal.reply);
+                    break;
+                case 'S': // Sync
+                    failed = false;
+                    out = ReadyForQuery();
+                    break;
+                case 'X': // Terminate
+                    return;
+                default: {
+                    Reply unsupported = Reply::Error("0A000", std::string("fake pg server: message ") + header[0]);
+                    out = Error(unsupported);
+                    failed = true;
+                    break;
+                }
+            }
+            if (!out.empty() && !WriteAll(client, out)) return;
+        }
+    }
+
+    Script script;
+    ParseHook floodOnParse;
+    int listener = -1;
+    std::uint16_t port = 0;
+    std::atomic<bool> stopping{false};
+    std::thread acceptor;
+
+    mutable std::mutex mutex;
+    int connections = 0;
+    std::vector<int> clients;
+    std::vector<std::thread> sessions;
+    std::vector<Query> queries;
+};
+
+#endif // TESTS_FAKE_PG_SERVER_HPP
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "serialization/JsonWriter.hpp"
+#include "serialization/ResponseSerializers.hpp"
+#include "domain/Utilities.hpp"
+
+namespace {
+    MatchDTO sampleMatch(bool played) {
+        MatchDTO dto;
+        dto.matchId = "m1";
+        dto.tournamentId = "t1";
+        dto.groupId = "g1";
+        dto.home = {"h1", "Águilas \"FC\""};
+        dto.visitor = {"v1", "Tab\tand\\slash\x01"};
+        dto.round = "regular";
+        if (played) dto.score = MatchDTO::ScoreInfo{3, -1};
+        return dto;
+    }
+}
+
+TEST(JsonWriter, EscapesLikeNlohmann) {
+    const std::string raw = std::string("a\"b\\c\b\f\n\r\t") + '\x1f' + "ñ/";
+    serialization::JsonWriter writer;
+    writer.String(raw);
+    EXPECT_EQ(writer.View(), nlohmann::json(raw).dump());
+}
+
+TEST(JsonWriter, ClearKeepsCapacity) {
+    serialization::JsonWriter writer;
+    writer.String(std::string(512, 'x'));
+    const auto capacity = writer.Capacity();
+    writer.Clear();
+    EXPECT_TRUE(writer.View().empty());
+    EXPECT_EQ(writer.Capacity(), capacity);
+}
+
+TEST(ResponseSerializers, MatchesMatchNlohmannOutput) {
+    const std::vector<MatchDTO> matches{sampleMatch(true), sampleMatch(false)};
+
+    nlohmann::json expected = nlohmann::json::array();
+    for (const auto& match : matches) expected.push_back(match.ToJson());
+
+    EXPECT_EQ(serialization::MatchesToJson(matches), expected.dump());
+    EXPECT_EQ(serialization::MatchToJson(matches[0]), matches[0].ToJson().dump());
+    EXPECT_EQ(serialization::MatchesToJson({}), "[]");
+}
+
+TEST(ResponseSerializers, GroupsMatchNlohmannOutput) {
+    auto withId = std::make_shared<domain::Group>("g1", "Grupo A");
+    withId->TournamentId() = "t1";
+    withId->Teams().push_back({"a", "Team A"});
+    withId->Teams().push_back({"b", "Team B"});
+    auto withoutId = std::make_shared<domain::Group>("", "Grupo B");
+
+    const std::vector<std::shared_ptr<domain::Group>> groups{withId, withoutId};
+    nlohmann::json expected = nlohmann::json::array();
+    for (const auto& group : groups) expected.push_back(nlohmann::json(*group));
+
+    EXPECT_EQ(serialization::GroupsToJson(groups), expected.dump());
+    EXPECT_EQ(serialization::GroupToJson(*withId), nlohmann::json(*withId).dump());
+}
+
+TEST(ResponseSerializers, TeamsAndTournamentsMatchControllerOutput) {
+    const std::vector<std::shared_ptr<domain::Team>> teams{
+        std::make_shared<domain::Team>(domain::Team{"id1", "Uno"}), nullptr,
+        std::make_shared<domain::Team>(domain::Team{"id2", "Dos"})};
+    EXPECT_EQ(serialization::TeamsToJson(teams), R"([{"id":"id1","name":"Uno"},{"id":"id2","name":"Dos"}])");
+    EXPECT_EQ(serialization::TeamToJson(*teams[0]), (nlohmann::json{{"id", "id1"}, {"name", "Uno"}}.dump()));
+
+    auto tournament = std::make_shared<domain::Tournament>("Copa");
+    tournament->Id() = "t1";
+    EXPECT_EQ(serialization::TournamentsToJson({tournament}), R"([{"id":"t1","name":"Copa"}])");
+    EXPECT_EQ(serialization::TournamentToJson(*tournament), R"({"id":"t1","name":"Copa"})");
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "util/Uuid.hpp"
+
+using util::IsValidId;
+using util::Uuid;
+
+TEST(IdValidation, AcceptsSameAlphabetAsPreviousRegex) {
+    EXPECT_TRUE(IsValidId("t1"));
+    EXPECT_TRUE(IsValidId("my-id"));
+    EXPECT_TRUE(IsValidId("5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6e"));
+    EXPECT_TRUE(IsValidId("ABCxyz-019"));
+}
+
+TEST(IdValidation, RejectsEmptyAndForeignCharacters) {
+    EXPECT_FALSE(IsValidId(""));
+    EXPECT_FALSE(IsValidId("bad id"));
+    EXPECT_FALSE(IsValidId("a_b"));
+    EXPECT_FALSE(IsValidId("mal*formado"));
+    EXPECT_FALSE(IsValidId("id\n"));
+    EXPECT_FALSE(IsValidId(std::string("a\0b", 3)));
+}
+
+TEST(Uuid, ParsesCanonicalFormAndRoundTrips) {
+    auto uuid = Uuid::Parse("5F2A7C1E-8b4d-4f7a-9c3e-1d2b3a4c5d6e");
+    ASSERT_TRUE(uuid.has_value());
+    EXPECT_EQ(uuid->Bytes()[0], 0x5F);
+    EXPECT_EQ(uuid->Bytes()[15], 0x6E);
+    EXPECT_EQ(uuid->ToString(), "5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6e");
+    EXPECT_EQ(*uuid, *Uuid::Parse(uuid->ToString()));
+}
+
+TEST(Uuid, RejectsMalformedText) {
+    EXPECT_FALSE(Uuid::Parse("").has_value());
+    EXPECT_FALSE(Uuid::Parse("t1").has_value());
+    EXPECT_FALSE(Uuid::Parse("5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6").has_value());
+    EXPECT_FALSE(Uuid::Parse("5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6e0").has_value());
+    EXPECT_FALSE(Uuid::Parse("5f2a7c1e-8b4d-4f7a-9c3e-1d2b3a4c5d6g").has_value());
+    EXPECT_FALSE(Uuid::Parse("5f2a7c1e_8b4d-4f7a-9c3e-1d2b3a4c5d6e").has_value());
+    EXPECT_FALSE(Uuid::Parse("5f2a7c1e8-b4d-4f7a-9c3e-1d2b3a4c5d6e").has_value());
+}